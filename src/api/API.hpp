@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,7 +21,9 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_API_HPP
 #define WEATHER_INFORMATION_COLLECTOR_API_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #include "Types.hpp"
 #include "../data/Forecast.hpp"
 #include "../data/Location.hpp"
@@ -67,6 +69,20 @@ class API
     virtual bool supportsDataType(const DataType data) const = 0;
 
 
+    /** \brief Checks whether the current weather and the forecast for a
+     *         location are returned by one single request of the API, so
+     *         that separate tasks for both can be merged into one.
+     *
+     * \return Returns true, if DataType::CurrentAndForecast is retrieved
+     *         with one request that has the same cost as a forecast request.
+     *         Returns false otherwise, which is the default.
+     */
+    virtual bool combinedDataInOneRequest() const
+    {
+      return false;
+    }
+
+
     #ifndef wic_no_network_requests
     /** \brief Retrieves the current weather for a given location.
      *
@@ -97,6 +113,106 @@ class API
      *         Returns false, if an error occurred.
      */
     virtual bool currentAndForecastWeather(const Location& location, Weather& weather, Forecast& forecast) = 0;
+
+
+    /** \brief Gets the maximum number of locations that can be requested with
+     *         a single batched request.
+     *
+     * \param data  the requested data type
+     * \return Returns the maximum number of locations per batched request.
+     *         Returns one, if the API does not support batched requests for
+     *         the data type, which is the default.
+     */
+    virtual std::size_t maximumBatchSize([[maybe_unused]] const DataType data) const
+    {
+      return 1;
+    }
+
+
+    /** \brief Checks whether the given location can be part of a batched
+     *         request.
+     *
+     * \param location  the location information
+     * \return Returns true, if the location can be used for a batched request.
+     *         Returns false otherwise.
+     * \remarks Some APIs only allow certain kinds of location information in
+     *          batched requests. By default, every valid location can be used.
+     */
+    virtual bool validBatchLocation(const Location& location) const
+    {
+      return validLocation(location);
+    }
+
+
+    /** \brief Retrieves the current weather for several locations at once.
+     *
+     * \param locations  the locations for which the weather is requested
+     * \param weather    variable where the results will be stored, one per
+     *                   location and in the same order as the locations
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred or if the API does not
+     *         support batched requests.
+     */
+    virtual bool currentWeatherBatch([[maybe_unused]] const std::vector<Location>& locations,
+                                     [[maybe_unused]] std::vector<Weather>& weather)
+    {
+      return false;
+    }
+
+
+    /** \brief Retrieves the weather forecast for several locations at once.
+     *
+     * \param locations  the locations for which the forecast is requested
+     * \param forecast   variable where the results will be stored, one per
+     *                   location and in the same order as the locations
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred or if the API does not
+     *         support batched requests.
+     */
+    virtual bool forecastWeatherBatch([[maybe_unused]] const std::vector<Location>& locations,
+                                      [[maybe_unused]] std::vector<Forecast>& forecast)
+    {
+      return false;
+    }
+
+
+    /** \brief Retrieves the current weather and the forecast for several
+     *         locations at once.
+     *
+     * \param locations  the locations for which the data is requested
+     * \param weather    variable where the current weather results will be
+     *                   stored, one per location and in the same order as the
+     *                   locations
+     * \param forecast   variable where the forecast results will be stored, one
+     *                   per location and in the same order as the locations
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred or if the API does not
+     *         support batched requests.
+     */
+    virtual bool currentAndForecastWeatherBatch([[maybe_unused]] const std::vector<Location>& locations,
+                                                [[maybe_unused]] std::vector<Weather>& weather,
+                                                [[maybe_unused]] std::vector<Forecast>& forecast)
+    {
+      return false;
+    }
+
+
+    /** \brief Gets the URL of the batched request that gets the data of
+     *         several locations with exactly one HTTP GET request.
+     *
+     * \param data       the requested data type
+     * \param locations  the locations
+     * \param url        will be set to the URL of the request
+     * \return Returns true, if the data can be requested that way. The response
+     *         can then be parsed with parseBatch().
+     *         Returns false otherwise, which is the default.
+     */
+    virtual bool batchRequestUrl([[maybe_unused]] const DataType data,
+                                 [[maybe_unused]] const std::vector<Location>& locations,
+                                 [[maybe_unused]] std::string& url) const
+    {
+      return false;
+    }
     #endif // wic_no_network_requests
 
 
@@ -119,12 +235,158 @@ class API
      *         Returns false, if an error occurred.
      */
     virtual bool parseForecast(const std::string& json, Forecast& forecast) const = 0;
+
+
+    /** \brief Parses current weather and forecast information from the same
+     *         JSON, e.g. the response of a request for
+     *         DataType::CurrentAndForecast.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the current weather will be stored
+     * \param forecast variable where the forecast will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     * \remarks The default implementation parses the JSON twice, once with
+     *          parseCurrentWeather() and once with parseForecast(). APIs that
+     *          deliver both in the same response override this to parse the
+     *          JSON only once.
+     */
+    virtual bool parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast) const
+    {
+      return parseCurrentWeather(json, weather) && parseForecast(json, forecast);
+    }
+
+
+    /** \brief Parses the response of a batched request, i. e. a request with
+     *         the URL of batchRequestUrl().
+     *
+     * \param data       the requested data type
+     * \param locations  the requested locations
+     * \param json       string containing the JSON
+     * \param weather    variable where the current weather will be stored, one
+     *                   element per location and in the same order as the
+     *                   locations, if the data type contains current weather
+     * \param forecast   variable where the forecasts will be stored, one element
+     *                   per location and in the same order as the locations, if
+     *                   the data type contains a forecast
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred or if the API does not
+     *         support batched requests, which is the default.
+     */
+    virtual bool parseBatch([[maybe_unused]] const DataType data,
+                            [[maybe_unused]] const std::vector<Location>& locations,
+                            [[maybe_unused]] const std::string& json,
+                            [[maybe_unused]] std::vector<Weather>& weather,
+                            [[maybe_unused]] std::vector<Forecast>& forecast) const
+    {
+      return false;
+    }
     #endif // wic_no_json_parsing
 
 
+    /** \brief Gets the URL of the request that gets the data of a single
+     *         location with exactly one HTTP GET request.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \param url       will be set to the URL of the request
+     * \return Returns true, if the data can be requested that way. The response
+     *         can then be parsed with parseCurrentWeather(), parseForecast()
+     *         or parseCurrentAndForecast(), depending on the data type.
+     *         Returns false otherwise.
+     */
+    bool singleRequestUrl(const DataType data, const Location& location, std::string& url)
+    {
+      url = requestUrl(data, location);
+      return !url.empty();
+    }
+
+
     /** \brief Destructor.
      */
     virtual ~API() = default;
+  protected:
+    /** \brief Constructor.
+     */
+    API()
+    : m_urlData(DataType::none),
+      m_urlLocation(Location()),
+      m_url(std::string())
+    {
+    }
+
+
+    /** \brief Gets the URL of a request for a single location.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type cannot be requested with a single request.
+     * \remarks The URL is only built again, if the data type or the location
+     *          differ from the previous request. The collector uses one
+     *          instance per task, so the URL of a task is built only once.
+     */
+    const std::string& requestUrl(const DataType data, const Location& location)
+    {
+      if ((data != m_urlData) || !sameLocation(location, m_urlLocation))
+      {
+        m_url = buildRequestUrl(data, location);
+        m_urlData = data;
+        m_urlLocation = location;
+      }
+      return m_url;
+    }
+
+
+    /** \brief Builds the URL of a request for a single location.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type cannot be requested with a single request, e.g.
+     *         because the API needs two requests for it or because the API key
+     *         is missing. The default implementation always returns an empty
+     *         string.
+     */
+    virtual std::string buildRequestUrl([[maybe_unused]] const DataType data,
+                                        [[maybe_unused]] const Location& location) const
+    {
+      return std::string();
+    }
+
+
+    /** \brief Discards the URL of the previous request, e.g. because the API
+     *         key has changed.
+     */
+    void discardRequestUrl()
+    {
+      m_urlData = DataType::none;
+    }
+  private:
+    /** \brief Checks whether two locations are exactly the same.
+     *
+     * \param a  the first location
+     * \param b  the second location
+     * \return Returns true, if all data of the locations is the same.
+     * \remarks Unlike the equality operator of Location, this does not treat
+     *          close coordinates as equal.
+     */
+    static bool sameLocation(const Location& a, const Location& b)
+    {
+      if (a.hasCoordinates() != b.hasCoordinates())
+        return false;
+      if (a.hasCoordinates() && ((a.latitude() != b.latitude())
+          || (a.longitude() != b.longitude())))
+        return false;
+      return (a.owmId() == b.owmId()) && (a.name() == b.name())
+          && (a.countryCode() == b.countryCode())
+          && (a.postcode() == b.postcode());
+    }
+
+
+    DataType m_urlData; /**< data type of the previous request */
+    Location m_urlLocation; /**< location of the previous request */
+    std::string m_url; /**< URL of the previous request */
 }; // class
 
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,7 +22,7 @@
 #include <iostream>
 #ifndef wic_no_json_parsing
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonApixu.hpp"
+#include "../json/SimdJsonOnDemandApixu.hpp"
 #else
 #include "../json/NLohmannJsonApixu.hpp"
 #endif // __SIZEOF_INT128__
@@ -43,6 +43,7 @@ Apixu::Apixu(const std::string& key)
 void Apixu::setApiKey(const std::string& key)
 {
   m_apiKey = key;
+  discardRequestUrl();
 }
 
 bool Apixu::needsApiKey()
@@ -67,7 +68,7 @@ bool Apixu::supportsDataType(const DataType data) const
 bool Apixu::parseCurrentWeather(const std::string& json, Weather& weather) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonApixu::parseCurrentWeather(json, weather);
+  return SimdJsonOnDemandApixu::parseCurrentWeather(json, weather);
 #else
   return NLohmannJsonApixu::parseCurrentWeather(json, weather);
 #endif // __SIZEOF_INT128__
@@ -76,7 +77,7 @@ bool Apixu::parseCurrentWeather(const std::string& json, Weather& weather) const
 bool Apixu::parseForecast(const std::string& json, Forecast& forecast) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonApixu::parseForecast(json, forecast);
+  return SimdJsonOnDemandApixu::parseForecast(json, forecast);
 #else
   return NLohmannJsonApixu::parseForecast(json, forecast);
 #endif // __SIZEOF_INT128__
@@ -97,13 +98,30 @@ std::string Apixu::toRequestString(const Location& location)
   return std::string();
 }
 
+std::string Apixu::buildRequestUrl(const DataType data, const Location& location) const
+{
+  if (m_apiKey.empty())
+    return std::string();
+  switch (data)
+  {
+    case DataType::Current:
+         return "https://api.apixu.com/v1/current.json?key="
+                + m_apiKey + "&" + toRequestString(location);
+    case DataType::Forecast:
+    case DataType::CurrentAndForecast:
+         return "https://api.apixu.com/v1/forecast.json?days=7&key="
+                + m_apiKey + "&" + toRequestString(location);
+    default:
+         return std::string();
+  }
+}
+
 bool Apixu::currentWeather(const Location& location, Weather& weather)
 {
   weather = Weather();
   if (m_apiKey.empty())
     return false;
-  const std::string url = "https://api.apixu.com/v1/current.json?key="
-                        + m_apiKey + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::Current, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "Apixu::currentWeather");
   if (!response.has_value())
@@ -118,8 +136,7 @@ bool Apixu::forecastWeather(const Location& location, Forecast& forecast)
   if (m_apiKey.empty())
     return false;
 
-  const std::string url = "https://api.apixu.com/v1/forecast.json?days=7&key="
-                        + m_apiKey + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::Forecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "Apixu::forecastWeather");
   if (!response.has_value())
@@ -136,8 +153,7 @@ bool Apixu::currentAndForecastWeather(const Location& location, Weather& weather
   if (m_apiKey.empty())
     return false;
 
-  const std::string url = "https://api.apixu.com/v1/forecast.json?days=7&key="
-                        + m_apiKey + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::CurrentAndForecast, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   forecast.setRequestTime(weather.requestTime());
   const auto response = Request::get(url, "Apixu::currentAndForecastWeather");
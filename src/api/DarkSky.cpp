@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2018, 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2018, 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,7 +22,7 @@
 #include <iostream>
 #ifndef wic_no_json_parsing
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonDarkSky.hpp"
+#include "../json/SimdJsonOnDemandDarkSky.hpp"
 #else
 #include "../json/NLohmannJsonDarkSky.hpp"
 #endif // __SIZEOF_INT128__
@@ -43,6 +43,7 @@ DarkSky::DarkSky(const std::string& key)
 void DarkSky::setApiKey(const std::string& key)
 {
   m_apiKey = key;
+  discardRequestUrl();
 }
 
 bool DarkSky::needsApiKey()
@@ -63,11 +64,16 @@ bool DarkSky::supportsDataType(const DataType data) const
   return (data != DataType::none);
 }
 
+bool DarkSky::combinedDataInOneRequest() const
+{
+  return true;
+}
+
 #ifndef wic_no_json_parsing
 bool DarkSky::parseCurrentWeather(const std::string& json, Weather& weather) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonDarkSky::parseCurrentWeather(json, weather);
+  return SimdJsonOnDemandDarkSky::parseCurrentWeather(json, weather);
 #else
   return NLohmannJsonDarkSky::parseCurrentWeather(json, weather);
 #endif // __SIZEOF_INT128__
@@ -76,11 +82,20 @@ bool DarkSky::parseCurrentWeather(const std::string& json, Weather& weather) con
 bool DarkSky::parseForecast(const std::string& json, Forecast& forecast) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonDarkSky::parseForecast(json, forecast);
+  return SimdJsonOnDemandDarkSky::parseForecast(json, forecast);
 #else
   return NLohmannJsonDarkSky::parseForecast(json, forecast);
 #endif // __SIZEOF_INT128__
 }
+
+bool DarkSky::parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandDarkSky::parseCurrentAndForecast(json, weather, forecast);
+#else
+  return NLohmannJsonDarkSky::parseCurrentAndForecast(json, weather, forecast);
+#endif // __SIZEOF_INT128__
+}
 #endif // wic_no_json_parsing
 
 #ifndef wic_no_network_requests
@@ -93,14 +108,22 @@ std::string DarkSky::toRequestString(const Location& location)
   return std::string();
 }
 
+std::string DarkSky::buildRequestUrl(const DataType data, const Location& location) const
+{
+  if (m_apiKey.empty() || (data == DataType::none))
+    return std::string();
+  // The same request delivers current weather and forecast.
+  return "https://api.darksky.net/forecast/" + m_apiKey
+         + "/" + toRequestString(location) + "?units=si"
+         + "&exclude=minutely";
+}
+
 bool DarkSky::currentWeather(const Location& location, Weather& weather)
 {
   weather = Weather();
   if (m_apiKey.empty())
     return false;
-  const std::string url = "https://api.darksky.net/forecast/" + m_apiKey
-                        + "/" + toRequestString(location) + "?units=si"
-                        + "&exclude=minutely";
+  const std::string& url = requestUrl(DataType::Current, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "DarkSky::currentWeather");
   if (!response.has_value())
@@ -115,9 +138,7 @@ bool DarkSky::forecastWeather(const Location& location, Forecast& forecast)
   forecast = Forecast();
   if (m_apiKey.empty())
     return false;
-  const std::string url = "https://api.darksky.net/forecast/" + m_apiKey
-                        + "/" + toRequestString(location) + "?units=si"
-                        + "&exclude=minutely";
+  const std::string& url = requestUrl(DataType::Forecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "DarkSky::forecastWeather");
   if (!response.has_value())
@@ -133,19 +154,15 @@ bool DarkSky::currentAndForecastWeather(const Location& location, Weather& weath
   forecast = Forecast();
   if (m_apiKey.empty())
     return false;
-  const std::string url = "https://api.darksky.net/forecast/" + m_apiKey
-                        + "/" + toRequestString(location) + "?units=si"
-                        + "&exclude=minutely";
+  const std::string& url = requestUrl(DataType::CurrentAndForecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   weather.setRequestTime(forecast.requestTime());
   const auto response = Request::get(url, "DarkSky::currentAndForecastWeather");
   if (!response.has_value())
     return false;
 
-  // Parse current weather and forecast with the already existing functions.
-  if (!parseCurrentWeather(response.value(), weather))
-    return false;
-  return parseForecast(response.value(), forecast);
+  // Current weather and forecast are in the same response.
+  return parseCurrentAndForecast(response.value(), weather, forecast);
 }
 #endif // wic_no_network_requests
 
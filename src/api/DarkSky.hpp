@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2018, 2019, 2021, 2022  Dirk Stolle
+    Copyright (C) 2018, 2019, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -71,6 +71,15 @@ class DarkSky: public API
     bool supportsDataType(const DataType data) const override;
 
 
+    /** \brief Checks whether the current weather and the forecast for a
+     *         location are returned by one single request of the API.
+     *
+     * \return Returns true, because the forecast request also returns the
+     *         current weather.
+     */
+    bool combinedDataInOneRequest() const final;
+
+
     #ifndef wic_no_network_requests
     /** \brief Turns info of a location to a request string.
      *
@@ -132,8 +141,32 @@ class DarkSky: public API
      *         Returns false, if an error occurred.
      */
     bool parseForecast(const std::string& json, Forecast& forecast) const override;
+
+
+    /** \brief Parses current weather and forecast information from the same
+     *         JSON. The JSON is only parsed once.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the current weather will be stored
+     * \param forecast variable where the forecast will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast) const override;
     #endif // wic_no_json_parsing
   private:
+    #ifndef wic_no_network_requests
+    /** \brief Builds the URL of a request for a single location.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type cannot be requested with a single request.
+     */
+    std::string buildRequestUrl(const DataType data, const Location& location) const override;
+    #endif // wic_no_network_requests
+
+
     std::string m_apiKey; /**< the API key for requests */
 }; // class
 
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,7 +23,7 @@
 #ifdef wic_openmeteo_find_location
 #include "../util/encode.hpp"
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonOpenMeteo.hpp"
+#include "../json/SimdJsonOnDemandOpenMeteo.hpp"
 #else
 #include "../json/NLohmannJsonOpenMeteo.hpp"
 #endif // __SIZEOF_INT128__
@@ -31,7 +31,7 @@
 #endif // wic_openmeteo_find_location
 #ifndef wic_no_json_parsing
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonOpenMeteo.hpp"
+#include "../json/SimdJsonOnDemandOpenMeteo.hpp"
 #else
 #include "../json/NLohmannJsonOpenMeteo.hpp"
 #endif // __SIZEOF_INT128__
@@ -44,6 +44,11 @@
 namespace wic
 {
 
+OpenMeteo::OpenMeteo()
+: m_unixTime(false)
+{
+}
+
 void OpenMeteo::setApiKey([[maybe_unused]] const std::string& key)
 {
   // Open-Meteo uses no API keys, but an implementation is required by the base
@@ -55,6 +60,35 @@ bool OpenMeteo::needsApiKey()
   return false;
 }
 
+void OpenMeteo::setUnixTime(const bool unixTime)
+{
+  if (unixTime != m_unixTime)
+  {
+    m_unixTime = unixTime;
+    discardRequestUrl();
+  }
+}
+
+std::string OpenMeteo::buildUrl(const DataType data, const std::string& locationString) const
+{
+  // Parameters that all requests share, no matter which data they get.
+  const std::string common = m_unixTime ? "&windspeed_unit=ms&timezone=auto&timeformat=unixtime"
+                                        : "&windspeed_unit=ms&timezone=auto";
+  const std::string hourly = "&hourly=temperature_2m,relativehumidity_2m,precipitation,rain,showers,snowfall,pressure_msl,surface_pressure,cloudcover,windspeed_10m,winddirection_10m";
+  const std::string base = "https://api.open-meteo.com/v1/forecast?";
+  switch (data)
+  {
+    case DataType::Current:
+         return base + locationString + "&current_weather=true" + common;
+    case DataType::Forecast:
+         return base + locationString + hourly + common;
+    case DataType::CurrentAndForecast:
+         return base + locationString + "&current_weather=true" + hourly + common;
+    default:
+         return std::string();
+  }
+}
+
 bool OpenMeteo::validLocation(const Location& location) const
 {
   // Only latitude and longitude are required for a request.
@@ -68,11 +102,16 @@ bool OpenMeteo::supportsDataType(const DataType data) const
   return (data != DataType::none);
 }
 
+bool OpenMeteo::combinedDataInOneRequest() const
+{
+  return true;
+}
+
 #if !defined(wic_no_json_parsing) || defined(wic_openmeteo_find_location)
 bool OpenMeteo::parseCurrentWeather(const std::string& json, Weather& weather) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonOpenMeteo::parseCurrentWeather(json, weather);
+  return SimdJsonOnDemandOpenMeteo::parseCurrentWeather(json, weather);
 #else
   return NLohmannJsonOpenMeteo::parseCurrentWeather(json, weather);
 #endif // __SIZEOF_INT128__
@@ -83,11 +122,86 @@ bool OpenMeteo::parseCurrentWeather(const std::string& json, Weather& weather) c
 bool OpenMeteo::parseForecast(const std::string& json, Forecast& forecast) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonOpenMeteo::parseForecast(json, forecast);
+  return SimdJsonOnDemandOpenMeteo::parseForecast(json, forecast);
 #else
   return NLohmannJsonOpenMeteo::parseForecast(json, forecast);
 #endif // __SIZEOF_INT128__
 }
+
+bool OpenMeteo::parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandOpenMeteo::parseCurrentAndForecast(json, weather, forecast);
+#else
+  return NLohmannJsonOpenMeteo::parseCurrentAndForecast(json, weather, forecast);
+#endif // __SIZEOF_INT128__
+}
+
+bool OpenMeteo::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandOpenMeteo::parseCurrentWeatherBatch(json, weather);
+#else
+  return NLohmannJsonOpenMeteo::parseCurrentWeatherBatch(json, weather);
+#endif // __SIZEOF_INT128__
+}
+
+bool OpenMeteo::parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandOpenMeteo::parseForecastBatch(json, forecasts);
+#else
+  return NLohmannJsonOpenMeteo::parseForecastBatch(json, forecasts);
+#endif // __SIZEOF_INT128__
+}
+
+bool OpenMeteo::parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts);
+#else
+  return NLohmannJsonOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts);
+#endif // __SIZEOF_INT128__
+}
+
+bool OpenMeteo::parseBatch(const DataType data, const std::vector<Location>& locations, const std::string& json,
+                           std::vector<Weather>& weather, std::vector<Forecast>& forecast) const
+{
+  weather.clear();
+  forecast.clear();
+  bool parsed = false;
+  switch (data)
+  {
+    case DataType::Current:
+         parsed = parseCurrentWeatherBatch(json, weather);
+         break;
+    case DataType::Forecast:
+         parsed = parseForecastBatch(json, forecast);
+         break;
+    case DataType::CurrentAndForecast:
+         parsed = parseCurrentAndForecastBatch(json, weather, forecast);
+         break;
+    default:
+         return false;
+  }
+  if (!parsed)
+    return false;
+  // Data is returned in the same order as the coordinates of the request.
+  const bool hasWeather = (data != DataType::Forecast);
+  const bool hasForecast = (data != DataType::Current);
+  if ((hasWeather && (weather.size() != locations.size()))
+      || (hasForecast && (forecast.size() != locations.size())))
+  {
+    std::cerr << "Error: Open-Meteo returned data for "
+              << (hasWeather ? weather.size() : forecast.size())
+              << " location(s), but " << locations.size()
+              << " location(s) were requested." << std::endl;
+    weather.clear();
+    forecast.clear();
+    return false;
+  }
+  return true;
+}
 #endif // wic_no_json_parsing
 
 #if !defined(wic_no_network_requests) || defined(wic_openmeteo_find_location)
@@ -100,11 +214,15 @@ std::string OpenMeteo::toRequestString(const Location& location)
   return std::string();
 }
 
+std::string OpenMeteo::buildRequestUrl(const DataType data, const Location& location) const
+{
+  return buildUrl(data, toRequestString(location));
+}
+
 bool OpenMeteo::currentWeather(const Location& location, Weather& weather)
 {
   weather = Weather();
-  const std::string url = "https://api.open-meteo.com/v1/forecast?"
-                        + toRequestString(location) + "&current_weather=true&windspeed_unit=ms&timezone=auto";
+  const std::string& url = requestUrl(DataType::Current, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "OpenMeteo::currentWeather");
   if (!response.has_value())
@@ -119,9 +237,7 @@ bool OpenMeteo::currentWeather(const Location& location, Weather& weather)
 bool OpenMeteo::forecastWeather(const Location& location, Forecast& forecast)
 {
   forecast = Forecast();
-  const std::string url = "https://api.open-meteo.com/v1/forecast?"
-                        + toRequestString(location)
-                        + "&hourly=temperature_2m,relativehumidity_2m,precipitation,rain,showers,snowfall,pressure_msl,surface_pressure,cloudcover,windspeed_10m,winddirection_10m&windspeed_unit=ms&timezone=auto";
+  const std::string& url = requestUrl(DataType::Forecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "OpenMeteo::forecastWeather");
   if (!response.has_value())
@@ -135,19 +251,99 @@ bool OpenMeteo::currentAndForecastWeather(const Location& location, Weather& wea
 {
   weather = Weather();
   forecast = Forecast();
-  const std::string url = "https://api.open-meteo.com/v1/forecast?"
-                        + toRequestString(location)
-                        + "&current_weather=true&hourly=temperature_2m,relativehumidity_2m,precipitation,rain,showers,snowfall,pressure_msl,surface_pressure,cloudcover,windspeed_10m,winddirection_10m&windspeed_unit=ms&timezone=auto";
+  const std::string& url = requestUrl(DataType::CurrentAndForecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   weather.setRequestTime(forecast.requestTime());
   const auto response = Request::get(url, "OpenMeteo::currentAndForecastWeather");
   if (!response.has_value())
     return false;
 
-  // Parse current weather and forecast with the already existing functions.
-  if (!parseCurrentWeather(response.value(), weather))
+  // Current weather and forecast are in the same response.
+  return parseCurrentAndForecast(response.value(), weather, forecast);
+}
+
+const std::size_t OpenMeteo::maximumLocationsPerRequest = 100;
+
+std::string OpenMeteo::toRequestString(const std::vector<Location>& locations)
+{
+  std::string latitudes;
+  std::string longitudes;
+  for (const Location& location : locations)
+  {
+    if (!location.hasCoordinates())
+      return std::string();
+    if (!latitudes.empty())
+    {
+      latitudes.push_back(',');
+      longitudes.push_back(',');
+    }
+    latitudes += floatToString(location.latitude());
+    longitudes += floatToString(location.longitude());
+  }
+  if (latitudes.empty())
+    return std::string();
+  return "latitude=" + latitudes + "&longitude=" + longitudes;
+}
+
+std::size_t OpenMeteo::maximumBatchSize([[maybe_unused]] const DataType data) const
+{
+  // All data types can be requested for several locations at once.
+  return maximumLocationsPerRequest;
+}
+
+bool OpenMeteo::currentWeatherBatch(const std::vector<Location>& locations, std::vector<Weather>& weather)
+{
+  std::vector<Forecast> forecast;
+  return requestBatch(DataType::Current, locations, weather, forecast, "OpenMeteo::currentWeatherBatch");
+}
+
+bool OpenMeteo::forecastWeatherBatch(const std::vector<Location>& locations, std::vector<Forecast>& forecast)
+{
+  std::vector<Weather> weather;
+  return requestBatch(DataType::Forecast, locations, weather, forecast, "OpenMeteo::forecastWeatherBatch");
+}
+
+bool OpenMeteo::currentAndForecastWeatherBatch(const std::vector<Location>& locations,
+                                               std::vector<Weather>& weather,
+                                               std::vector<Forecast>& forecast)
+{
+  return requestBatch(DataType::CurrentAndForecast, locations, weather, forecast, "OpenMeteo::currentAndForecastWeatherBatch");
+}
+
+bool OpenMeteo::batchRequestUrl(const DataType data, const std::vector<Location>& locations, std::string& url) const
+{
+  const std::string locationString = toRequestString(locations);
+  if (locationString.empty() || (locations.size() > maximumLocationsPerRequest))
+    return false;
+  url = buildUrl(data, locationString);
+  return !url.empty();
+}
+
+bool OpenMeteo::requestBatch(const DataType data, const std::vector<Location>& locations,
+                             std::vector<Weather>& weather, std::vector<Forecast>& forecast,
+                             const std::string_view fn)
+{
+  weather.clear();
+  forecast.clear();
+  std::string url;
+  if (!batchRequestUrl(data, locations, url))
+    return false;
+  const auto requestTime = std::chrono::system_clock::now();
+  const auto response = Request::get(url, fn);
+  if (!response.has_value())
+    return false;
+
+  if (!parseBatch(data, locations, response.value(), weather, forecast))
     return false;
-  return parseForecast(response.value(), forecast);
+  for (Weather& w : weather)
+  {
+    w.setRequestTime(requestTime);
+  }
+  for (Forecast& f : forecast)
+  {
+    f.setRequestTime(requestTime);
+  }
+  return true;
 }
 #endif // wic_no_network_requests
 
@@ -164,7 +360,7 @@ bool OpenMeteo::findLocation(const std::string& name, std::vector<std::pair<Loca
 
   std::vector<Location> bare_locations;
 #ifdef __SIZEOF_INT128__
-  const bool success = SimdJsonOpenMeteo::parseLocations(response.value(), bare_locations);
+  const bool success = SimdJsonOnDemandOpenMeteo::parseLocations(response.value(), bare_locations);
 #else
   const bool success = NLohmannJsonOpenMeteo::parseLocations(response.value(), locations);
 #endif
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,10 +21,11 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_OPENMETEO_HPP
 #define WEATHER_INFORMATION_COLLECTOR_OPENMETEO_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #ifdef wic_openmeteo_find_location
 #include <utility>
-#include <vector>
 #include "../data/Location.hpp"
 #endif // wic_openmeteo_find_location
 #include "API.hpp"
@@ -37,7 +38,9 @@ namespace wic
 class OpenMeteo: public API
 {
   public:
-    OpenMeteo() = default;
+    /** \brief Constructor.
+     */
+    OpenMeteo();
 
 
     /** \brief Sets the API key for API requests.
@@ -54,6 +57,15 @@ class OpenMeteo: public API
     bool needsApiKey() final;
 
 
+    /** \brief Sets whether requests get times as Unix timestamps instead of
+     *         ISO 8601 strings. The parsers handle both formats.
+     *
+     * \param unixTime  true to request Unix timestamps (timeformat=unixtime),
+     *                  false to request ISO 8601 strings
+     */
+    void setUnixTime(const bool unixTime);
+
+
     /** \brief Checks whether the given location can be used for a request.
      *
      * \param location  the location information
@@ -72,6 +84,15 @@ class OpenMeteo: public API
     bool supportsDataType(const DataType data) const override;
 
 
+    /** \brief Checks whether the current weather and the forecast for a
+     *         location are returned by one single request of the API.
+     *
+     * \return Returns true, because the forecast request also returns the
+     *         current weather.
+     */
+    bool combinedDataInOneRequest() const final;
+
+
     #if !defined(wic_no_network_requests) || defined(wic_openmeteo_find_location)
     /** \brief Turns info of a location to a request string.
      *
@@ -117,6 +138,79 @@ class OpenMeteo: public API
      *         Returns false, if an error occurred.
      */
     bool currentAndForecastWeather(const Location& location, Weather& weather, Forecast& forecast) override;
+
+
+    /** \brief maximum number of locations in a single batched request
+     */
+    static const std::size_t maximumLocationsPerRequest;
+
+
+    /** \brief Turns the coordinates of several locations into a request string.
+     *
+     * \param locations  the locations
+     * \return Returns part of URL that can be used for a request.
+     *         Returns empty string, if an error occurred.
+     */
+    static std::string toRequestString(const std::vector<Location>& locations);
+
+
+    /** \brief Gets the maximum number of locations that can be requested with
+     *         a single batched request.
+     *
+     * \param data  the requested data type
+     * \return Returns the maximum number of locations per batched request.
+     */
+    std::size_t maximumBatchSize(const DataType data) const override;
+
+
+    /** \brief Retrieves the current weather for several locations at once.
+     *
+     * \param locations  the locations for which the weather is requested
+     * \param weather    variable where the results will be stored, one per
+     *                   location and in the same order as the locations
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool currentWeatherBatch(const std::vector<Location>& locations, std::vector<Weather>& weather) override;
+
+
+    /** \brief Retrieves the weather forecast for several locations at once.
+     *
+     * \param locations  the locations for which the forecast is requested
+     * \param forecast   variable where the results will be stored, one per
+     *                   location and in the same order as the locations
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool forecastWeatherBatch(const std::vector<Location>& locations, std::vector<Forecast>& forecast) override;
+
+
+    /** \brief Retrieves the current weather and the forecast for several
+     *         locations at once.
+     *
+     * \param locations  the locations for which the data is requested
+     * \param weather    variable where the current weather results will be
+     *                   stored, one per location
+     * \param forecast   variable where the forecast results will be stored,
+     *                   one per location
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool currentAndForecastWeatherBatch(const std::vector<Location>& locations,
+                                        std::vector<Weather>& weather,
+                                        std::vector<Forecast>& forecast) override;
+
+
+    /** \brief Gets the URL of the batched request that gets the data of
+     *         several locations with exactly one HTTP GET request.
+     *
+     * \param data       the requested data type
+     * \param locations  the locations
+     * \param url        will be set to the URL of the request
+     * \return Returns true, if the data can be requested that way.
+     *         Returns false otherwise.
+     */
+    bool batchRequestUrl(const DataType data, const std::vector<Location>& locations, std::string& url) const override;
     #endif // wic_no_network_requests
 
 
@@ -145,6 +239,72 @@ class OpenMeteo: public API
      *         Returns false, if an error occurred.
      */
     bool parseForecast(const std::string& json, Forecast& forecast) const override;
+
+
+    /** \brief Parses current weather and forecast information from the same
+     *         JSON. The JSON is only parsed once.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the current weather will be stored
+     * \param forecast variable where the forecast will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast) const override;
+
+
+    /** \brief Parses the current weather information of several locations
+     *         from JSON into Weather objects.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather) const;
+
+
+    /** \brief Parses the weather forecast information of several locations
+     *         from JSON into Forecast objects.
+     *
+     * \param json       string containing the JSON
+     * \param forecasts  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts) const;
+
+
+    /** \brief Parses current weather and forecast information of several
+     *         locations from the same JSON response. The JSON is only parsed
+     *         once.
+     *
+     * \param json       string containing the JSON
+     * \param weather    variable where the current weather will be stored, one
+     *                   per location
+     * \param forecasts  variable where the forecasts will be stored, one per
+     *                   location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts) const;
+
+
+    /** \brief Parses the response of a batched request.
+     *
+     * \param data       the requested data type
+     * \param locations  the requested locations
+     * \param json       string containing the JSON
+     * \param weather    variable where the current weather will be stored, one
+     *                   per location, if the data type contains current weather
+     * \param forecast   variable where the forecasts will be stored, one per
+     *                   location, if the data type contains a forecast
+     * \return Returns true, if the parsing was successful and the response
+     *         contains data for all locations.
+     *         Returns false, if an error occurred.
+     */
+    bool parseBatch(const DataType data, const std::vector<Location>& locations, const std::string& json,
+                    std::vector<Weather>& weather, std::vector<Forecast>& forecast) const override;
     #endif // wic_no_json_parsing
 
     #ifdef wic_openmeteo_find_location
@@ -157,6 +317,50 @@ class OpenMeteo: public API
      */
     bool findLocation(const std::string& name, std::vector<std::pair<Location, Weather> >& locations);
     #endif // wic_openmeteo_find_location
+  private:
+    #if !defined(wic_no_network_requests) || defined(wic_openmeteo_find_location)
+    /** \brief Builds the URL of a request for a single location.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type cannot be requested with a single request.
+     */
+    std::string buildRequestUrl(const DataType data, const Location& location) const override;
+    #endif
+
+
+    /** \brief Builds the URL of a request for one or several locations.
+     *
+     * \param data            the requested data type
+     * \param locationString  location part of the URL, as returned by
+     *                        toRequestString()
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type is not supported.
+     */
+    std::string buildUrl(const DataType data, const std::string& locationString) const;
+
+
+    #ifndef wic_no_network_requests
+    /** \brief Performs a batched request and parses its response.
+     *
+     * \param data       the requested data type
+     * \param locations  the locations for which the data is requested
+     * \param weather    variable where the current weather results will be
+     *                   stored, one per location
+     * \param forecast   variable where the forecast results will be stored,
+     *                   one per location
+     * \param fn         name of the calling function (only used in error case)
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool requestBatch(const DataType data, const std::vector<Location>& locations,
+                      std::vector<Weather>& weather, std::vector<Forecast>& forecast,
+                      const std::string_view fn);
+    #endif // wic_no_network_requests
+
+
+    bool m_unixTime; /**< whether requests get times as Unix timestamps */
 }; // class
 
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,12 +19,13 @@
 */
 
 #include "OpenWeatherMap.hpp"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #ifdef wic_owm_find_location
 #include "../util/encode.hpp"
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonOwm.hpp"
+#include "../json/SimdJsonOnDemandOwm.hpp"
 #else
 #include "../json/NLohmannJsonOwm.hpp"
 #endif // __SIZEOF_INT128__
@@ -32,7 +33,7 @@
 #endif // wic_owm_find_location
 #ifndef wic_no_json_parsing
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonOwm.hpp"
+#include "../json/SimdJsonOnDemandOwm.hpp"
 #else
 #include "../json/NLohmannJsonOwm.hpp"
 #endif // __SIZEOF_INT128__
@@ -53,6 +54,7 @@ OpenWeatherMap::OpenWeatherMap(const std::string& key)
 void OpenWeatherMap::setApiKey(const std::string& key)
 {
   m_apiKey = key;
+  discardRequestUrl();
 }
 
 bool OpenWeatherMap::needsApiKey()
@@ -83,7 +85,7 @@ bool OpenWeatherMap::supportsDataType(const DataType data) const
 bool OpenWeatherMap::parseCurrentWeather(const std::string& json, Weather& weather) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonOwm::parseCurrentWeather(json, weather);
+  return SimdJsonOnDemandOwm::parseCurrentWeather(json, weather);
 #else
   return NLohmannJsonOwm::parseCurrentWeather(json, weather);
 #endif
@@ -92,11 +94,47 @@ bool OpenWeatherMap::parseCurrentWeather(const std::string& json, Weather& weath
 bool OpenWeatherMap::parseForecast(const std::string& json, Forecast& forecast) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonOwm::parseForecast(json, forecast);
+  return SimdJsonOnDemandOwm::parseForecast(json, forecast);
 #else
   return NLohmannJsonOwm::parseForecast(json, forecast);
 #endif
 }
+
+bool OpenWeatherMap::parseCurrentWeatherGroup(const std::string& json, std::vector<std::pair<uint32_t, Weather> >& weather) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandOwm::parseCurrentWeatherGroup(json, weather);
+#else
+  return NLohmannJsonOwm::parseCurrentWeatherGroup(json, weather);
+#endif
+}
+
+bool OpenWeatherMap::parseBatch(const DataType data, const std::vector<Location>& locations, const std::string& json,
+                                std::vector<Weather>& weather, [[maybe_unused]] std::vector<Forecast>& forecast) const
+{
+  weather.clear();
+  if (data != DataType::Current)
+    return false;
+  std::vector<std::pair<uint32_t, Weather> > group;
+  if (!parseCurrentWeatherGroup(json, group))
+    return false;
+  // The list is not guaranteed to be in the order of the requested ids, so
+  // the data is matched to the locations by id.
+  for (const Location& location : locations)
+  {
+    const auto iter = std::find_if(group.begin(), group.end(),
+        [&location](const std::pair<uint32_t, Weather>& item) { return item.first == location.owmId(); });
+    if (iter == group.end())
+    {
+      std::cerr << "Error: OpenWeatherMap returned no current weather data for "
+                << "the location with id " << location.owmId() << "!" << std::endl;
+      weather.clear();
+      return false;
+    }
+    weather.push_back(iter->second);
+  }
+  return true;
+}
 #endif // wic_no_json_parsing
 
 #ifndef wic_no_network_requests
@@ -115,13 +153,32 @@ std::string OpenWeatherMap::toRequestString(const Location& location)
   return std::string();
 }
 
+std::string OpenWeatherMap::buildRequestUrl(const DataType data, const Location& location) const
+{
+  if (m_apiKey.empty())
+    return std::string();
+  switch (data)
+  {
+    case DataType::Current:
+         return "https://api.openweathermap.org/data/2.5/weather?appid="
+                + m_apiKey + "&" + toRequestString(location);
+    case DataType::Forecast:
+         if (location.empty())
+           return std::string();
+         return "https://api.openweathermap.org/data/2.5/forecast?appid="
+                + m_apiKey + "&" + toRequestString(location);
+    default:
+         // Current weather and forecast need two separate requests.
+         return std::string();
+  }
+}
+
 bool OpenWeatherMap::currentWeather(const Location& location, Weather& weather)
 {
   weather = Weather();
   if (m_apiKey.empty())
     return false;
-  const std::string url = "https://api.openweathermap.org/data/2.5/weather?appid="
-                        + m_apiKey + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::Current, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "OpenWeatherMap::currentWeather");
   if (!response.has_value())
@@ -136,8 +193,7 @@ bool OpenWeatherMap::forecastWeather(const Location& location, Forecast& forecas
   forecast = Forecast();
   if (m_apiKey.empty() || location.empty())
     return false;
-  const std::string url = "https://api.openweathermap.org/data/2.5/forecast?appid="
-                        + m_apiKey + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::Forecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "OpenWeatherMap::forecastWeather");
   if (!response.has_value())
@@ -155,6 +211,70 @@ bool OpenWeatherMap::currentAndForecastWeather([[maybe_unused]] const Location&
             << "single request is not supported by OpenWeatherMap!" << std::endl;
   return false;
 }
+
+// The group endpoint accepts up to 20 city ids per request.
+const std::size_t OpenWeatherMap::maximumLocationsPerRequest = 20;
+
+std::string OpenWeatherMap::toRequestString(const std::vector<Location>& locations)
+{
+  std::string ids;
+  for (const Location& location : locations)
+  {
+    if (!location.hasOwmId())
+      return std::string();
+    if (!ids.empty())
+      ids.push_back(',');
+    ids += std::to_string(location.owmId());
+  }
+  if (ids.empty())
+    return std::string();
+  return "id=" + ids;
+}
+
+std::size_t OpenWeatherMap::maximumBatchSize(const DataType data) const
+{
+  // The group endpoint only provides current weather data.
+  return (data == DataType::Current) ? maximumLocationsPerRequest : 1;
+}
+
+bool OpenWeatherMap::validBatchLocation(const Location& location) const
+{
+  // The group endpoint only accepts ids, no coordinates or names.
+  return location.hasOwmId();
+}
+
+bool OpenWeatherMap::currentWeatherBatch(const std::vector<Location>& locations, std::vector<Weather>& weather)
+{
+  weather.clear();
+  std::string url;
+  if (!batchRequestUrl(DataType::Current, locations, url))
+    return false;
+  const auto requestTime = std::chrono::system_clock::now();
+  const auto response = Request::get(url, "OpenWeatherMap::currentWeatherBatch");
+  if (!response.has_value())
+    return false;
+
+  std::vector<Forecast> forecast;
+  if (!parseBatch(DataType::Current, locations, response.value(), weather, forecast))
+    return false;
+  for (Weather& w : weather)
+  {
+    w.setRequestTime(requestTime);
+  }
+  return true;
+}
+
+bool OpenWeatherMap::batchRequestUrl(const DataType data, const std::vector<Location>& locations, std::string& url) const
+{
+  if (m_apiKey.empty() || (data != DataType::Current))
+    return false;
+  const std::string locationString = toRequestString(locations);
+  if (locationString.empty() || (locations.size() > maximumLocationsPerRequest))
+    return false;
+  url = "https://api.openweathermap.org/data/2.5/group?appid="
+      + m_apiKey + "&" + locationString;
+  return true;
+}
 #endif // wic_no_network_requests
 
 #ifdef wic_owm_find_location
@@ -169,7 +289,7 @@ bool OpenWeatherMap::findLocation(const std::string& name, std::vector<std::pair
     return false;
 
 #ifdef __SIZEOF_INT128__
-  return SimdJsonOwm::parseLocations(response.value(), locations);
+  return SimdJsonOnDemandOwm::parseLocations(response.value(), locations);
 #else
   return NLohmannJsonOwm::parseLocations(response.value(), locations);
 #endif
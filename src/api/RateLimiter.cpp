@@ -0,0 +1,109 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "RateLimiter.hpp"
+#include <algorithm>
+#include "Limits.hpp"
+
+namespace wic
+{
+
+const std::size_t RateLimiter::slotsPerWindow = 1000;
+
+RateLimiter::Window::Window(const Limit& lim)
+: limit(lim),
+  slotLength(std::max(std::chrono::steady_clock::duration(1),
+                      std::chrono::duration_cast<std::chrono::steady_clock::duration>(lim.timespan) / static_cast<int>(slotsPerWindow))),
+  // One more slot than the window has, because the oldest slot may only
+  // partially overlap with the time span of the limit.
+  slots(std::vector<uint_least32_t>(slotsPerWindow + 1, 0)),
+  lastSlot(0),
+  total(0)
+{
+}
+
+RateLimiter::RateLimiter(const PlanOwm owm, const PlanWeatherbit wb, const PlanWeatherstack ws)
+: planOwm(owm),
+  planWb(wb),
+  planWs(ws),
+  windows(std::map<ApiType, Window>()),
+  mutex()
+{
+}
+
+RateLimiter::Window& RateLimiter::window(const ApiType api)
+{
+  auto iter = windows.find(api);
+  if (iter == windows.end())
+  {
+    iter = windows.emplace(api, Window(Limits::forApi(api, planOwm, planWb, planWs))).first;
+  }
+  return iter->second;
+}
+
+bool RateLimiter::tryAcquire(const ApiType api, const std::chrono::steady_clock::time_point& now,
+                             std::chrono::steady_clock::time_point& availableAt,
+                             const uint_least32_t count)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  Window& w = window(api);
+  // Zero requests means that there is no known limit.
+  if (w.limit.requests == 0)
+    return true;
+
+  const auto size = static_cast<int_least64_t>(w.slots.size());
+  const int_least64_t current = std::max(w.lastSlot,
+      static_cast<int_least64_t>(now.time_since_epoch() / w.slotLength));
+  // Drop all slots that are now outside of the window.
+  const int_least64_t firstStale = std::max(w.lastSlot + 1, current - size + 1);
+  for (int_least64_t slot = firstStale; slot <= current; ++slot)
+  {
+    auto& counter = w.slots[slot % size];
+    w.total -= counter;
+    counter = 0;
+  }
+  w.lastSlot = current;
+
+  // An oversized request is allowed when the window is empty, otherwise it
+  // would never be possible.
+  if ((w.total + count <= w.limit.requests) || (w.total == 0))
+  {
+    w.slots[current % size] += count;
+    w.total += count;
+    return true;
+  }
+
+  // Find the oldest slot that has to leave the window to make room.
+  const uint_least64_t excess = w.total + count - w.limit.requests;
+  uint_least64_t freed = 0;
+  int_least64_t slot = current - size + 1;
+  for ( ; slot <= current; ++slot)
+  {
+    if (slot < 0)
+      continue;
+    freed += w.slots[slot % size];
+    if (freed >= excess)
+      break;
+  }
+  availableAt = std::chrono::steady_clock::time_point((slot + size) * w.slotLength);
+  return false;
+}
+
+} // namespace
@@ -0,0 +1,111 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_RATELIMITER_HPP
+#define WEATHER_INFORMATION_COLLECTOR_RATELIMITER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "Limit.hpp"
+#include "Plans.hpp"
+#include "Types.hpp"
+
+namespace wic
+{
+
+/** \brief Enforces the request limits of the APIs at runtime.
+ *
+ * Each API gets a sliding window that counts the requests of the last time
+ * span of its limit (see Limits::forApi()). The window is divided into a fixed
+ * number of slots, and a request is only granted when the requests in all
+ * slots that overlap the time span stay below the limit. This is slightly
+ * conservative, but it guarantees that the limit is never exceeded in any
+ * time span of the given length.
+ */
+class RateLimiter
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param planOwm the pricing plan for OpenWeatherMap
+     * \param planWb  the pricing plan for Weatherbit
+     * \param planWs  the pricing plan for Weatherstack
+     */
+    RateLimiter(const PlanOwm planOwm, const PlanWeatherbit planWb, const PlanWeatherstack planWs);
+
+
+    /** \brief number of slots per sliding window
+     */
+    static const std::size_t slotsPerWindow;
+
+
+    /** \brief Tries to acquire permission for requests to an API.
+     *
+     * \param api     the API that shall be requested
+     * \param now     the current time
+     * \param availableAt  will be set to the earliest time when the requests
+     *                are possible, if they are not possible right now
+     * \param count   number of requests
+     * \return Returns true, if the requests may be performed now. In that case
+     *         the requests are counted against the limit.
+     *         Returns false, if the requests would exceed the limit.
+     */
+    bool tryAcquire(const ApiType api, const std::chrono::steady_clock::time_point& now,
+                    std::chrono::steady_clock::time_point& availableAt,
+                    const uint_least32_t count = 1);
+  private:
+    /** \brief Sliding window of a single API. */
+    struct Window
+    {
+      /** \brief Constructor.
+       *
+       * \param lim  the request limit of the API
+       */
+      explicit Window(const Limit& lim);
+
+      Limit limit; /**< request limit of the API */
+      std::chrono::steady_clock::duration slotLength; /**< length of a single slot */
+      std::vector<uint_least32_t> slots; /**< ring buffer of request counts */
+      int_least64_t lastSlot; /**< number of the most recent slot */
+      uint_least64_t total; /**< sum of all counts in slots */
+    }; // struct
+
+
+    /** \brief Gets the sliding window of an API, creates it if necessary.
+     *
+     * \param api  the API
+     * \return Returns the window of the API.
+     */
+    Window& window(const ApiType api);
+
+
+    PlanOwm planOwm; /**< pricing plan for OpenWeatherMap */
+    PlanWeatherbit planWb; /**< pricing plan for Weatherbit */
+    PlanWeatherstack planWs; /**< pricing plan for Weatherstack */
+    std::map<ApiType, Window> windows; /**< sliding windows per API */
+    std::mutex mutex; /**< guards windows */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_RATELIMITER_HPP
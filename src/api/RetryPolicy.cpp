@@ -0,0 +1,250 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "RetryPolicy.hpp"
+#include <algorithm>
+#include <cctype>
+#include <ctime>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include "Limits.hpp"
+#include "../util/Strings.hpp"
+
+namespace wic
+{
+
+namespace
+{
+
+/** \brief number of retries per hour for APIs without a known request limit
+ */
+const uint_least32_t unlimitedBudget = 60;
+
+/** \brief Gets the number of days since 1970-01-01 of a date in the
+ *         proleptic Gregorian calendar.
+ *
+ * \param year   the year, e. g. 2025
+ * \param month  the month, from 1 to 12
+ * \param day    the day of the month, from 1 to 31
+ * \return Returns the number of days since 1970-01-01.
+ */
+int_least64_t daysSinceEpoch(int_least64_t year, const unsigned int month, const unsigned int day)
+{
+  // See Howard Hinnant's days_from_civil() algorithm.
+  year -= (month <= 2) ? 1 : 0;
+  const int_least64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int_least64_t yearOfEra = year - era * 400;
+  const int_least64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int_least64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+} // namespace
+
+const unsigned int RetryPolicy::maxRetries = 3;
+
+const std::chrono::milliseconds RetryPolicy::baseDelay = std::chrono::seconds(2);
+
+const std::chrono::milliseconds RetryPolicy::maxDelay = std::chrono::seconds(60);
+
+const unsigned int RetryPolicy::failureThreshold = 5;
+
+const std::chrono::seconds RetryPolicy::initialCooldown = std::chrono::seconds(60);
+
+const std::chrono::seconds RetryPolicy::maxCooldown = std::chrono::minutes(30);
+
+RetryPolicy::State::State(const uint_least32_t retryBudget, const std::chrono::seconds& span)
+: budget(retryBudget),
+  budgetSpan(span),
+  budgetStart(std::chrono::steady_clock::time_point()),
+  retries(0),
+  failures(0),
+  cooldown(initialCooldown),
+  openUntil(std::chrono::steady_clock::time_point()),
+  trial(false),
+  trialStart(std::chrono::steady_clock::time_point())
+{
+}
+
+RetryPolicy::RetryPolicy(const PlanOwm owm, const PlanWeatherbit wb, const PlanWeatherstack ws)
+: planOwm(owm),
+  planWb(wb),
+  planWs(ws),
+  states(std::map<ApiType, State>()),
+  random(std::mt19937(std::random_device()())),
+  mutex()
+{
+}
+
+bool RetryPolicy::isRetryable(const long statusCode)
+{
+  switch (statusCode)
+  {
+    case 0:   // no response at all, e. g. timeout or connection failure
+    case 408: // Request Timeout
+    case 429: // Too Many Requests
+    case 500: // Internal Server Error
+    case 502: // Bad Gateway
+    case 503: // Service Unavailable
+    case 504: // Gateway Timeout
+         return true;
+    default:
+         return false;
+  }
+}
+
+std::chrono::seconds RetryPolicy::parseRetryAfter(const std::string& value, const std::chrono::system_clock::time_point& now)
+{
+  std::string str(value);
+  trim(str);
+  if (str.empty())
+    return std::chrono::seconds::zero();
+  if (std::all_of(str.begin(), str.end(), [](const unsigned char c) { return std::isdigit(c) != 0; }))
+  {
+    int seconds = 0;
+    // Values that do not fit into an int are way too long anyway.
+    if (!stringToInt(str, seconds))
+      return std::chrono::seconds::zero();
+    return std::chrono::seconds(seconds);
+  }
+
+  // HTTP date, always in GMT, e. g. "Wed, 21 Oct 2015 07:28:00 GMT"
+  std::istringstream stream(str);
+  stream.imbue(std::locale::classic());
+  std::tm date = {};
+  stream >> std::get_time(&date, "%a, %d %b %Y %H:%M:%S");
+  if (stream.fail())
+    return std::chrono::seconds::zero();
+  // std::mktime() would use the local time zone, so the time is calculated
+  // manually.
+  const int_least64_t days = daysSinceEpoch(date.tm_year + 1900, date.tm_mon + 1, date.tm_mday);
+  const std::chrono::system_clock::time_point then(std::chrono::seconds(
+      days * 86400 + date.tm_hour * 3600 + date.tm_min * 60 + date.tm_sec));
+  if (then <= now)
+    return std::chrono::seconds::zero();
+  return std::chrono::duration_cast<std::chrono::seconds>(then - now);
+}
+
+std::chrono::milliseconds RetryPolicy::backoff(const unsigned int retry, const std::chrono::seconds& retryAfter)
+{
+  std::chrono::milliseconds delay = maxDelay;
+  // Larger shifts would overflow, and they would exceed the maximum anyway.
+  if (retry < 16)
+    delay = std::min(maxDelay, baseDelay * (1 << retry));
+  std::chrono::milliseconds::rep jitter = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distribution(delay.count() / 2, delay.count());
+    jitter = distribution(random);
+  }
+  // The API knows best when it will be available again.
+  return std::max(std::chrono::milliseconds(jitter),
+                  std::chrono::duration_cast<std::chrono::milliseconds>(retryAfter));
+}
+
+RetryPolicy::State& RetryPolicy::state(const ApiType api)
+{
+  auto iter = states.find(api);
+  if (iter == states.end())
+  {
+    const Limit limit = Limits::forApi(api, planOwm, planWb, planWs);
+    // Zero requests means that there is no known limit.
+    if (limit.requests == 0)
+      iter = states.emplace(api, State(unlimitedBudget, std::chrono::hours(1))).first;
+    else
+      iter = states.emplace(api, State(std::max<uint_least32_t>(1, limit.requests / 10), limit.timespan)).first;
+  }
+  return iter->second;
+}
+
+bool RetryPolicy::tryRetry(const ApiType api, const std::chrono::steady_clock::time_point& now)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  State& s = state(api);
+  if ((s.retries == 0) || (now - s.budgetStart >= s.budgetSpan))
+  {
+    s.budgetStart = now;
+    s.retries = 0;
+  }
+  if (s.retries >= s.budget)
+    return false;
+  ++s.retries;
+  return true;
+}
+
+bool RetryPolicy::allowRequest(const ApiType api, const std::chrono::steady_clock::time_point& now)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  State& s = state(api);
+  if (now < s.openUntil)
+    return false;
+  if (s.failures < failureThreshold)
+    return true;
+  // The cooldown is over, but only one request may find out whether the API
+  // works again. If its result never arrives, the next request tries later.
+  if (s.trial && (now - s.trialStart < initialCooldown))
+    return false;
+  s.trial = true;
+  s.trialStart = now;
+  return true;
+}
+
+bool RetryPolicy::isAvailable(const ApiType api, const std::chrono::steady_clock::time_point& now)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  const State& s = state(api);
+  if (now < s.openUntil)
+    return false;
+  if (s.failures < failureThreshold)
+    return true;
+  return !s.trial || (now - s.trialStart >= initialCooldown);
+}
+
+void RetryPolicy::recordSuccess(const ApiType api)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  State& s = state(api);
+  s.failures = 0;
+  s.cooldown = initialCooldown;
+  s.trial = false;
+}
+
+bool RetryPolicy::recordFailure(const ApiType api, const std::chrono::steady_clock::time_point& now,
+                                const std::chrono::seconds& retryAfter)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  State& s = state(api);
+  const bool wasOpen = now < s.openUntil;
+  ++s.failures;
+  s.trial = false;
+  // Requests that were already running when the breaker opened do not
+  // prolong the cooldown.
+  if ((s.failures >= failureThreshold) && !wasOpen)
+  {
+    s.openUntil = now + s.cooldown;
+    s.cooldown = std::min(maxCooldown, s.cooldown * 2);
+  }
+  if (retryAfter > std::chrono::seconds::zero())
+    s.openUntil = std::max(s.openUntil, now + retryAfter);
+  return !wasOpen && (now < s.openUntil);
+}
+
+} // namespace
@@ -0,0 +1,221 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_RETRYPOLICY_HPP
+#define WEATHER_INFORMATION_COLLECTOR_RETRYPOLICY_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include "Plans.hpp"
+#include "Types.hpp"
+
+namespace wic
+{
+
+/** \brief Decides whether and when failed requests to an API are repeated.
+ *
+ * Failed requests are retried with exponential backoff and random jitter, but
+ * never earlier than a Retry-After header of the API asks for. Each API has a
+ * retry budget of a tenth of the request limit of its plan (see
+ * Limits::forApi()), so retries cannot use up the quota of the regular
+ * requests.
+ *
+ * Additionally, each API has a circuit breaker: After several failed requests
+ * in a row the API is considered to be down, and no requests are made for a
+ * cooldown period that grows with each further failure. After the cooldown a
+ * single trial request decides whether the API works again.
+ */
+class RetryPolicy
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param planOwm the pricing plan for OpenWeatherMap
+     * \param planWb  the pricing plan for Weatherbit
+     * \param planWs  the pricing plan for Weatherstack
+     */
+    RetryPolicy(const PlanOwm planOwm, const PlanWeatherbit planWb, const PlanWeatherstack planWs);
+
+
+    /** \brief maximum number of retries of a single request
+     */
+    static const unsigned int maxRetries;
+
+
+    /** \brief delay before the first retry, later retries wait twice as long as
+     *         the previous one
+     */
+    static const std::chrono::milliseconds baseDelay;
+
+
+    /** \brief maximum delay between two attempts, unless the API asks for a
+     *         longer delay
+     */
+    static const std::chrono::milliseconds maxDelay;
+
+
+    /** \brief number of failed requests in a row that opens the circuit breaker
+     */
+    static const unsigned int failureThreshold;
+
+
+    /** \brief time without requests after the circuit breaker has opened for
+     *         the first time
+     */
+    static const std::chrono::seconds initialCooldown;
+
+
+    /** \brief maximum time without requests after the circuit breaker has opened
+     */
+    static const std::chrono::seconds maxCooldown;
+
+
+    /** \brief Checks whether a failed request may succeed when it is repeated.
+     *
+     * \param statusCode  the HTTP status code of the response, or zero, if
+     *                    there was no response (e. g. after a timeout)
+     * \return Returns true for network errors, rate limiting (429) and
+     *         temporary server errors. Returns false for all other status
+     *         codes, e. g. for an invalid API key.
+     */
+    static bool isRetryable(const long statusCode);
+
+
+    /** \brief Parses the value of a Retry-After header.
+     *
+     * \param value  the header value, either a number of seconds or an HTTP
+     *               date like "Wed, 21 Oct 2015 07:28:00 GMT"
+     * \param now    the current time
+     * \return Returns the time to wait. Returns zero, if the value is empty,
+     *         invalid or lies in the past.
+     */
+    static std::chrono::seconds parseRetryAfter(const std::string& value, const std::chrono::system_clock::time_point& now);
+
+
+    /** \brief Gets the delay before a retry.
+     *
+     * \param retry       number of the retry, starting at zero
+     * \param retryAfter  delay that the API asked for, may be zero
+     * \return Returns a random delay between the half and the full
+     *         exponential backoff, but at least @arg retryAfter.
+     */
+    std::chrono::milliseconds backoff(const unsigned int retry, const std::chrono::seconds& retryAfter);
+
+
+    /** \brief Tries to take a retry from the budget of an API.
+     *
+     * \param api  the API
+     * \param now  the current time
+     * \return Returns true, if the retry is within the budget. In that case it
+     *         is counted against the budget.
+     *         Returns false, if the budget is exhausted.
+     */
+    bool tryRetry(const ApiType api, const std::chrono::steady_clock::time_point& now);
+
+
+    /** \brief Checks whether the circuit breaker of an API lets a request pass.
+     *
+     * \param api  the API
+     * \param now  the current time
+     * \return Returns true, if a request to the API may be made now.
+     *         Returns false, if the API is considered to be down.
+     * \remarks After the cooldown only one request passes until its result is
+     *          recorded, or until another cooldown period has passed.
+     */
+    bool allowRequest(const ApiType api, const std::chrono::steady_clock::time_point& now);
+
+
+    /** \brief Checks whether allowRequest() would let a request pass, but
+     *         does not start a trial request after the cooldown.
+     *
+     * \param api  the API
+     * \param now  the current time
+     * \return Returns true, if allowRequest() would return true right now.
+     *         Returns false, if the API is considered to be down.
+     */
+    bool isAvailable(const ApiType api, const std::chrono::steady_clock::time_point& now);
+
+
+    /** \brief Records a successful request to an API, which closes its
+     *         circuit breaker.
+     *
+     * \param api  the API
+     */
+    void recordSuccess(const ApiType api);
+
+
+    /** \brief Records a failed request to an API.
+     *
+     * \param api         the API
+     * \param now         the current time
+     * \param retryAfter  delay that the API asked for, may be zero
+     * \return Returns true, if the circuit breaker of the API opened because of
+     *         this failure.
+     * \remarks A delay requested by the API keeps the circuit breaker open
+     *          for at least that time, because it applies to all requests.
+     */
+    bool recordFailure(const ApiType api, const std::chrono::steady_clock::time_point& now,
+                       const std::chrono::seconds& retryAfter);
+  private:
+    /** \brief State of a single API. */
+    struct State
+    {
+      /** \brief Constructor.
+       *
+       * \param budget      number of retries per budget period
+       * \param budgetSpan  length of a budget period
+       */
+      State(const uint_least32_t budget, const std::chrono::seconds& budgetSpan);
+
+      uint_least32_t budget; /**< number of retries per budget period */
+      std::chrono::seconds budgetSpan; /**< length of a budget period */
+      std::chrono::steady_clock::time_point budgetStart; /**< start of the current budget period */
+      uint_least32_t retries; /**< retries in the current budget period */
+      unsigned int failures; /**< number of failed requests in a row */
+      std::chrono::seconds cooldown; /**< length of the next cooldown */
+      std::chrono::steady_clock::time_point openUntil; /**< end of the current cooldown */
+      bool trial; /**< whether a trial request after a cooldown is running */
+      std::chrono::steady_clock::time_point trialStart; /**< start of the trial request */
+    }; // struct
+
+
+    /** \brief Gets the state of an API, creates it if necessary.
+     *
+     * \param api  the API
+     * \return Returns the state of the API.
+     */
+    State& state(const ApiType api);
+
+
+    PlanOwm planOwm; /**< pricing plan for OpenWeatherMap */
+    PlanWeatherbit planWb; /**< pricing plan for Weatherbit */
+    PlanWeatherstack planWs; /**< pricing plan for Weatherstack */
+    std::map<ApiType, State> states; /**< states per API */
+    std::mt19937 random; /**< random number generator for the jitter */
+    std::mutex mutex; /**< guards states and random */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_RETRYPOLICY_HPP
@@ -22,7 +22,7 @@
 #include <iostream>
 #ifndef wic_no_json_parsing
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonWeatherbit.hpp"
+#include "../json/SimdJsonOnDemandWeatherbit.hpp"
 #else
 #include "../json/NLohmannJsonWeatherbit.hpp"
 #endif
@@ -44,6 +44,7 @@ Weatherbit::Weatherbit(const PlanWeatherbit plan, const std::string& key)
 void Weatherbit::setApiKey(const std::string& key)
 {
   m_apiKey = key;
+  discardRequestUrl();
 }
 
 bool Weatherbit::needsApiKey()
@@ -87,7 +88,7 @@ bool Weatherbit::supportsDataType(const DataType data) const
 bool Weatherbit::parseCurrentWeather(const std::string& json, Weather& weather) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonWeatherbit::parseCurrentWeather(json, weather);
+  return SimdJsonOnDemandWeatherbit::parseCurrentWeather(json, weather);
 #else
   return NLohmannJsonWeatherbit::parseCurrentWeather(json, weather);
 #endif // __SIZEOF_INT128__
@@ -96,11 +97,38 @@ bool Weatherbit::parseCurrentWeather(const std::string& json, Weather& weather)
 bool Weatherbit::parseForecast(const std::string& json, Forecast& forecast) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonWeatherbit::parseForecast(json, forecast);
+  return SimdJsonOnDemandWeatherbit::parseForecast(json, forecast);
 #else
   return NLohmannJsonWeatherbit::parseForecast(json, forecast);
 #endif
 }
+
+bool Weatherbit::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather) const
+{
+#ifdef __SIZEOF_INT128__
+  return SimdJsonOnDemandWeatherbit::parseCurrentWeatherBatch(json, weather);
+#else
+  return NLohmannJsonWeatherbit::parseCurrentWeatherBatch(json, weather);
+#endif
+}
+
+bool Weatherbit::parseBatch(const DataType data, const std::vector<Location>& locations, const std::string& json,
+                            std::vector<Weather>& weather, [[maybe_unused]] std::vector<Forecast>& forecast) const
+{
+  weather.clear();
+  if ((data != DataType::Current) || !parseCurrentWeatherBatch(json, weather))
+    return false;
+  // Data is returned in the same order as the points of the request.
+  if (weather.size() != locations.size())
+  {
+    std::cerr << "Error: Weatherbit returned current weather data for "
+              << weather.size() << " location(s), but " << locations.size()
+              << " location(s) were requested." << std::endl;
+    weather.clear();
+    return false;
+  }
+  return true;
+}
 #endif // wic_no_json_parsing
 
 #ifndef wic_no_network_requests
@@ -126,16 +154,39 @@ std::string Weatherbit::toRequestString(const Location& location)
   return std::string();
 }
 
+std::string Weatherbit::buildRequestUrl(const DataType data, const Location& location) const
+{
+  if (m_apiKey.empty())
+    return std::string();
+  switch (data)
+  {
+    case DataType::Current:
+         return "https://api.weatherbit.io/v2.0/current?key=" + m_apiKey
+                // Use the metric system, because we don't want any quarter pounder with cheese today.
+                + std::string("&units=M")
+                + "&" + toRequestString(location);
+    case DataType::Forecast:
+         // Hourly forecasts are not available on the free plan.
+         return ((m_plan == PlanWeatherbit::Free)
+                ? "https://api.weatherbit.io/v2.0/forecast/daily?key="
+                : "https://api.weatherbit.io/v2.0/forecast/hourly?key=")
+                + m_apiKey
+                // Use the metric system.
+                + std::string("&units=M")
+                + "&" + toRequestString(location);
+    default:
+         // Current weather and forecast need two separate requests.
+         return std::string();
+  }
+}
+
 bool Weatherbit::currentWeather(const Location& location, Weather& weather)
 {
   weather = Weather();
   if (m_apiKey.empty())
     return false;
   // https://api.weatherbit.io/v2.0/current?key=API-key-here&city=city-name-here&country=ISO-3166-two-letter-code-here
-  const std::string url = "https://api.weatherbit.io/v2.0/current?key=" + m_apiKey
-                        // Use the metric system, because we don't want any quarter pounder with cheese today.
-                        + std::string("&units=M")
-                        + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::Current, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "Weatherbit::currentWeather");
   if (!response.has_value())
@@ -156,25 +207,7 @@ bool Weatherbit::forecastWeather(const Location& location, Forecast& forecast)
   // https://api.weatherbit.io/v2.0/forecast/3hourly?key=you-API-key-here&city=city-name-here&country=ISO-3166-two-letter-code-here
   // hourly forecast for up to 48 hours (or up to 120 for premium users)
   // https://api.weatherbit.io/v2.0/forecast/hourly?key=you-API-key-here&city=city-name-here&country=ISO-3166-two-letter-code-here
-  std::string url;
-  switch(m_plan)
-  {
-    case PlanWeatherbit::Free:
-         url = "https://api.weatherbit.io/v2.0/forecast/daily?key=" + m_apiKey
-               // Use the metric system.
-               + std::string("&units=M")
-               + "&" + toRequestString(location);
-         break;
-    case PlanWeatherbit::Standard:
-    case PlanWeatherbit::Plus:
-    case PlanWeatherbit::Business:
-    default:
-         url = "https://api.weatherbit.io/v2.0/forecast/hourly?key=" + m_apiKey
-               // Use the metric system.
-               + std::string("&units=M")
-               + "&" + toRequestString(location);
-         break;
-  }
+  const std::string& url = requestUrl(DataType::Forecast, location);
   forecast.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "Weatherbit::forecastWeather");
   if (!response.has_value())
@@ -192,6 +225,78 @@ bool Weatherbit::currentAndForecastWeather([[maybe_unused]] const Location& loca
             << "single request is not supported by Weatherbit!" << std::endl;
   return false;
 }
+
+const std::size_t Weatherbit::maximumLocationsPerRequest = 100;
+
+std::string Weatherbit::toRequestString(const std::vector<Location>& locations)
+{
+  // Several locations are given as list of points like
+  // points=(51.05,13.74),(52.52,13.42).
+  std::string points;
+  for (const Location& location : locations)
+  {
+    if (!location.hasCoordinates())
+      return std::string();
+    if (!points.empty())
+      points.push_back(',');
+    points += "(" + floatToString(location.latitude()) + ","
+            + floatToString(location.longitude()) + ")";
+  }
+  if (points.empty())
+    return std::string();
+  return "points=" + points;
+}
+
+std::size_t Weatherbit::maximumBatchSize(const DataType data) const
+{
+  // Requests for several locations are only available for current weather
+  // data, and the free plan does not have them at all.
+  if ((data != DataType::Current) || (m_plan == PlanWeatherbit::Free)
+      || (m_plan == PlanWeatherbit::none))
+    return 1;
+  return maximumLocationsPerRequest;
+}
+
+bool Weatherbit::validBatchLocation(const Location& location) const
+{
+  // Only coordinates can be used for several locations at once.
+  return location.hasCoordinates();
+}
+
+bool Weatherbit::currentWeatherBatch(const std::vector<Location>& locations, std::vector<Weather>& weather)
+{
+  weather.clear();
+  std::string url;
+  if (!batchRequestUrl(DataType::Current, locations, url))
+    return false;
+  const auto requestTime = std::chrono::system_clock::now();
+  const auto response = Request::get(url, "Weatherbit::currentWeatherBatch");
+  if (!response.has_value())
+    return false;
+
+  std::vector<Forecast> forecast;
+  if (!parseBatch(DataType::Current, locations, response.value(), weather, forecast))
+    return false;
+  for (Weather& w : weather)
+  {
+    w.setRequestTime(requestTime);
+  }
+  return true;
+}
+
+bool Weatherbit::batchRequestUrl(const DataType data, const std::vector<Location>& locations, std::string& url) const
+{
+  if (m_apiKey.empty() || (data != DataType::Current))
+    return false;
+  const std::string locationString = toRequestString(locations);
+  if (locationString.empty() || (locations.size() > maximumLocationsPerRequest))
+    return false;
+  // https://api.weatherbit.io/v2.0/current?key=API-key-here&points=(lat,lon),(lat,lon)
+  url = "https://api.weatherbit.io/v2.0/current?key=" + m_apiKey
+      + std::string("&units=M")
+      + "&" + locationString;
+  return true;
+}
 #endif // wic_no_network_requests
 
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,7 +21,9 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_WEATHERBIT_HPP
 #define WEATHER_INFORMATION_COLLECTOR_WEATHERBIT_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #include "API.hpp"
 #include "Plans.hpp"
 
@@ -112,6 +114,66 @@ class Weatherbit: public API
      *         Returns false, if an error occurred.
      */
     bool currentAndForecastWeather(const Location& location, Weather& weather, Forecast& forecast) override;
+
+
+    /** \brief maximum number of locations in a single request for several
+     *         locations
+     */
+    static const std::size_t maximumLocationsPerRequest;
+
+
+    /** \brief Turns the coordinates of several locations into a request string.
+     *
+     * \param locations  the locations
+     * \return Returns part of URL that can be used for a request.
+     *         Returns empty string, if an error occurred.
+     */
+    static std::string toRequestString(const std::vector<Location>& locations);
+
+
+    /** \brief Gets the maximum number of locations that can be requested with
+     *         a single batched request.
+     *
+     * \param data  the requested data type
+     * \return Returns the maximum number of locations per batched request.
+     *         Only current weather data can be requested for several
+     *         locations at once, and only with paid plans.
+     */
+    std::size_t maximumBatchSize(const DataType data) const override;
+
+
+    /** \brief Checks whether the given location can be part of a batched
+     *         request.
+     *
+     * \param location  the location information
+     * \return Returns true, if the location has coordinates.
+     *         Returns false otherwise.
+     */
+    bool validBatchLocation(const Location& location) const override;
+
+
+    /** \brief Retrieves the current weather for several locations at once.
+     *
+     * \param locations  the locations for which the weather is requested,
+     *                   all of them need coordinates
+     * \param weather    variable where the results will be stored, one per
+     *                   location and in the same order as the locations
+     * \return Returns true, if the request was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool currentWeatherBatch(const std::vector<Location>& locations, std::vector<Weather>& weather) override;
+
+
+    /** \brief Gets the URL of the batched request that gets the data of
+     *         several locations with exactly one HTTP GET request.
+     *
+     * \param data       the requested data type
+     * \param locations  the locations
+     * \param url        will be set to the URL of the request
+     * \return Returns true, if the data can be requested that way.
+     *         Returns false otherwise.
+     */
+    bool batchRequestUrl(const DataType data, const std::vector<Location>& locations, std::string& url) const override;
     #endif // wic_no_network_requests
 
 
@@ -134,8 +196,48 @@ class Weatherbit: public API
      *         Returns false, if an error occurred.
      */
     bool parseForecast(const std::string& json, Forecast& forecast) const override;
+
+
+    /** \brief Parses the current weather information of several locations
+     *         from JSON into Weather objects.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather) const;
+
+
+    /** \brief Parses the response of a batched request.
+     *
+     * \param data       the requested data type, only DataType::Current is
+     *                   supported
+     * \param locations  the requested locations
+     * \param json       string containing the JSON
+     * \param weather    variable where the current weather will be stored, one
+     *                   per location and in the same order as the locations
+     * \param forecast   not used, because there are no batched forecasts
+     * \return Returns true, if the parsing was successful and the response
+     *         contains data for all locations.
+     *         Returns false, if an error occurred.
+     */
+    bool parseBatch(const DataType data, const std::vector<Location>& locations, const std::string& json,
+                    std::vector<Weather>& weather, std::vector<Forecast>& forecast) const override;
     #endif // wic_no_json_parsing
   private:
+    #ifndef wic_no_network_requests
+    /** \brief Builds the URL of a request for a single location.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type cannot be requested with a single request.
+     */
+    std::string buildRequestUrl(const DataType data, const Location& location) const override;
+    #endif // wic_no_network_requests
+
+
     std::string m_apiKey; /**< the API key for requests */
     PlanWeatherbit m_plan; /**< the Weatherbit plan */
 }; // class
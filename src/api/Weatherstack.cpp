@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,7 +22,7 @@
 #include <iostream>
 #ifndef wic_no_json_parsing
 #ifdef __SIZEOF_INT128__
-#include "../json/SimdJsonWeatherstack.hpp"
+#include "../json/SimdJsonOnDemandWeatherstack.hpp"
 #else
 #include "../json/NLohmannJsonWeatherstack.hpp"
 #endif // __SIZEOF_INT128__
@@ -44,6 +44,7 @@ Weatherstack::Weatherstack(const PlanWeatherstack plan, const std::string& key)
 void Weatherstack::setApiKey(const std::string& key)
 {
   m_apiKey = key;
+  discardRequestUrl();
 }
 
 bool Weatherstack::needsApiKey()
@@ -69,7 +70,7 @@ bool Weatherstack::supportsDataType(const DataType data) const
 bool Weatherstack::parseCurrentWeather(const std::string& json, Weather& weather) const
 {
 #ifdef __SIZEOF_INT128__
-  return SimdJsonWeatherstack::parseCurrentWeather(json, weather);
+  return SimdJsonOnDemandWeatherstack::parseCurrentWeather(json, weather);
 #else
   return NLohmannJsonWeatherstack::parseCurrentWeather(json, weather);
 #endif // __SIZEOF_INT128__
@@ -96,16 +97,23 @@ std::string Weatherstack::toRequestString(const Location& location)
   return std::string();
 }
 
+std::string Weatherstack::buildRequestUrl(const DataType data, const Location& location) const
+{
+  if (m_apiKey.empty() || (data != DataType::Current))
+    return std::string();
+  // Free plan only supports HTTP, higher plans allow HTTPS.
+  return ((m_plan == PlanWeatherstack::Free)
+         ? "http://api.weatherstack.com/current?access_key="
+         : "https://api.weatherstack.com/current?access_key=")
+         + m_apiKey + "&" + toRequestString(location);
+}
+
 bool Weatherstack::currentWeather(const Location& location, Weather& weather)
 {
   weather = Weather();
   if (m_apiKey.empty())
     return false;
-  // Free plan only supports HTTP, higher plans allow HTTPS.
-  const std::string url = ((m_plan == PlanWeatherstack::Free)
-          ? "http://api.weatherstack.com/current?access_key="
-          : "https://api.weatherstack.com/current?access_key=")
-                  + m_apiKey + "&" + toRequestString(location);
+  const std::string& url = requestUrl(DataType::Current, location);
   weather.setRequestTime(std::chrono::system_clock::now());
   const auto response = Request::get(url, "Weatherstack::currentWeather");
   if (!response.has_value())
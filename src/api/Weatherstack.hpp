@@ -136,6 +136,18 @@ class Weatherstack: public API
     bool parseForecast(const std::string& json, Forecast& forecast) const override;
     #endif // wic_no_json_parsing
   private:
+    #ifndef wic_no_network_requests
+    /** \brief Builds the URL of a request for a single location.
+     *
+     * \param data      the requested data type
+     * \param location  the location
+     * \return Returns the URL of the request. Returns an empty string, if the
+     *         data type cannot be requested with a single request.
+     */
+    std::string buildRequestUrl(const DataType data, const Location& location) const override;
+    #endif // wic_no_network_requests
+
+
     std::string m_apiKey; /**< the API key for requests */
     PlanWeatherstack m_plan; /**< the current pricing plan */
 }; // class
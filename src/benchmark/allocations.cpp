@@ -0,0 +1,113 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "allocations.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+/** \brief number of allocations via operator new since the program start */
+std::atomic<uint_least64_t> allocationCount(0);
+
+/** \brief Allocates memory and counts the allocation.
+ *
+ * \param size  size of the memory block in bytes
+ * \return Returns a pointer to the allocated memory.
+ *         Returns nullptr, if the allocation failed.
+ */
+void* countedAllocation(const std::size_t size) noexcept
+{
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size > 0 ? size : 1);
+}
+
+} // namespace
+
+namespace wic
+{
+
+uint_least64_t allocations()
+{
+  return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+// All forms of the global operator new and operator delete are replaced, so
+// that every allocation is counted and every deallocation matches it.
+
+void* operator new(std::size_t size)
+{
+  void* ptr = countedAllocation(size);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+  void* ptr = countedAllocation(size);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return countedAllocation(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return countedAllocation(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
@@ -0,0 +1,40 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_BENCHMARK_ALLOCATIONS_HPP
+#define WEATHER_INFORMATION_COLLECTOR_BENCHMARK_ALLOCATIONS_HPP
+
+#include <cstdint>
+
+namespace wic
+{
+
+/** \brief Gets the number of allocations since the program start.
+ *
+ * \return Returns the number of calls of the global operator new (including
+ *         its array and nothrow forms) so far.
+ * \remarks The replacements of operator new and operator delete that count
+ *          the allocations are in allocations.cpp.
+ */
+uint_least64_t allocations();
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_BENCHMARK_ALLOCATIONS_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector benchmark tool.
-    Copyright (C) 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -25,13 +25,18 @@
 #include <chrono>
 #include <cmath>
 #include <iostream>
+#include <string>
 #include <vector>
 #include "../api/Types.hpp"
 #include "../data/Forecast.hpp"
 #include "../data/Location.hpp"
 #include "../data/Weather.hpp"
 #include "../db/mariadb/SourceMariaDB.hpp"
+#ifdef __SIZEOF_INT128__
+#include "../json/SimdJsonParser.hpp"
+#endif
 #include "../ReturnCodes.hpp"
+#include "allocations.hpp"
 
 namespace wic
 {
@@ -119,8 +124,168 @@ void printForecast(const Forecast& f)
   } // for
 }
 
+#ifdef __SIZEOF_INT128__
+/** \brief Average cost of parsing a single document. */
+struct ParseCost
+{
+  double nanoseconds; /**< average time per document in nanoseconds */
+  double allocations; /**< average number of allocations per document */
+}; // struct
+
+/** \brief Measures the cost of parsing current weather data with simdjson.
+ *
+ * \param data       the weather data whose JSON shall be parsed
+ * \param newParser  whether every document gets a new parser, like in earlier
+ *                   versions, instead of the reused parser of the thread
+ * \return Returns the average cost per document.
+ */
+template<typename simdJsonT>
+ParseCost simdJsonParseCost(const std::vector<Weather>& data, const bool newParser)
+{
+  std::size_t documents = 0;
+  const auto allocationsStart = allocations();
+  const auto start = std::chrono::steady_clock::now();
+  for (const Weather& weather: data)
+  {
+    if (!weather.hasJson())
+      continue;
+    if (newParser)
+      SimdJsonParser::release();
+    Weather dummy;
+    simdJsonT::parseCurrentWeather(weather.json(), dummy);
+    ++documents;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto allocationsEnd = allocations();
+  if (documents == 0)
+    return ParseCost{ 0.0, 0.0 };
+  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+  return ParseCost{ static_cast<double>(duration.count()) / documents,
+                    static_cast<double>(allocationsEnd - allocationsStart) / documents };
+}
+#endif // __SIZEOF_INT128__
+
+/** \brief Parses the JSON of current weather data with the given parser and
+ * compares the results with the data from the database.
+ *
+ * \param data      the weather data whose JSON shall be parsed
+ * \param library   name of the JSON library, used in error messages
+ * \param duration  receives the time needed for parsing
+ * \return Returns zero, if all elements were parsed and matched the data from
+ *         the database. Returns a non-zero exit code otherwise.
+ */
+template<typename jsonT>
+int parseWeatherData(const std::vector<Weather>& data, const std::string& library, std::chrono::microseconds& duration)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (const Weather& weather: data)
+  {
+    if (!weather.hasJson())
+      continue;
+
+    Weather dummy;
+    if (!jsonT::parseCurrentWeather(weather.json(), dummy))
+    {
+      std::cerr << "Error: Could not parse JSON with " << library << "!" << std::endl
+                << "JSON is: '" << weather.json() << "'." << std::endl;
+      return 1;
+    }
+
+    // compare with value from database
+    // -- First set request time, because that one cannot be determined from
+    //    the raw JSON alone.
+    dummy.setRequestTime(weather.requestTime());
+    if (dummy != weather)
+    {
+      std::cerr << "Error: " << library << "-parsed element does not match the element from the database!" << std::endl;
+      std::cerr << "json() matches: " << (weather.json() == dummy.json() ? "yes" : "no") << std::endl;
+      std::cerr << "Element from database:\n";
+      printWeather(weather);
+      std::cerr << "Element from parser:\n";
+      printWeather(dummy);
+      std::cerr << "Status:\n";
+      printComponentMatchStatus(weather, dummy);
+      return 42;
+    }
+  } // for
+  const auto end = std::chrono::high_resolution_clock::now();
+  duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+  return 0;
+}
+
+/** \brief Parses the JSON of forecast data with the given parser and compares
+ * the results with the data from the database.
+ *
+ * \param data      the forecast data whose JSON shall be parsed
+ * \param library   name of the JSON library, used in error messages
+ * \param duration  receives the time needed for parsing
+ * \return Returns zero, if all elements were parsed and matched the data from
+ *         the database. Returns a non-zero exit code otherwise.
+ */
+template<typename jsonT>
+int parseForecastData(const std::vector<Forecast>& data, const std::string& library, std::chrono::microseconds& duration)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (const Forecast& forecast: data)
+  {
+    if (!forecast.hasJson())
+      continue;
+
+    Forecast dummy;
+    if (!jsonT::parseForecast(forecast.json(), dummy))
+    {
+      std::cerr << "Error: Could not parse JSON with " << library << "!" << std::endl
+                << "JSON is: '" << forecast.json() << "'." << std::endl;
+      return 1;
+    }
+
+    // compare with value from database
+    // -- First set request time, because that one cannot be determined from
+    //    the raw JSON alone.
+    dummy.setRequestTime(forecast.requestTime());
+    if (dummy != forecast)
+    {
+      std::cerr << "Error: " << library << "-parsed element does not match the element from the database!" << std::endl;
+      std::cerr << "json() matches: " << (forecast.json() == dummy.json() ? "yes" : "no") << std::endl;
+      std::cerr << "JSON is '" << forecast.json() << "'." << std::endl;
+      std::cerr << "Element from database:\n";
+      printForecast(forecast);
+      std::cerr << "Element from parser:\n";
+      printForecast(dummy);
+      return 42;
+    }
+  } // for
+  const auto end = std::chrono::high_resolution_clock::now();
+  duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+  return 0;
+}
+
+/** \brief Prints the time needed by each of the JSON parsers.
+ *
+ * \param elements  number of parsed elements
+ * \param dom       time needed by the DOM parser of simdjson
+ * \param onDemand  time needed by the On-Demand parser of simdjson
+ * \param nlohmann  time needed by nlohmann/json
+ */
+void printParseTimes(const std::size_t elements, const std::chrono::microseconds dom,
+                     const std::chrono::microseconds onDemand, const std::chrono::microseconds nlohmann)
+{
+  const auto domPerElement = static_cast<double>(dom.count()) / elements;
+  const auto onDemandPerElement = static_cast<double>(onDemand.count()) / elements;
+  const double onDemandPercentage = static_cast<double>(onDemand.count()) / dom.count() * 100.0;
+  const auto nlohmannPerElement = static_cast<double>(nlohmann.count()) / elements;
+  const double nlohmannPercentage = static_cast<double>(nlohmann.count()) / dom.count() * 100.0;
+  std::cout << "simdjson (DOM):       " << dom.count() << " microseconds (100 %)\n"
+            << "                      (ca. " << domPerElement << " microseconds per element)\n"
+            << "simdjson (On-Demand): " << onDemand.count() << " microseconds (" << onDemandPercentage << " %)\n"
+            << "                      (ca. " << onDemandPerElement << " microseconds per element)\n"
+            << "nlohmann/json:        " << nlohmann.count() << " microseconds (" << nlohmannPercentage << " %)\n"
+            << "                      (ca. " << nlohmannPerElement << " microseconds per element)\n"
+            << std::endl;
+}
+
 /* ********* Weather data ********* */
-template<typename simdJsonT, typename nlohmannJsonT>
+template<typename simdJsonT, typename onDemandT, typename nlohmannJsonT>
 int weatherDataBench(const ApiType api, SourceMariaDB& source)
 {
   // Find all locations with weather data.
@@ -164,86 +329,38 @@ int weatherDataBench(const ApiType api, SourceMariaDB& source)
       return rcDatabaseError;
     }
 
-    // Parse with simdjson.
-    const auto simdJsonStart = std::chrono::high_resolution_clock::now();
-    for (const Weather& weather: data)
-    {
-      if (!weather.hasJson())
-        continue;
-
-      Weather dummy;
-      if (!simdJsonT::parseCurrentWeather(weather.json(), dummy))
-      {
-        std::cerr << "Error: Could not parse JSON with simdjson!" << std::endl
-                  << "JSON is: '" << weather.json() << "'." << std::endl;
-        return 1;
-      }
-
-      // compare with value from database
-      // -- First set request time, because that one cannot be determined from
-      //    the raw JSON alone.
-      dummy.setRequestTime(weather.requestTime());
-      if (dummy != weather)
-      {
-        std::cerr << "Error: simdjson-parsed element does not match the element from the database!" << std::endl;
-        std::cerr << "json() matches: " << (weather.json() == dummy.json() ? "yes" : "no") << std::endl;
-        std::cerr << "Element from database:\n";
-        printWeather(weather);
-        std::cerr << "Element from parser:\n";
-        printWeather(dummy);
-        std::cerr << "Status:\n";
-        printComponentMatchStatus(weather, dummy);
-        return 42;
-      }
-    } // for
-    const auto simdJsonEnd = std::chrono::high_resolution_clock::now();
-
-    // Parse with nlohmann/json.
-    const auto nlohmannJsonStart = std::chrono::high_resolution_clock::now();
-    for (const Weather& weather: data)
-    {
-      if (!weather.hasJson())
-        continue;
-
-      Weather dummy;
-      if (!nlohmannJsonT::parseCurrentWeather(weather.json(), dummy))
-      {
-        std::cerr << "Error: Could not parse JSON with nlohmann/json!" << std::endl
-                  << "JSON is: '" << weather.json() << "'." << std::endl;
-        return 1;
-      }
-
-      // compare with value from database
-      // -- First set request time, because that one cannot be determined from
-      //    the raw JSON alone.
-      dummy.setRequestTime(weather.requestTime());
-      if (dummy != weather)
-      {
-        std::cerr << "Error: nlohmann/json-parsed element does not match the element from the database!" << std::endl;
-        std::cerr << "json() matches: " << (weather.json() == dummy.json() ? "yes" : "no") << std::endl;
-        std::cerr << "Element from database:\n";
-        printWeather(weather);
-        std::cerr << "Element from parser:\n";
-        printWeather(dummy);
-        std::cerr << "Status:\n";
-        printComponentMatchStatus(weather, dummy);
-        return 42;
-      }
-    } // for
-    const auto nlohmannJsonEnd = std::chrono::high_resolution_clock::now();
+    std::chrono::microseconds simdJsonTime;
+    int ret = parseWeatherData<simdJsonT>(data, "simdjson", simdJsonTime);
+    if (ret != 0)
+      return ret;
+    std::chrono::microseconds onDemandTime;
+    ret = parseWeatherData<onDemandT>(data, "simdjson On-Demand", onDemandTime);
+    if (ret != 0)
+      return ret;
+    std::chrono::microseconds nlohmannJsonTime;
+    ret = parseWeatherData<nlohmannJsonT>(data, "nlohmann/json", nlohmannJsonTime);
+    if (ret != 0)
+      return ret;
 
     std::cout << "Parsing " << data.size() << " elements for "
               << elem.first.toString() << " took:" << std::endl;
-    const auto simdJsonTime = std::chrono::duration_cast<std::chrono::microseconds>(simdJsonEnd - simdJsonStart);
-    const auto simdJsonPerElement = static_cast<double>(simdJsonTime.count()) / data.size();
-    const auto nlohmannJsonTime = std::chrono::duration_cast<std::chrono::microseconds>(nlohmannJsonEnd - nlohmannJsonStart);
-    const auto nlohmannJsonPerElement = static_cast<double>(nlohmannJsonTime.count()) / data.size();
-    const double percentage = static_cast<double>(nlohmannJsonTime.count()) / simdJsonTime.count() * 100.0;
-    std::cout << "simdjson:      " << simdJsonTime.count() << " microseconds (100 %)\n"
-              << "               (ca. " << simdJsonPerElement << " microseconds per element)\n"
-              << "nlohmann/json: " << nlohmannJsonTime.count() << " microseconds (" << percentage << " %)\n"
-              << "               (ca. " << nlohmannJsonPerElement << " microseconds per element)\n"
+    printParseTimes(data.size(), simdJsonTime, onDemandTime, nlohmannJsonTime);
+
+#ifdef __SIZEOF_INT128__
+    const ParseCost fresh = simdJsonParseCost<simdJsonT>(data, true);
+    const ParseCost reused = simdJsonParseCost<simdJsonT>(data, false);
+    const ParseCost freshOnDemand = simdJsonParseCost<onDemandT>(data, true);
+    const ParseCost reusedOnDemand = simdJsonParseCost<onDemandT>(data, false);
+    std::cout << "simdjson with a new parser per element: ca. " << fresh.nanoseconds
+              << " ns and " << fresh.allocations << " allocations per element\n"
+              << "simdjson with the reused parser:        ca. " << reused.nanoseconds
+              << " ns and " << reused.allocations << " allocations per element\n"
+              << "simdjson On-Demand with a new parser:   ca. " << freshOnDemand.nanoseconds
+              << " ns and " << freshOnDemand.allocations << " allocations per element\n"
+              << "simdjson On-Demand with reused parser:  ca. " << reusedOnDemand.nanoseconds
+              << " ns and " << reusedOnDemand.allocations << " allocations per element\n"
               << std::endl;
+#endif // __SIZEOF_INT128__
   } // for
 
   // Done, all went fine.
@@ -251,7 +368,7 @@ int weatherDataBench(const ApiType api, SourceMariaDB& source)
 } // end of scope for weather data benchmark
 
 /* ********* Forecast data ********* */
-template<typename simdJsonT, typename nlohmannJsonT>
+template<typename simdJsonT, typename onDemandT, typename nlohmannJsonT>
 int forecastBench(const ApiType api, SourceMariaDB& source)
 {
   // Find all locations with forecast data.
@@ -295,83 +412,22 @@ int forecastBench(const ApiType api, SourceMariaDB& source)
       return rcDatabaseError;
     }
 
-    // Parse with simdjson.
-    const auto simdJsonStart = std::chrono::high_resolution_clock::now();
-    for (const Forecast& forecast: data)
-    {
-      if (!forecast.hasJson())
-        continue;
-
-      Forecast dummy;
-      if (!simdJsonT::parseForecast(forecast.json(), dummy))
-      {
-        std::cerr << "Error: Could not parse JSON with simdjson!" << std::endl
-                  << "JSON is: '" << forecast.json() << "'." << std::endl;
-        return 1;
-      }
-
-      // compare with value from database
-      // -- First set request time, because that one cannot be determined from
-      //    the raw JSON alone.
-      dummy.setRequestTime(forecast.requestTime());
-      if (dummy != forecast)
-      {
-        std::cerr << "Error: simdjson-parsed element does not match the element from the database!" << std::endl;
-        std::cerr << "json() matches: " << (forecast.json() == dummy.json() ? "yes" : "no") << std::endl;
-        std::cerr << "JSON is '" << forecast.json() << "'." << std::endl;
-        std::cerr << "Element from database:\n";
-        printForecast(forecast);
-        std::cerr << "Element from parser:\n";
-        printForecast(dummy);
-        return 42;
-      }
-    } // for
-    const auto simdJsonEnd = std::chrono::high_resolution_clock::now();
-
-    // Parse with nlohmann/json.
-    const auto nlohmannJsonStart = std::chrono::high_resolution_clock::now();
-    for (const Forecast& forecast: data)
-    {
-      if (!forecast.hasJson())
-        continue;
-
-      Forecast dummy;
-      if (!nlohmannJsonT::parseForecast(forecast.json(), dummy))
-      {
-        std::cerr << "Error: Could not parse JSON with nlohmann/json!" << std::endl
-                  << "JSON is: '" << forecast.json() << "'." << std::endl;
-        return 1;
-      }
-
-      // compare with value from database
-      // -- First set request time, because that one cannot be determined from
-      //    the raw JSON alone.
-      dummy.setRequestTime(forecast.requestTime());
-      if (dummy != forecast)
-      {
-        std::cerr << "Error: nlohmann/json-parsed element does not match the element from the database!" << std::endl;
-        std::cerr << "json() matches: " << (forecast.json() == dummy.json() ? "yes" : "no") << std::endl;
-        std::cerr << "Element from database:\n";
-        printForecast(forecast);
-        std::cerr << "Element from parser:\n";
-        printForecast(dummy);
-        return 42;
-      }
-    } // for
-    const auto nlohmannJsonEnd = std::chrono::high_resolution_clock::now();
+    std::chrono::microseconds simdJsonTime;
+    int ret = parseForecastData<simdJsonT>(data, "simdjson", simdJsonTime);
+    if (ret != 0)
+      return ret;
+    std::chrono::microseconds onDemandTime;
+    ret = parseForecastData<onDemandT>(data, "simdjson On-Demand", onDemandTime);
+    if (ret != 0)
+      return ret;
+    std::chrono::microseconds nlohmannJsonTime;
+    ret = parseForecastData<nlohmannJsonT>(data, "nlohmann/json", nlohmannJsonTime);
+    if (ret != 0)
+      return ret;
 
     std::cout << "Parsing " << data.size() << " elements for "
               << elem.first.toString() << " took:" << std::endl;
-    const auto simdJsonTime = std::chrono::duration_cast<std::chrono::microseconds>(simdJsonEnd - simdJsonStart);
-    const auto simdJsonPerElement = static_cast<double>(simdJsonTime.count()) / data.size();
-    const auto nlohmannJsonTime = std::chrono::duration_cast<std::chrono::microseconds>(nlohmannJsonEnd - nlohmannJsonStart);
-    const auto nlohmannJsonPerElement = static_cast<double>(nlohmannJsonTime.count()) / data.size();
-    const double percentage = static_cast<double>(nlohmannJsonTime.count()) / simdJsonTime.count() * 100.0;
-    std::cout << "simdjson:      " << simdJsonTime.count() << " microseconds (100 %)\n"
-              << "               (ca. " << simdJsonPerElement << " microseconds per element)\n"
-              << "nlohmann/json: " << nlohmannJsonTime.count() << " microseconds (" << percentage << " %)\n"
-              << "               (ca. " << nlohmannJsonPerElement << " microseconds per element)\n"
-              << std::endl;
+    printParseTimes(data.size(), simdJsonTime, onDemandTime, nlohmannJsonTime);
   } // for
 
   // Done, no errors.
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector benchmark tool.
-    Copyright (C) 2019, 2020, 2021, 2022, 2024  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2022, 2024, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,10 @@
 
 #include <iostream>
 #include "benchmark.hpp"
+#include "openmeteo.hpp"
+#include "overhead.hpp"
+#include "requests.hpp"
+#include "scheduler.hpp"
 #include "../conf/Configuration.hpp"
 #include "../db/ConnectionInformation.hpp"
 #include "../db/mariadb/client_version.hpp"
@@ -33,6 +37,12 @@
 #ifdef __SIZEOF_INT128__
 #include "../json/SimdJsonApixu.hpp"
 #include "../json/SimdJsonDarkSky.hpp"
+#include "../json/SimdJsonOnDemandApixu.hpp"
+#include "../json/SimdJsonOnDemandDarkSky.hpp"
+#include "../json/SimdJsonOnDemandOpenMeteo.hpp"
+#include "../json/SimdJsonOnDemandOwm.hpp"
+#include "../json/SimdJsonOnDemandWeatherbit.hpp"
+#include "../json/SimdJsonOnDemandWeatherstack.hpp"
 #include "../json/SimdJsonOpenMeteo.hpp"
 #include "../json/SimdJsonOwm.hpp"
 #include "../json/SimdJsonWeatherbit.hpp"
@@ -54,13 +64,32 @@ void showHelp()
             << "  -c FILE | --conf FILE  - Sets the file name of the configuration file to use\n"
             << "                           during the program run. If this option is omitted,\n"
             << "                           then the program will search for the configuration\n"
-            << "                           in some predefined locations.\n";
+            << "                           in some predefined locations.\n"
+            << "  --scheduler            - Runs a micro-benchmark of the collector's task\n"
+            << "                           scheduler instead of the JSON benchmarks. This\n"
+            << "                           needs neither a configuration nor a database.\n"
+            << "  --task-overhead        - Runs a micro-benchmark of the collector's overhead\n"
+            << "                           per task execution (API instance and request URL)\n"
+            << "                           instead of the JSON benchmarks. This needs neither\n"
+            << "                           a configuration nor a database.\n"
+            << "  --requests URL         - Measures the latency of HTTP requests to URL with\n"
+            << "                           and without reused connections instead of the JSON\n"
+            << "                           benchmarks. This needs neither a configuration nor\n"
+            << "                           a database.\n"
+            << "  --open-meteo           - Runs a benchmark of the conversion of hourly\n"
+            << "                           Open-Meteo data over a generated corpus of 16-day\n"
+            << "                           forecasts instead of the JSON benchmarks. This\n"
+            << "                           needs neither a configuration nor a database.\n";
 }
 
 int main(int argc, char** argv)
 {
   using namespace wic;
   std::string configurationFile; /**< path of configuration file */
+  bool schedulerOnly = false; /**< whether to run the scheduler benchmark only */
+  bool overheadOnly = false; /**< whether to run the task overhead benchmark only */
+  bool openMeteoOnly = false; /**< whether to run the Open-Meteo benchmark only */
+  std::string requestUrl; /**< URL for the request benchmark */
 
   if ((argc > 1) && (argv != nullptr))
   {
@@ -105,6 +134,55 @@ int main(int argc, char** argv)
           return rcInvalidParameter;
         }
       } // if configuration file
+      else if (param == "--scheduler")
+      {
+        if (schedulerOnly)
+        {
+          std::cerr << "Error: Parameter " << param << " was already specified!\n";
+          return rcInvalidParameter;
+        }
+        schedulerOnly = true;
+      } // if scheduler benchmark
+      else if (param == "--task-overhead")
+      {
+        if (overheadOnly)
+        {
+          std::cerr << "Error: Parameter " << param << " was already specified!\n";
+          return rcInvalidParameter;
+        }
+        overheadOnly = true;
+      } // if task overhead benchmark
+      else if (param == "--open-meteo")
+      {
+        if (openMeteoOnly)
+        {
+          std::cerr << "Error: Parameter " << param << " was already specified!\n";
+          return rcInvalidParameter;
+        }
+        openMeteoOnly = true;
+      } // if Open-Meteo benchmark
+      else if (param == "--requests")
+      {
+        if (!requestUrl.empty())
+        {
+          std::cerr << "Error: URL for requests was already set to "
+                    << requestUrl << "!\n";
+          return rcInvalidParameter;
+        }
+        // enough parameters?
+        if ((i+1 < argc) && (argv[i+1] != nullptr))
+        {
+          requestUrl = std::string(argv[i+1]);
+          // Skip next parameter, because it's already used as URL.
+          ++i;
+        }
+        else
+        {
+          std::cerr << "Error: You have to enter an URL after \""
+                    << param << "\".\n";
+          return rcInvalidParameter;
+        }
+      } // if request benchmark
       else
       {
         std::cerr << "Error: Unknown parameter " << param << "!\n"
@@ -114,6 +192,23 @@ int main(int argc, char** argv)
     } // for i
   } // if arguments are there
 
+  if (schedulerOnly || overheadOnly || openMeteoOnly || !requestUrl.empty())
+  {
+    if (schedulerOnly)
+      schedulerBench();
+    if (overheadOnly)
+      taskOverheadBench();
+    if (openMeteoOnly)
+    {
+      const int ret = openMeteoBench();
+      if (ret != 0)
+        return ret;
+    }
+    if (!requestUrl.empty())
+      return requestBench(requestUrl);
+    return 0;
+  }
+
   // load configuration file + configured tasks
   Configuration config;
   if (!config.load(configurationFile, true, true))
@@ -128,37 +223,37 @@ int main(int argc, char** argv)
   /* ********* Weather data ********* */
   // OpenWeatherMap
   {
-    int ret = weatherDataBench<SimdJsonOwm, NLohmannJsonOwm>(ApiType::OpenWeatherMap, source);
+    int ret = weatherDataBench<SimdJsonOwm, SimdJsonOnDemandOwm, NLohmannJsonOwm>(ApiType::OpenWeatherMap, source);
     if (ret != 0)
       return ret;
   }
   // DarkSky
   {
-    int ret = weatherDataBench<SimdJsonDarkSky, NLohmannJsonDarkSky>(ApiType::DarkSky, source);
+    int ret = weatherDataBench<SimdJsonDarkSky, SimdJsonOnDemandDarkSky, NLohmannJsonDarkSky>(ApiType::DarkSky, source);
     if (ret != 0)
       return ret;
   }
   // Apixu
   {
-    int ret = weatherDataBench<SimdJsonApixu, NLohmannJsonApixu>(ApiType::Apixu, source);
+    int ret = weatherDataBench<SimdJsonApixu, SimdJsonOnDemandApixu, NLohmannJsonApixu>(ApiType::Apixu, source);
     if (ret != 0)
       return ret;
   }
   // Weatherbit
   {
-    int ret = weatherDataBench<SimdJsonWeatherbit, NLohmannJsonWeatherbit>(ApiType::Weatherbit, source);
+    int ret = weatherDataBench<SimdJsonWeatherbit, SimdJsonOnDemandWeatherbit, NLohmannJsonWeatherbit>(ApiType::Weatherbit, source);
     if (ret != 0)
       return ret;
   }
   // Weatherstack
   {
-    int ret = weatherDataBench<SimdJsonWeatherstack, NLohmannJsonWeatherstack>(ApiType::Weatherstack, source);
+    int ret = weatherDataBench<SimdJsonWeatherstack, SimdJsonOnDemandWeatherstack, NLohmannJsonWeatherstack>(ApiType::Weatherstack, source);
     if (ret != 0)
       return ret;
   }
   // Open-Meteo
   {
-    int ret = weatherDataBench<SimdJsonOpenMeteo, NLohmannJsonOpenMeteo>(ApiType::OpenMeteo, source);
+    int ret = weatherDataBench<SimdJsonOpenMeteo, SimdJsonOnDemandOpenMeteo, NLohmannJsonOpenMeteo>(ApiType::OpenMeteo, source);
     if (ret != 0)
       return ret;
   }
@@ -166,31 +261,31 @@ int main(int argc, char** argv)
   /* ********* Forecast data ********* */
   // OpenWeatherMap
   {
-    int ret = forecastBench<SimdJsonOwm, NLohmannJsonOwm>(ApiType::OpenWeatherMap, source);
+    int ret = forecastBench<SimdJsonOwm, SimdJsonOnDemandOwm, NLohmannJsonOwm>(ApiType::OpenWeatherMap, source);
     if (ret != 0)
       return ret;
   }
   // DarkSky
   {
-    int ret = forecastBench<SimdJsonDarkSky, NLohmannJsonDarkSky>(ApiType::DarkSky, source);
+    int ret = forecastBench<SimdJsonDarkSky, SimdJsonOnDemandDarkSky, NLohmannJsonDarkSky>(ApiType::DarkSky, source);
     if (ret != 0)
       return ret;
   }
   // Apixu
   {
-    int ret = forecastBench<SimdJsonApixu, NLohmannJsonApixu>(ApiType::Apixu, source);
+    int ret = forecastBench<SimdJsonApixu, SimdJsonOnDemandApixu, NLohmannJsonApixu>(ApiType::Apixu, source);
     if (ret != 0)
       return ret;
   }
   // Weatherbit
   {
-    int ret = forecastBench<SimdJsonWeatherbit, NLohmannJsonWeatherbit>(ApiType::Weatherbit, source);
+    int ret = forecastBench<SimdJsonWeatherbit, SimdJsonOnDemandWeatherbit, NLohmannJsonWeatherbit>(ApiType::Weatherbit, source);
     if (ret != 0)
       return ret;
   }
   // Open-Meteo
   {
-    int ret = forecastBench<SimdJsonOpenMeteo, NLohmannJsonOpenMeteo>(ApiType::OpenMeteo, source);
+    int ret = forecastBench<SimdJsonOpenMeteo, SimdJsonOnDemandOpenMeteo, NLohmannJsonOpenMeteo>(ApiType::OpenMeteo, source);
     if (ret != 0)
       return ret;
   }
@@ -0,0 +1,252 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_BENCHMARK_OPENMETEO_HPP
+#define WEATHER_INFORMATION_COLLECTOR_BENCHMARK_OPENMETEO_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../json/NLohmannJsonOpenMeteo.hpp"
+#include "../json/OpenMeteoFunctions.hpp"
+#ifdef __SIZEOF_INT128__
+#include "../json/SimdJsonOnDemandOpenMeteo.hpp"
+#include "../json/SimdJsonOpenMeteo.hpp"
+#endif
+#include "../util/NumericPrecision.hpp"
+
+namespace wic
+{
+
+/** \brief Creates the hourly data of a 16-day forecast of Open-Meteo.
+ *
+ * \param seed  number that varies the generated values
+ * \return Returns the columns of the hourly data, 384 hours in total.
+ */
+OpenMeteoHourlyColumns openMeteoForecastColumns(const std::size_t seed)
+{
+  const std::size_t hours = 16 * 24;
+  OpenMeteoHourlyColumns columns;
+  for (std::size_t h = 0; h < hours; ++h)
+  {
+    const std::size_t v = h * 7 + seed * 13;
+    // Values have the same number of decimals as in real responses.
+    columns.temperature.push_back(-10.0 + static_cast<double>(v % 400) / 10.0);
+    columns.humidity.push_back(static_cast<int64_t>(20 + v % 81));
+    columns.rain.push_back(static_cast<double>(v % 7 == 0 ? v % 50 : 0) / 10.0);
+    columns.snowfall.push_back(static_cast<double>(v % 11 == 0 ? v % 30 : 0) / 100.0);
+    columns.pressure.push_back(980.0 + static_cast<double>(v % 600) / 10.0);
+    columns.cloudCover.push_back(static_cast<int64_t>(v % 101));
+    columns.windSpeed.push_back(static_cast<double>(v % 250) / 10.0);
+    columns.windDirection.push_back(static_cast<int64_t>(v % 360));
+  }
+  return columns;
+}
+
+/** \brief Creates the JSON of a forecast response of Open-Meteo.
+ *
+ * \param columns  the hourly data of the forecast
+ * \return Returns a string containing the JSON.
+ */
+std::string openMeteoForecastJson(const OpenMeteoHourlyColumns& columns)
+{
+  std::ostringstream json;
+  json << "{\"latitude\":52.52,\"longitude\":13.419998,\"generationtime_ms\":1.196,"
+       << "\"utc_offset_seconds\":0,\"timezone\":\"GMT\",\"timezone_abbreviation\":\"GMT\","
+       << "\"elevation\":38,\"hourly_units\":{\"time\":\"iso8601\",\"temperature_2m\":\"°C\","
+       << "\"relativehumidity_2m\":\"%\",\"rain\":\"mm\",\"showers\":\"mm\",\"snowfall\":\"cm\","
+       << "\"pressure_msl\":\"hPa\",\"surface_pressure\":\"hPa\",\"cloudcover\":\"%\","
+       << "\"windspeed_10m\":\"m/s\",\"winddirection_10m\":\"°\"},\"hourly\":{\"time\":[";
+  const std::size_t hours = columns.temperature.size();
+  for (std::size_t h = 0; h < hours; ++h)
+  {
+    json << (h == 0 ? "" : ",") << "\"2025-01-" << std::setw(2) << std::setfill('0')
+         << 1 + h / 24 << "T" << std::setw(2) << h % 24 << ":00\"";
+  }
+  json << std::fixed;
+  const auto writeArray = [&json](const char* name, const auto& values, const int decimals)
+  {
+    json << "],\"" << name << "\":[" << std::setprecision(decimals);
+    for (std::size_t h = 0; h < values.size(); ++h)
+    {
+      json << (h == 0 ? "" : ",") << values[h];
+    }
+  };
+  writeArray("temperature_2m", columns.temperature, 1);
+  writeArray("relativehumidity_2m", columns.humidity, 0);
+  writeArray("rain", columns.rain, 1);
+  writeArray("snowfall", columns.snowfall, 2);
+  writeArray("pressure_msl", columns.pressure, 1);
+  writeArray("cloudcover", columns.cloudCover, 0);
+  writeArray("windspeed_10m", columns.windSpeed, 1);
+  writeArray("winddirection_10m", columns.windDirection, 0);
+  json << "]}}";
+  return json.str();
+}
+
+/** \brief Stores the hourly data in the weather data element by element, like
+ *         the Open-Meteo parsers did before the column kernels were added.
+ *
+ * \param columns  hourly data, each column must have as many elements as data
+ * \param data     weather data of the forecast, one element per hour
+ */
+void setHourlyDataPerElement(const OpenMeteoHourlyColumns& columns, std::vector<Weather>& data)
+{
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+  {
+    const double celsius = columns.temperature[idx];
+    data[idx].setTemperatureCelsius(celsius);
+    data[idx].setTemperatureFahrenheit(celsius * 1.8 + 32.0);
+    const float fahrenheitRounded = NumericPrecision<float>::enforce(data[idx].temperatureFahrenheit());
+    if (fahrenheitRounded != data[idx].temperatureFahrenheit())
+    {
+      data[idx].setTemperatureFahrenheit(fahrenheitRounded);
+    }
+    data[idx].setTemperatureKelvin(celsius + 273.15);
+    const float kelvinRounded = NumericPrecision<float>::enforce(data[idx].temperatureKelvin());
+    if (kelvinRounded != data[idx].temperatureKelvin())
+    {
+      data[idx].setTemperatureKelvin(kelvinRounded);
+    }
+  }
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setHumidity(columns.humidity[idx]);
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setRain(columns.rain[idx]);
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setSnow(columns.snowfall[idx] / 0.7);
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setPressure(columns.pressure[idx]);
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setCloudiness(columns.cloudCover[idx]);
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setWindSpeed(columns.windSpeed[idx]);
+  for (std::size_t idx = 0; idx < data.size(); ++idx)
+    data[idx].setWindDegrees(columns.windDirection[idx]);
+}
+
+/** \brief Measures the average time to parse a forecast of the corpus.
+ *
+ * \param corpus  JSON of the forecasts
+ * \param rounds  number of times that each forecast is parsed
+ * \return Returns the average time per forecast in microseconds.
+ */
+template<typename jsonT>
+double openMeteoParseTime(const std::vector<std::string>& corpus, const std::size_t rounds)
+{
+  std::size_t elements = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    for (const std::string& json : corpus)
+    {
+      Forecast forecast;
+      if (!jsonT::parseForecast(json, forecast))
+      {
+        std::cerr << "Error: Could not parse forecast of the corpus!\n";
+        return -1.0;
+      }
+      elements += forecast.data().size();
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  if (elements == 0)
+    std::cout << "No forecast data was parsed.\n";
+  return std::chrono::duration<double, std::micro>(end - start).count() / (rounds * corpus.size());
+}
+
+/** \brief Runs the benchmark of the conversion of hourly Open-Meteo data over
+ *         a corpus of 16-day forecasts.
+ *
+ * \return Returns zero, if the benchmark was successful.
+ *         Returns a non-zero value, if an error occurred.
+ */
+int openMeteoBench()
+{
+  const std::size_t documents = 100;
+  std::vector<OpenMeteoHourlyColumns> columns;
+  std::vector<std::string> corpus;
+  for (std::size_t i = 0; i < documents; ++i)
+  {
+    columns.push_back(openMeteoForecastColumns(i));
+    corpus.push_back(openMeteoForecastJson(columns.back()));
+  }
+  const std::size_t hours = columns[0].temperature.size();
+  std::cout << "Open-Meteo forecasts: " << documents << " documents with "
+            << hours << " hours (16 days) each\n";
+
+  // conversion of the hourly data only
+  const std::size_t rounds = 200;
+  std::vector<Weather> perElement;
+  perElement.resize(hours);
+  std::vector<Weather> kernels;
+  kernels.resize(hours);
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    for (const auto& c : columns)
+      setHourlyDataPerElement(c, perElement);
+  }
+  auto end = std::chrono::steady_clock::now();
+  const double perElementTime = std::chrono::duration<double, std::micro>(end - start).count() / (rounds * documents);
+  start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    for (const auto& c : columns)
+      setHourlyData(c, kernels);
+  }
+  end = std::chrono::steady_clock::now();
+  const double kernelTime = std::chrono::duration<double, std::micro>(end - start).count() / (rounds * documents);
+  if (perElement != kernels)
+  {
+    std::cerr << "Error: Conversion with column kernels yields different data!\n";
+    return 1;
+  }
+  std::cout << "Conversion per Weather element: " << perElementTime << " µs per forecast\n"
+            << "Conversion with column kernels: " << kernelTime << " µs per forecast\n";
+
+  // whole forecast, including the JSON parsing
+  const std::size_t parseRounds = 20;
+  #ifdef __SIZEOF_INT128__
+  const double dom = openMeteoParseTime<SimdJsonOpenMeteo>(corpus, parseRounds);
+  const double onDemand = openMeteoParseTime<SimdJsonOnDemandOpenMeteo>(corpus, parseRounds);
+  #endif
+  const double nlohmann = openMeteoParseTime<NLohmannJsonOpenMeteo>(corpus, parseRounds);
+  #ifdef __SIZEOF_INT128__
+  if (dom < 0.0 || onDemand < 0.0 || nlohmann < 0.0)
+    return 1;
+  std::cout << "Parsing with simdjson (DOM):       " << dom << " µs per forecast\n"
+            << "Parsing with simdjson (On-Demand): " << onDemand << " µs per forecast\n";
+  #else
+  if (nlohmann < 0.0)
+    return 1;
+  #endif
+  std::cout << "Parsing with nlohmann/json:        " << nlohmann << " µs per forecast\n"
+            << std::endl;
+  return 0;
+}
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_BENCHMARK_OPENMETEO_HPP
@@ -0,0 +1,131 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_BENCHMARK_OVERHEAD_HPP
+#define WEATHER_INFORMATION_COLLECTOR_BENCHMARK_OVERHEAD_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../api/Factory.hpp"
+#include "../api/OpenMeteo.hpp"
+
+namespace wic
+{
+
+/** \brief Measures the average per-task overhead before the request, when the
+ *         API instance and the URL are created again for every request, like
+ *         earlier versions of the collector did.
+ *
+ * \param locations  the locations of the tasks
+ * \param rounds     number of times that each task is executed
+ * \return Returns the average time per task execution in nanoseconds.
+ */
+double recreatedApiStep(const std::vector<Location>& locations, const std::size_t rounds)
+{
+  const std::map<ApiType, std::string> keys = { { ApiType::OpenMeteo, "" } };
+  std::size_t length = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    for (const Location& location : locations)
+    {
+      const auto iter = keys.find(ApiType::OpenMeteo);
+      const std::string key = (iter != keys.end()) ? iter->second : std::string();
+      std::unique_ptr<API> api = Factory::create(ApiType::OpenMeteo, PlanWeatherbit::none, PlanWeatherstack::none, key);
+      const std::string url = "https://api.open-meteo.com/v1/forecast?"
+                            + OpenMeteo::toRequestString(location) + "&current_weather=true&windspeed_unit=ms&timezone=auto";
+      length += url.size() + (api != nullptr ? 1 : 0);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  // Use the length, so that the compiler cannot optimize the loop away.
+  if (length == 0)
+    std::cout << "No URLs were built.\n";
+  return std::chrono::duration<double, std::nano>(end - start).count() / (rounds * locations.size());
+}
+
+/** \brief Measures the average per-task overhead before the request, when
+ *         each task keeps its API instance and the URL of its request.
+ *
+ * \param locations  the locations of the tasks
+ * \param rounds     number of times that each task is executed
+ * \return Returns the average time per task execution in nanoseconds.
+ */
+double persistentApiStep(const std::vector<Location>& locations, const std::size_t rounds)
+{
+  std::vector<std::unique_ptr<API> > apis;
+  for (std::size_t i = 0; i < locations.size(); ++i)
+  {
+    apis.push_back(Factory::create(ApiType::OpenMeteo, PlanWeatherbit::none, PlanWeatherstack::none));
+  }
+  std::size_t length = 0;
+  std::string url;
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    for (std::size_t i = 0; i < locations.size(); ++i)
+    {
+      apis[i]->singleRequestUrl(DataType::Current, locations[i], url);
+      length += url.size();
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  if (length == 0)
+    std::cout << "No URLs were built.\n";
+  return std::chrono::duration<double, std::nano>(end - start).count() / (rounds * locations.size());
+}
+
+/** \brief Runs the benchmark of the per-task overhead for 1k and 10k tasks.
+ *
+ * \return Returns zero.
+ */
+int taskOverheadBench()
+{
+  std::cout << "Overhead per task execution (API instance + request URL):\n";
+  for (const std::size_t count : { 1000, 10000 })
+  {
+    std::vector<Location> locations;
+    locations.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      Location location;
+      location.setCoordinates(-60.0 + static_cast<double>(i % 1200) * 0.1,
+                              -170.0 + static_cast<double>(i / 1200) * 0.5);
+      locations.push_back(location);
+    }
+
+    const std::size_t rounds = 1000000 / count;
+    const double recreated = recreatedApiStep(locations, rounds);
+    const double persistent = persistentApiStep(locations, rounds);
+    std::cout << count << " tasks: new API per request " << recreated
+              << " ns, API per task " << persistent << " ns\n";
+  } // for
+  std::cout << std::endl;
+  return 0;
+}
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_BENCHMARK_OVERHEAD_HPP
@@ -0,0 +1,91 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_BENCHMARK_REQUESTS_HPP
+#define WEATHER_INFORMATION_COLLECTOR_BENCHMARK_REQUESTS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "../net/Curly.hpp"
+#include "../ReturnCodes.hpp"
+
+namespace wic
+{
+
+/** \brief Measures the average latency of HTTP GET requests to an URL.
+ *
+ * \param url     the URL to request
+ * \param reuse   whether the requests reuse connections
+ * \param count   number of requests
+ * \param millis  will be set to the average latency in milliseconds
+ * \return Returns true, if all requests were successful.
+ */
+bool requestLatency(const std::string& url, const bool reuse, const std::size_t count, double& millis)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Curly curly;
+    curly.setURL(url);
+    curly.reuseConnections(reuse);
+    std::string response;
+    if (!curly.perform(response))
+    {
+      std::cerr << "Error: Request to " << url << " failed!\n";
+      return false;
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  millis = std::chrono::duration<double, std::milli>(end - start).count() / count;
+  return true;
+}
+
+/** \brief Runs the benchmark of request latency with and without reused
+ *         connections.
+ *
+ * \param url  the URL to request
+ * \return Returns zero, if the benchmark was successful.
+ *         Returns a non-zero exit code, if an error occurred.
+ */
+int requestBench(const std::string& url)
+{
+  if (!Curly::globalInit())
+  {
+    std::cerr << "Error: Could not initialize cURL library!\n";
+    return rcInputOutputError;
+  }
+  const std::size_t count = 100;
+  std::cout << "Average latency of " << count << " requests to " << url << ":\n";
+  double fresh = 0.0;
+  if (!requestLatency(url, false, count, fresh))
+    return rcInputOutputError;
+  double reused = 0.0;
+  if (!requestLatency(url, true, count, reused))
+    return rcInputOutputError;
+  std::cout << "new connection per request: " << fresh << " ms\n"
+            << "reused connection: " << reused << " ms\n" << std::endl;
+  return 0;
+}
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_BENCHMARK_REQUESTS_HPP
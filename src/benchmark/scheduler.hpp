@@ -0,0 +1,126 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_BENCHMARK_SCHEDULER_HPP
+#define WEATHER_INFORMATION_COLLECTOR_BENCHMARK_SCHEDULER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../collector/Scheduler.hpp"
+
+namespace wic
+{
+
+/** \brief Measures the average cost of one scheduling step (find the next task
+ *         and move it to its next due time) with the linear scan that was used
+ *         by earlier versions of the collector.
+ *
+ * \param due        initial due times of the tasks
+ * \param intervals  request intervals of the tasks
+ * \param steps      number of scheduling steps to perform
+ * \return Returns the average time per step in nanoseconds.
+ */
+double linearScanStep(std::vector<std::chrono::steady_clock::time_point> due,
+                      const std::vector<std::chrono::seconds>& intervals,
+                      const std::size_t steps)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t step = 0; step < steps; ++step)
+  {
+    std::size_t minIndex = 0;
+    for (std::size_t i = 1; i < due.size(); ++i)
+    {
+      if (due[i] < due[minIndex])
+        minIndex = i;
+    }
+    due[minIndex] += intervals[minIndex];
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / steps;
+}
+
+/** \brief Measures the average cost of one scheduling step with the heap-based
+ *         scheduler of the collector.
+ *
+ * \param due        initial due times of the tasks
+ * \param intervals  request intervals of the tasks
+ * \param steps      number of scheduling steps to perform
+ * \return Returns the average time per step in nanoseconds.
+ */
+double heapStep(const std::vector<std::chrono::steady_clock::time_point>& due,
+                const std::vector<std::chrono::seconds>& intervals,
+                const std::size_t steps)
+{
+  Scheduler scheduler;
+  for (std::size_t i = 0; i < due.size(); ++i)
+  {
+    scheduler.schedule(i, due[i]);
+  }
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t step = 0; step < steps; ++step)
+  {
+    const Scheduler::Entry& next = scheduler.next();
+    scheduler.rescheduleNext(next.due + intervals[next.index]);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / steps;
+}
+
+/** \brief Runs the scheduler benchmark for 1k, 10k and 100k tasks.
+ *
+ * \return Returns zero.
+ */
+int schedulerBench()
+{
+  std::cout << "Scheduling cost per task (find next task + reschedule it):\n";
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> intervalDistribution(15, 3600);
+  const auto now = std::chrono::steady_clock::now();
+  for (const std::size_t count : { 1000, 10000, 100000 })
+  {
+    std::vector<std::chrono::steady_clock::time_point> due;
+    std::vector<std::chrono::seconds> intervals;
+    due.reserve(count);
+    intervals.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      intervals.emplace_back(intervalDistribution(generator));
+      due.push_back(now + std::chrono::seconds(intervalDistribution(generator)));
+    }
+
+    // The linear scan gets fewer steps, because it gets really slow for
+    // large numbers of tasks.
+    const std::size_t linearSteps = std::max<std::size_t>(100, 100000000 / count);
+    const double linear = linearScanStep(due, intervals, linearSteps);
+    const double heap = heapStep(due, intervals, 1000000);
+    std::cout << count << " tasks: linear scan " << linear << " ns, heap "
+              << heap << " ns\n";
+  } // for
+  std::cout << std::endl;
+  return 0;
+}
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_BENCHMARK_SCHEDULER_HPP
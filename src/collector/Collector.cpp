@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022, 2023  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,34 +19,105 @@
 */
 
 #include "Collector.hpp"
+#include <algorithm>
 #include <iostream>
 #include <memory>
-#include <thread>
+#include <set>
+#include <utility>
 #include "../api/Factory.hpp"
+#include "../api/OpenMeteo.hpp"
 #include "../data/Weather.hpp"
-#include "../db/mariadb/StoreMariaDB.hpp"
+#include "../net/Request.hpp"
+#include "../tasks/Phases.hpp"
+#include "../tasks/TaskManager.hpp"
+#include "DatabaseWriter.hpp"
+#include "Spool.hpp"
+#include "WorkerPool.hpp"
 
 namespace wic
 {
 
-TaskData::TaskData(const Task& t, const std::chrono::steady_clock::time_point& tp)
+namespace
+{
+
+/** \brief requests that take at least that long are shown with their timing */
+const std::chrono::seconds slowRequest(5);
+
+/** \brief Converts a duration to whole milliseconds.
+ *
+ * \param duration  the duration
+ * \return Returns the number of milliseconds.
+ */
+std::chrono::milliseconds::rep millis(const std::chrono::microseconds& duration)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+
+/** \brief Gets a human-readable form of the timing of a request.
+ *
+ * \param timing  the timing
+ * \return Returns a string that contains the durations of all phases.
+ */
+std::string describe(const RequestTiming& timing)
+{
+  return "DNS " + std::to_string(millis(timing.nameLookup))
+      + " ms, connect " + std::to_string(millis(timing.connect))
+      + " ms, TLS " + std::to_string(millis(timing.tls))
+      + " ms, first byte " + std::to_string(millis(timing.firstByte))
+      + " ms, total " + std::to_string(millis(timing.total)) + " ms";
+}
+
+} // namespace
+
+TaskData::TaskData(const Task& t, const std::chrono::steady_clock::time_point& tp,
+                   std::unique_ptr<API> a)
 : task(t),
-  nextRequest(tp)
+  nextRequest(tp),
+  api(std::move(a)),
+  validators(RequestEngine::Validators()),
+  retries(0)
 {
 }
 
 
 Collector::Collector()
 : tasksContainer(std::vector<TaskData>()),
+  scheduler(Scheduler()),
   apiKeys(std::map<ApiType, std::string>()),
   connInfo(ConnectionInformation("", "", "", "", 0)),
+  planOwm(PlanOwm::none),
   planWb(PlanWeatherbit::none),
   planWs(PlanWeatherstack::none),
-  stopFlag(false)
+  rateLimiter(nullptr),
+  retryPolicy(nullptr),
+  retries(Scheduler()),
+  workerThreads(Configuration::defaultCollectorThreads),
+  batchSize(Configuration::defaultCollectorBatchSize),
+  batchWindow(std::chrono::seconds(Configuration::defaultCollectorBatchWindow)),
+  batchLimits(std::vector<std::size_t>()),
+  connectionsPerHost(Configuration::defaultCollectorConnectionsPerHost),
+  http2(true),
+  openMeteoUnixTime(false),
+  prewarmTime(std::chrono::milliseconds(Configuration::defaultCollectorPrewarmTime)),
+  timeouts(Timeouts{ std::chrono::seconds(Configuration::defaultCollectorConnectTimeout),
+                     std::chrono::seconds(Configuration::defaultCollectorRequestTimeout),
+                     std::chrono::seconds(Configuration::defaultCollectorStallTimeout) }),
+  timings(std::map<ApiType, TimingTotals>()),
+  flushInterval(std::chrono::seconds(Configuration::defaultStorageFlushInterval)),
+  flushSize(Configuration::defaultStorageFlushSize),
+  queueSize(Configuration::defaultStorageQueueSize),
+  spoolFile(std::string()),
+  storage(nullptr),
+  stopFlag(false),
+  stopMutex(),
+  stopSignal(),
+  busyMutex(),
+  busy(std::vector<bool>()),
+  inFlight(0)
 {
 }
 
-bool Collector::fromConfiguration(const Configuration& conf)
+bool Collector::fromConfiguration(const Configuration& conf, const bool enforceLimits)
 {
   // API keys
   apiKeys[ApiType::none] = "";
@@ -58,26 +129,51 @@ bool Collector::fromConfiguration(const Configuration& conf)
   // Open-Meteo has no key, but let's keep it consistent and simplify key access
   // by using the empty value from the configuration.
   apiKeys[ApiType::OpenMeteo] = conf.key(ApiType::OpenMeteo);
+  // Get information about pricing plans.
+  planOwm = conf.planOpenWeatherMap();
+  planWb = conf.planWeatherbit();
+  planWs = conf.planWeatherstack();
 
-  // copy tasks
+  // Copy tasks. Tasks for current weather and forecast of the same location
+  // are merged, if the API can get both with one request.
+  std::vector<Task> tasks = conf.tasks();
+  const std::size_t merged = TaskManager::coalesce(tasks, planWb, planWs);
+  if (merged > 0)
+  {
+    std::cout << "Info: " << merged << " pair(s) of tasks for current weather"
+              << " and forecast data are combined into one request each." << std::endl;
+  }
+  // Let tasks start at different times within their interval to avoid that
+  // all requests happen at once.
   const auto now = std::chrono::steady_clock::now();
+  const auto offsets = Phases::offsets(tasks);
   tasksContainer.clear();
-  for (const auto& t : conf.tasks())
+  for (std::size_t i = 0; i < tasks.size(); ++i)
   {
-    tasksContainer.emplace_back(t, now);
-    const auto api = Factory::create(t.api(), planWb, planWs, "");
+    const Task& t = tasks[i];
+    // Each task gets its own API instance that is used for all requests of
+    // the task, so that it does not have to be created again every time.
+    std::unique_ptr<API> api = createApi(t.api());
+    if (api == nullptr)
+    {
+      std::cerr << "Error: API type " << toString(t.api()) << " is not "
+                << "supported for data collection!\n";
+      return false;
+    }
     if (api->needsApiKey() && apiKeys[t.api()].empty())
     {
       std::cerr << "Error: API key for " << toString(t.api()) << " is not set, "
                 << "but there is a task for that API and it requires a key!\n";
       return false;
     } // if
+    tasksContainer.emplace_back(t, now + offsets[i], std::move(api));
   } // for
   if (tasksContainer.empty())
   {
     std::cerr << "Error: There are no tasks in the configuration!\n";
     return false;
   }
+  Phases::showRates(Phases::rates(tasks, offsets));
   // get connection information
   connInfo = conf.connectionInfo();
   if (!connInfo.isComplete())
@@ -85,152 +181,789 @@ bool Collector::fromConfiguration(const Configuration& conf)
     std::cerr << "Error: Database connection information is incomplete!\n";
     return false;
   }
-  // Get information about pricing plans.
-  planWb = conf.planWeatherbit();
-  planWs = conf.planWeatherstack();
+  // Requests are checked against the plan limits during collection, too.
+  if (enforceLimits)
+    rateLimiter = std::make_unique<RateLimiter>(planOwm, planWb, planWs);
+  else
+    rateLimiter = nullptr;
+  // number of worker threads
+  workerThreads = conf.collectorThreads();
+  // settings for batched requests
+  batchSize = conf.collectorBatchSize();
+  batchWindow = conf.collectorBatchWindow();
+  connectionsPerHost = conf.collectorConnectionsPerHost();
+  http2 = conf.collectorHttp2();
+  openMeteoUnixTime = conf.collectorOpenMeteoUnixTime();
+  prewarmTime = conf.collectorPrewarmTime();
+  timeouts = Timeouts{ conf.collectorConnectTimeout(), conf.collectorRequestTimeout(),
+                       conf.collectorStallTimeout() };
+  // settings of the storage stage
+  flushInterval = conf.storageFlushInterval();
+  flushSize = conf.storageFlushSize();
+  queueSize = conf.storageQueueSize();
+  spoolFile = conf.storageSpoolFile();
   return true;
 }
 
-int_least32_t Collector::nextIndex() const
+void Collector::collect()
 {
   if (tasksContainer.empty())
-    return -1;
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(busyMutex);
+    busy.assign(tasksContainer.size(), false);
+  }
+  batchLimits = batchLimitsOfTasks();
+  scheduler.clear();
+  for (std::size_t i = 0; i < tasksContainer.size(); ++i)
+  {
+    scheduler.schedule(i, tasksContainer[i].nextRequest);
+  }
+  std::unique_ptr<Spool> spool = nullptr;
+  if (!spoolFile.empty())
+  {
+    spool = std::make_unique<Spool>(spoolFile);
+    if (!spool->good())
+    {
+      std::cerr << "Error: Spool file " << spoolFile << " cannot be used, "
+                << "data collection is not started!" << std::endl;
+      return;
+    }
+  }
+  storage = std::make_unique<StorageStage>(DatabaseWriter(connInfo, flushSize),
+      flushInterval, flushSize, queueSize, std::move(spool));
+  WorkerPool pool(workerThreads);
+  std::cout << "Info: Using " << pool.size() << " worker thread(s) for data "
+            << "collection of " << tasksContainer.size() << " task(s)." << std::endl;
+  // All requests, including those of the workers, use the same timeouts and
+  // the same HTTP version.
+  Curly::setDefaultTimeouts(timeouts);
+  Curly::setDefaultHttp2(http2);
+  timings.clear();
+  retryPolicy = std::make_unique<RetryPolicy>(planOwm, planWb, planWs);
+  RequestEngine engine(connectionsPerHost, http2);
+  bool saturated = false;
+  std::set<ApiType> throttled;
+  std::set<ApiType> unavailable;
 
-  auto minTime = tasksContainer[0].nextRequest;
-  std::vector<TaskData>::size_type minIndex = 0;
-  const auto taskLength = tasksContainer.size();
-  for (std::vector<TaskData>::size_type i = 1; i < taskLength; ++i)
+  while (!stopRequested())
   {
-    if (tasksContainer[i].nextRequest < minTime)
+    startDueRetries(engine, pool);
+    const Scheduler::Entry entry = scheduler.next();
+    const std::size_t idx = entry.index;
+    // Set up the connection to the API shortly before the task is due, so
+    // that the request does not have to wait for DNS, TCP and TLS.
+    if ((prewarmTime.count() > 0) && engine.good())
+    {
+      if (!waitUntil(entry.due - prewarmTime))
+        continue;
+      prewarm(idx, engine);
+    }
+    // wait until next request is due, a retry is due or someone requests a stop
+    if (!waitUntil(entry.due))
+      continue;
+
+    TaskData& data = tasksContainer[idx];
+    {
+      std::lock_guard<std::mutex> lock(busyMutex);
+      if (busy[idx])
+      {
+        std::cerr << "Warning: Skipping collection of " << toString(data.task.data())
+                  << " data for " << data.task.location().toString() << " from "
+                  << toString(data.task.api()) << ", because the previous "
+                  << "collection for that task is still in flight. "
+                  << tasksInFlight() << " task(s) are in flight right now." << std::endl;
+        data.nextRequest = data.nextRequest + data.task.interval();
+        scheduler.rescheduleNext(data.nextRequest);
+        continue;
+      }
+    }
+
+    // Skip the task while its API is down, so that requests which will most
+    // likely fail do not occupy the workers and the connections.
+    if (!retryPolicy->allowRequest(data.task.api(), std::chrono::steady_clock::now()))
+    {
+      if (unavailable.insert(data.task.api()).second)
+      {
+        std::cout << "Info: Skipping requests to " << toString(data.task.api())
+                  << " API, because its previous requests failed." << std::endl;
+      }
+      data.nextRequest = data.nextRequest + data.task.interval();
+      scheduler.rescheduleNext(data.nextRequest);
+      continue;
+    }
+    unavailable.erase(data.task.api());
+
+    // If the API can request several locations at once, then other tasks
+    // with the same API and data type that are due soon join the request.
+    std::vector<Scheduler::Entry> batch;
+    const std::size_t limit = batchLimits[idx];
+    if (limit > 1)
+    {
+      batch = takeBatch(limit, std::chrono::steady_clock::now() + batchWindow);
+    }
+
+    // Delay the task, if the request would exceed the API's limit. Tasks for
+    // other APIs are not affected by that, because they keep their place in
+    // the scheduler.
+    if (rateLimiter != nullptr)
     {
-      minTime = tasksContainer[i].nextRequest;
-      minIndex = i;
+      std::chrono::steady_clock::time_point availableAt;
+      const auto count = static_cast<uint_least32_t>(batch.size() + 1);
+      if (!rateLimiter->tryAcquire(data.task.api(), std::chrono::steady_clock::now(), availableAt, count))
+      {
+        if (throttled.insert(data.task.api()).second)
+        {
+          std::cout << "Info: Delaying requests to " << toString(data.task.api())
+                    << " API to stay within the request limit of the plan." << std::endl;
+        }
+        scheduler.rescheduleNext(availableAt);
+        for (const Scheduler::Entry& e : batch)
+        {
+          scheduler.schedule(e.index, e.due);
+        }
+        continue;
+      }
+      throttled.erase(data.task.api());
     }
+
+    // update time for next request
+    data.nextRequest = data.nextRequest + data.task.interval();
+    scheduler.rescheduleNext(data.nextRequest);
+    std::vector<std::size_t> indices = { idx };
+    for (const Scheduler::Entry& e : batch)
+    {
+      TaskData& other = tasksContainer[e.index];
+      other.nextRequest = other.nextRequest + other.task.interval();
+      scheduler.schedule(e.index, other.nextRequest);
+      indices.push_back(e.index);
+    }
+    {
+      std::lock_guard<std::mutex> lock(busyMutex);
+      for (const std::size_t i : indices)
+      {
+        busy[i] = true;
+      }
+    }
+
+    inFlight += indices.size();
+    bool submitted = false;
+    std::string url;
+    if ((indices.size() == 1) && engine.good() && (data.api != nullptr)
+        && data.api->singleRequestUrl(data.task.data(), data.task.location(), url))
+    {
+      data.retries = 0;
+      submitted = executeAsync(idx, url, engine, pool);
+    }
+    else if ((indices.size() > 1) && engine.good() && (data.api != nullptr)
+             && data.api->batchRequestUrl(data.task.data(), locationsOf(indices), url))
+    {
+      // Batches use the connections of the engine, too, so that they benefit
+      // from the pre-warmed connection as much as single requests.
+      submitted = executeBatchAsync(indices, url, engine, pool);
+    }
+    else
+    {
+      submitted = pool.submit([this, indices]()
+      {
+        if (!stopRequested())
+          executeBatch(indices);
+        release(indices);
+      });
+    }
+    if (!submitted)
+    {
+      inFlight -= indices.size();
+      break;
+    }
+
+    // Report when all workers are busy, but only once per busy period.
+    const std::size_t current = tasksInFlight();
+    if (current > pool.size())
+    {
+      if (!saturated)
+      {
+        std::cout << "Info: All " << pool.size() << " worker thread(s) are busy, "
+                  << current << " task(s) are in flight." << std::endl;
+        saturated = true;
+      }
+    }
+    else
+    {
+      saturated = false;
+    }
+  } // while
+
+  // Let running requests finish, so that their responses reach the workers.
+  engine.stop();
+  // Retries that are still waiting are not done anymore.
+  std::vector<std::size_t> abandoned;
+  {
+    std::lock_guard<std::mutex> lock(stopMutex);
+    while (!retries.empty())
+    {
+      abandoned.push_back(retries.pop().index);
+    }
+  }
+  release(abandoned);
+  // Responses of the finished requests have been queued for parsing, so the
+  // workers have to process them before the pool is stopped. Queued batch
+  // collections skip their requests, because the stop has been requested.
+  pool.waitUntilIdle();
+  pool.stop();
+  // Write the remaining data to the database.
+  storage->stop();
+  storage->printStatistics();
+  Request::printTraffic();
+  std::cout << "Request latency with new connection: " << engine.coldLatencies().toString() << std::endl
+            << "Request latency with existing connection: " << engine.warmLatencies().toString() << std::endl;
+  printTimings();
+  storage = nullptr;
+  retryPolicy = nullptr;
+}
+
+std::vector<std::size_t> Collector::batchLimitsOfTasks() const
+{
+  std::vector<std::size_t> limits(tasksContainer.size(), 1);
+  if (batchSize <= 1)
+    return limits;
+  for (std::size_t i = 0; i < tasksContainer.size(); ++i)
+  {
+    const Task& task = tasksContainer[i].task;
+    const std::unique_ptr<API>& api = tasksContainer[i].api;
+    if ((api != nullptr) && api->validBatchLocation(task.location()))
+      limits[i] = std::min(api->maximumBatchSize(task.data()), batchSize);
   } // for
-  return static_cast<int_least32_t>(minIndex);
+  return limits;
 }
 
-void Collector::collect()
+std::vector<Scheduler::Entry> Collector::takeBatch(const std::size_t limit, const std::chrono::steady_clock::time_point& until)
+{
+  // The first task has to be out of the way to get to the following tasks.
+  const Scheduler::Entry first = scheduler.pop();
+  const Task& task = tasksContainer[first.index].task;
+  std::vector<Scheduler::Entry> batch;
+  std::vector<Scheduler::Entry> others;
+  {
+    std::lock_guard<std::mutex> lock(busyMutex);
+    while ((batch.size() + 1 < limit) && !scheduler.empty() && (scheduler.next().due <= until))
+    {
+      const Scheduler::Entry entry = scheduler.pop();
+      const Task& candidate = tasksContainer[entry.index].task;
+      if ((candidate.api() == task.api()) && (candidate.data() == task.data())
+          && (batchLimits[entry.index] > 1) && !busy[entry.index])
+        batch.push_back(entry);
+      else
+        others.push_back(entry);
+    } // while
+  }
+  // Tasks that do not fit into the batch keep their due time. The first task
+  // becomes the next task of the scheduler again, because it was due first.
+  scheduler.schedule(first.index, first.due);
+  for (const Scheduler::Entry& entry : others)
+  {
+    scheduler.schedule(entry.index, entry.due);
+  }
+  return batch;
+}
+
+std::unique_ptr<API> Collector::createApi(const ApiType type) const
+{
+  const auto iter = apiKeys.find(type);
+  const std::string key = (iter != apiKeys.end()) ? iter->second : std::string();
+  std::unique_ptr<API> api = Factory::create(type, planWb, planWs, key);
+  if (openMeteoUnixTime && (type == ApiType::OpenMeteo) && (api != nullptr))
+  {
+    static_cast<OpenMeteo&>(*api).setUnixTime(true);
+  }
+  return api;
+}
+
+Collector::Result Collector::execute(const std::size_t index) const
 {
-  auto idx = nextIndex();
-  if (idx < 0)
+  const Task& task = tasksContainer[index].task;
+  const std::unique_ptr<API>& api = tasksContainer[index].api;
+  if (api == nullptr)
+  {
+    std::cerr << "Error: Cannot collect data for unsupported API type "
+              << toString(task.api()) << "!" << std::endl;
+    return Result::OtherFailure;
+  } // if
+
+  // Retrieve data.
+  Request::resetLastStatusCode();
+  bool success = false;
+  switch (task.data())
+  {
+    case DataType::Current:
+         success = collectCurrent(*api, task.api(), task.location());
+         break;
+    case DataType::Forecast:
+         success = collectForecast(*api, task.api(), task.location());
+         break;
+    case DataType::CurrentAndForecast:
+         success = collectCurrentAndForecast(*api, task.api(), task.location());
+         break;
+    default: // i. e. none and possible future unimplemented stuff
+         std::cerr << "Error: Request for data type " << toString(task.data())
+                   << " cannot be handled!" << std::endl;
+         return Result::OtherFailure;
+  } // switch
+  if (success)
+    return Result::Success;
+  // Failures without a request or after a successful request, e. g. due to
+  // invalid data, are no sign that the API is down.
+  return RetryPolicy::isRetryable(Request::lastStatusCode()) ? Result::TransientFailure : Result::OtherFailure;
+}
+
+void Collector::executeBatch(const std::vector<std::size_t>& indices) const
+{
+  if (indices.size() == 1)
+  {
+    // The workers do not retry failed requests, but failures that may go
+    // away still count for the circuit breaker of the API.
+    const ApiType type = tasksContainer[indices.front()].task.api();
+    switch (execute(indices.front()))
+    {
+      case Result::Success:
+           retryPolicy->recordSuccess(type);
+           break;
+      case Result::TransientFailure:
+           recordFailure(type, std::chrono::seconds::zero());
+           break;
+      case Result::OtherFailure:
+           break;
+    } // switch
+    return;
+  }
+  if (indices.empty())
+    return;
+
+  // All tasks of the batch use the same API, so the instance of the first
+  // task does the request for all of them.
+  const Task& first = tasksContainer[indices.front()].task;
+  const ApiType type = first.api();
+  const std::unique_ptr<API>& api = tasksContainer[indices.front()].api;
+  if (api == nullptr)
+  {
+    std::cerr << "Error: Cannot collect data for unsupported API type "
+              << toString(type) << "!" << std::endl;
     return;
+  } // if
 
-  while (true)
+  const std::vector<Location> locations = locationsOf(indices);
+  std::vector<Weather> weather;
+  std::vector<Forecast> forecast;
+  bool success = false;
+  Request::resetLastStatusCode();
+  switch (first.data())
   {
-    if (stopRequested())
+    case DataType::Current:
+         success = api->currentWeatherBatch(locations, weather);
+         break;
+    case DataType::Forecast:
+         success = api->forecastWeatherBatch(locations, forecast);
+         break;
+    case DataType::CurrentAndForecast:
+         success = api->currentAndForecastWeatherBatch(locations, weather, forecast);
+         break;
+    default: // i. e. none and possible future unimplemented stuff
+         std::cerr << "Error: Request for data type " << toString(first.data())
+                   << " cannot be handled!" << std::endl;
+         return;
+  } // switch
+  if (!success)
+  {
+    std::cerr << "Error: Could not get " << toString(first.data())
+              << " data for " << locations.size() << " locations from API "
+              << toString(type) << "!" << std::endl;
+    if (RetryPolicy::isRetryable(Request::lastStatusCode()))
+      recordFailure(type, std::chrono::seconds::zero());
+    return;
+  }
+  retryPolicy->recordSuccess(type);
+
+  for (std::size_t i = 0; i < weather.size() && i < locations.size(); ++i)
+  {
+    storeWeather(type, locations[i], weather[i]);
+  }
+  for (std::size_t i = 0; i < forecast.size() && i < locations.size(); ++i)
+  {
+    storeForecast(type, locations[i], forecast[i]);
+  }
+}
+
+bool Collector::executeAsync(const std::size_t index, const std::string& url, RequestEngine& engine, WorkerPool& pool)
+{
+  const auto requestTime = std::chrono::system_clock::now();
+  TaskData& data = tasksContainer[index];
+  // A retry only makes sense before the next regular request of the task.
+  const auto deadline = data.nextRequest;
+  return engine.getIfChanged(url, "Collector::executeAsync", data.validators,
+      [this, index, requestTime, deadline, &pool](const RequestEngine::Outcome outcome, std::string&& response,
+                                                  const RequestEngine::TransferInfo& info)
+  {
+    recordTiming(index, outcome, info.timing);
+    const Task& task = tasksContainer[index].task;
+    if (outcome == RequestEngine::Outcome::Failed)
     {
+      // The timing shows the phase where the request got stuck, e. g. when it
+      // was aborted by a timeout.
+      std::cerr << "Error: Could not get " << toString(task.data()) << " data from API "
+                << toString(task.api()) << "! Timing: " << describe(info.timing) << "." << std::endl;
+      if (!retryLater(index, info, deadline))
+        release({ index });
       return;
     }
-    const Location& loc = tasksContainer[idx].task.location();
-    const std::string key = apiKeys[tasksContainer[idx].task.api()];
-    std::unique_ptr<API> api = Factory::create(tasksContainer[idx].task.api(), planWb, planWs, key);
-    if (api == nullptr)
+    retryPolicy->recordSuccess(task.api());
+    if (outcome == RequestEngine::Outcome::Unchanged)
     {
-      std::cerr << "Error: Cannot collect data for unsupported API type "
-                << toString(tasksContainer[idx].task.api()) << "!" << std::endl;
+      // The data is the same as in the previous response, which has already
+      // been stored, so there is nothing to parse or to store.
+      release({ index });
       return;
-    } // if
-
-    // Retrieve data.
-    switch (tasksContainer[idx].task.data())
+    }
+    // Parsing is done by the workers, so that the network thread can go on
+    // with the other requests in the meantime.
+    const bool submitted = pool.submit([this, index, requestTime, json = std::move(response)]()
     {
-      case DataType::Current:
-           collectCurrent(*api, tasksContainer[idx].task.api(), loc);
-           break;
-      case DataType::Forecast:
-           collectForecast(*api, tasksContainer[idx].task.api(), loc);
-           break;
-      case DataType::CurrentAndForecast:
-           collectCurrentAndForecast(*api, tasksContainer[idx].task.api(), loc);
-           break;
-      default: // i. e. none and possible future unimplemented stuff
-           std::cerr << "Error: Request for data type "
-                     << toString(tasksContainer[idx].task.data())
-                     << " cannot be handled!" << std::endl;
-           break;
-    } // switch
-    api = nullptr;
-    // update time for next request
-    tasksContainer[idx].nextRequest = tasksContainer[idx].nextRequest + tasksContainer[idx].task.interval();
-    // find index for next request
-    idx = nextIndex();
-    // check stop flag again
-    if (stopRequested())
+      if (!processResponse(index, requestTime, json))
+      {
+        // Get the data again with the next request, even if it is unchanged.
+        tasksContainer[index].validators = RequestEngine::Validators();
+      }
+      release({ index });
+    });
+    if (!submitted)
+      release({ index });
+  });
+}
+
+bool Collector::executeBatchAsync(const std::vector<std::size_t>& indices, const std::string& url,
+                                  RequestEngine& engine, WorkerPool& pool)
+{
+  const auto requestTime = std::chrono::system_clock::now();
+  return engine.getWithInfo(url, "Collector::executeBatchAsync",
+      [this, indices, requestTime, &pool](const RequestEngine::Outcome outcome, std::string&& response,
+                                          const RequestEngine::TransferInfo& info)
+  {
+    recordTiming(indices.front(), outcome, info.timing);
+    const Task& first = tasksContainer[indices.front()].task;
+    if (outcome != RequestEngine::Outcome::Changed)
     {
+      std::cerr << "Error: Could not get " << toString(first.data()) << " data for "
+                << indices.size() << " locations from API " << toString(first.api())
+                << "! Timing: " << describe(info.timing) << "." << std::endl;
+      // Batches are not retried, but failures that may go away still count
+      // for the circuit breaker of the API.
+      if (RetryPolicy::isRetryable(info.statusCode))
+        recordFailure(first.api(), RetryPolicy::parseRetryAfter(info.retryAfter, std::chrono::system_clock::now()));
+      release(indices);
       return;
     }
-    // wait until next request is due
-    std::this_thread::sleep_until(tasksContainer[idx].nextRequest);
-  } // while
+    retryPolicy->recordSuccess(first.api());
+    // Parsing is done by the workers, so that the network thread can go on
+    // with the other requests in the meantime.
+    const bool submitted = pool.submit([this, indices, requestTime, json = std::move(response)]()
+    {
+      processBatchResponse(indices, requestTime, json);
+      release(indices);
+    });
+    if (!submitted)
+      release(indices);
+  });
 }
 
-void Collector::collectCurrent(API& api, const ApiType type, const Location& loc) const
+void Collector::recordFailure(const ApiType api, const std::chrono::seconds& retryAfter) const
 {
-  Weather weather;
-  if (api.currentWeather(loc, weather))
+  if (retryPolicy->recordFailure(api, std::chrono::steady_clock::now(), retryAfter))
   {
-    StoreMariaDB sql(connInfo);
-    if (!sql.saveCurrentWeather(type, loc, weather))
+    std::cout << "Info: Pausing requests to " << toString(api) << " API, because "
+              << "its recent requests failed." << std::endl;
+  }
+}
+
+bool Collector::retryLater(const std::size_t index, const RequestEngine::TransferInfo& info,
+                           const std::chrono::steady_clock::time_point& deadline)
+{
+  // Errors like an invalid API key do not go away by repeating the request,
+  // and they do not mean that the API is down.
+  if (!RetryPolicy::isRetryable(info.statusCode))
+    return false;
+  TaskData& data = tasksContainer[index];
+  const ApiType api = data.task.api();
+  const auto now = std::chrono::steady_clock::now();
+  const auto retryAfter = RetryPolicy::parseRetryAfter(info.retryAfter, std::chrono::system_clock::now());
+  recordFailure(api, retryAfter);
+  if (data.retries >= RetryPolicy::maxRetries)
+    return false;
+  const auto delay = retryPolicy->backoff(data.retries, retryAfter);
+  if ((now + delay >= deadline) || !retryPolicy->tryRetry(api, now))
+    return false;
+  ++data.retries;
+  std::cout << "Info: Retrying request for " << toString(data.task.data()) << " data from API "
+            << toString(api) << " in " << delay.count() << " ms." << std::endl;
+  {
+    std::lock_guard<std::mutex> lock(stopMutex);
+    retries.schedule(index, now + delay);
+  }
+  stopSignal.notify_all();
+  return true;
+}
+
+void Collector::startDueRetries(RequestEngine& engine, WorkerPool& pool)
+{
+  std::vector<std::size_t> due;
+  {
+    std::lock_guard<std::mutex> lock(stopMutex);
+    const auto now = std::chrono::steady_clock::now();
+    while (!retries.empty() && (retries.next().due <= now))
     {
-      std::cerr << "Error: Could not save weather data from API "
-                << toString(type) << " to database!" << std::endl;
-    } // if
-  } // if
-  else
+      due.push_back(retries.pop().index);
+    }
+  }
+  for (const std::size_t index : due)
   {
-    std::cerr << "Error: Could not get current weather data from API "
-              << toString(type) << "!" << std::endl;
+    TaskData& data = tasksContainer[index];
+    const ApiType api = data.task.api();
+    const auto now = std::chrono::steady_clock::now();
+    // Retries count against the request limit of the plan like any other
+    // request, so they are dropped when the limit is reached.
+    std::chrono::steady_clock::time_point availableAt;
+    std::string url;
+    if (!retryPolicy->allowRequest(api, now)
+        || ((rateLimiter != nullptr) && !rateLimiter->tryAcquire(api, now, availableAt))
+        || !data.api->singleRequestUrl(data.task.data(), data.task.location(), url)
+        || !executeAsync(index, url, engine, pool))
+    {
+      release({ index });
+    }
+  }
+}
+
+bool Collector::waitUntil(const std::chrono::steady_clock::time_point& tp)
+{
+  std::unique_lock<std::mutex> lock(stopMutex);
+  while (!stopRequested())
+  {
+    const auto now = std::chrono::steady_clock::now();
+    if (!retries.empty() && (retries.next().due <= now))
+      return false;
+    if (now >= tp)
+      return true;
+    stopSignal.wait_until(lock, retries.empty() ? tp : std::min(tp, retries.next().due));
+  }
+  return false;
+}
+
+void Collector::recordTiming(const std::size_t index, const RequestEngine::Outcome outcome, const RequestTiming& timing)
+{
+  // Failed requests would distort the averages, e. g. after a timeout.
+  if (outcome == RequestEngine::Outcome::Failed)
+    return;
+  const Task& task = tasksContainer[index].task;
+  if (timing.total >= slowRequest)
+  {
+    std::cout << "Info: Slow request for " << toString(task.data()) << " data from API "
+              << toString(task.api()) << ": " << describe(timing) << "." << std::endl;
+  }
+  TimingTotals& totals = timings[task.api()];
+  ++totals.requests;
+  totals.sum.nameLookup += timing.nameLookup;
+  totals.sum.connect += timing.connect;
+  totals.sum.tls += timing.tls;
+  totals.sum.firstByte += timing.firstByte;
+  totals.sum.total += timing.total;
+}
+
+void Collector::printTimings() const
+{
+  for (const auto& [api, totals] : timings)
+  {
+    if (totals.requests == 0)
+      continue;
+    const auto count = static_cast<std::chrono::microseconds::rep>(totals.requests);
+    const RequestTiming average{ totals.sum.nameLookup / count, totals.sum.connect / count,
+                                 totals.sum.tls / count, totals.sum.firstByte / count,
+                                 totals.sum.total / count };
+    std::cout << "Request timing of " << toString(api) << " API: " << totals.requests
+              << " request(s), average " << describe(average) << std::endl;
   }
 }
 
-void Collector::collectForecast(API& api, const ApiType type, const Location& loc) const
+void Collector::prewarm(const std::size_t index, RequestEngine& engine)
 {
+  TaskData& data = tasksContainer[index];
+  {
+    std::lock_guard<std::mutex> lock(busyMutex);
+    // The API instance must not be used while a request of the task runs.
+    if (busy[index])
+      return;
+  }
+  // The task is skipped while its API is down, so there is nothing to warm.
+  if (!retryPolicy->isAvailable(data.task.api(), std::chrono::steady_clock::now()))
+    return;
+  // Batches go to the same host as single requests, so the connection of the
+  // single request URL serves both.
+  std::string url;
+  if ((data.api != nullptr) && data.api->singleRequestUrl(data.task.data(), data.task.location(), url))
+    engine.prewarm(url);
+}
+
+std::vector<Location> Collector::locationsOf(const std::vector<std::size_t>& indices) const
+{
+  std::vector<Location> locations;
+  locations.reserve(indices.size());
+  for (const std::size_t i : indices)
+  {
+    locations.push_back(tasksContainer[i].task.location());
+  }
+  return locations;
+}
+
+void Collector::processBatchResponse(const std::vector<std::size_t>& indices, const std::chrono::system_clock::time_point& requestTime,
+                                     const std::string& json) const
+{
+  const Task& first = tasksContainer[indices.front()].task;
+  const std::vector<Location> locations = locationsOf(indices);
+  std::vector<Weather> weather;
+  std::vector<Forecast> forecast;
+  if (!tasksContainer[indices.front()].api->parseBatch(first.data(), locations, json, weather, forecast))
+  {
+    std::cerr << "Error: Could not parse " << toString(first.data()) << " data for "
+              << locations.size() << " locations from API " << toString(first.api())
+              << "!" << std::endl;
+    return;
+  }
+  for (std::size_t i = 0; i < weather.size() && i < locations.size(); ++i)
+  {
+    weather[i].setRequestTime(requestTime);
+    storeWeather(first.api(), locations[i], weather[i]);
+  }
+  for (std::size_t i = 0; i < forecast.size() && i < locations.size(); ++i)
+  {
+    forecast[i].setRequestTime(requestTime);
+    storeForecast(first.api(), locations[i], forecast[i]);
+  }
+}
+
+bool Collector::processResponse(const std::size_t index, const std::chrono::system_clock::time_point& requestTime,
+                                const std::string& json) const
+{
+  const Task& task = tasksContainer[index].task;
+  const API& api = *tasksContainer[index].api;
+  const bool hasWeather = (task.data() == DataType::Current) || (task.data() == DataType::CurrentAndForecast);
+  const bool hasForecast = (task.data() == DataType::Forecast) || (task.data() == DataType::CurrentAndForecast);
+  Weather weather;
+  weather.setRequestTime(requestTime);
   Forecast forecast;
-  if (api.forecastWeather(loc, forecast))
+  forecast.setRequestTime(requestTime);
+  bool parsed = true;
+  if (hasWeather && hasForecast)
+    parsed = api.parseCurrentAndForecast(json, weather, forecast);
+  else if (hasWeather)
+    parsed = api.parseCurrentWeather(json, weather);
+  else if (hasForecast)
+    parsed = api.parseForecast(json, forecast);
+  if (!parsed)
   {
-    StoreMariaDB sql(connInfo);
-    if (!sql.saveForecast(type, loc, forecast))
+    std::cerr << "Error: Could not parse " << toString(task.data())
+              << " data from API " << toString(task.api()) << "!" << std::endl;
+    return false;
+  }
+  if (hasWeather)
+    storeWeather(task.api(), task.location(), weather);
+  if (hasForecast)
+    storeForecast(task.api(), task.location(), forecast);
+  return true;
+}
+
+void Collector::release(const std::vector<std::size_t>& indices)
+{
+  {
+    std::lock_guard<std::mutex> lock(busyMutex);
+    for (const std::size_t i : indices)
     {
-      std::cerr << "Error: Could not save forecast data from API "
-                << toString(type) << " to database!" << std::endl;
-    } // if
+      busy[i] = false;
+    }
+  }
+  inFlight -= indices.size();
+}
+
+bool Collector::collectCurrent(API& api, const ApiType type, const Location& loc) const
+{
+  Weather weather;
+  if (api.currentWeather(loc, weather))
+  {
+    storeWeather(type, loc, weather);
+    return true;
   } // if
-  else
+  std::cerr << "Error: Could not get current weather data from API "
+            << toString(type) << "!" << std::endl;
+  return false;
+}
+
+bool Collector::collectForecast(API& api, const ApiType type, const Location& loc) const
+{
+  Forecast forecast;
+  if (api.forecastWeather(loc, forecast))
   {
-    std::cerr << "Error: Could not get weather forecast data from API "
-              << toString(type) << "!" << std::endl;
-  }
+    storeForecast(type, loc, forecast);
+    return true;
+  } // if
+  std::cerr << "Error: Could not get weather forecast data from API "
+            << toString(type) << "!" << std::endl;
+  return false;
 }
 
-void Collector::collectCurrentAndForecast(API& api, const ApiType type, const Location& loc) const
+bool Collector::collectCurrentAndForecast(API& api, const ApiType type, const Location& loc) const
 {
   Weather weather;
   Forecast forecast;
   if (api.currentAndForecastWeather(loc, weather, forecast))
   {
-    StoreMariaDB sql(connInfo);
-    if (!sql.saveCurrentWeather(type, loc, weather))
-    {
-      std::cerr << "Error: Could not save weather data from API "
-                << toString(type) << " to database!" << std::endl;
-    } // if
-    if (!sql.saveForecast(type, loc, forecast))
-    {
-      std::cerr << "Error: Could not save forecast data from API "
-                << toString(type) << " to database!" << std::endl;
-    } // if
+    storeWeather(type, loc, weather);
+    storeForecast(type, loc, forecast);
+    return true;
   } // if
-  else
+  std::cerr << "Error: Could not get current weather and forecast data from API "
+            << toString(type) << "!" << std::endl;
+  return false;
+}
+
+void Collector::storeWeather(const ApiType type, const Location& loc, const Weather& weather) const
+{
+  if (!storage->pushWeather(type, loc, weather))
   {
-    std::cerr << "Error: Could not get current weather and forecast data from API "
-              << toString(type) << "!" << std::endl;
+    std::cerr << "Error: Could not save weather data from API "
+              << toString(type) << " to database!" << std::endl;
+  } // if
+}
+
+void Collector::storeForecast(const ApiType type, const Location& loc, const Forecast& forecast) const
+{
+  if (forecast.data().empty())
+  {
+    // No data, nothing to save here.
+    std::cerr << "Error: Forecast data from API " << toString(type)
+              << " is empty!" << std::endl;
+    return;
   }
+  if (!storage->pushForecast(type, loc, forecast))
+  {
+    std::cerr << "Error: Could not save forecast data from API "
+              << toString(type) << " to database!" << std::endl;
+  } // if
 }
 
 void Collector::stop()
 {
-  stopFlag = true;
+  {
+    std::lock_guard<std::mutex> lock(stopMutex);
+    stopFlag = true;
+  }
+  stopSignal.notify_all();
 }
 
 bool Collector::stopRequested() const
@@ -238,4 +971,9 @@ bool Collector::stopRequested() const
   return stopFlag;
 }
 
+std::size_t Collector::tasksInFlight() const
+{
+  return inFlight;
+}
+
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,12 +21,26 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_COLLECTOR_HPP
 #define WEATHER_INFORMATION_COLLECTOR_COLLECTOR_HPP
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "../api/API.hpp"
+#include "../api/RateLimiter.hpp"
+#include "../api/RetryPolicy.hpp"
 #include "../conf/Configuration.hpp"
+#include "Scheduler.hpp"
+#include "../net/RequestEngine.hpp"
+#include "StorageStage.hpp"
 
 namespace wic
 {
 
+class WorkerPool;
+
 /**
  * Auxiliary structure for class Collector.
  */
@@ -36,11 +50,25 @@ struct TaskData
    *
    * \param t   the task
    * \param tp  time of the next request
+   * \param a   the API instance that performs the requests of the task
    */
-  TaskData(const Task& t, const std::chrono::steady_clock::time_point& tp);
+  TaskData(const Task& t, const std::chrono::steady_clock::time_point& tp,
+           std::unique_ptr<API> a);
 
   Task task; /**< task data */
   std::chrono::steady_clock::time_point nextRequest; /**< time of next request */
+  std::unique_ptr<API> api; /**< API instance of the task, only used by one thread at a time */
+  RequestEngine::Validators validators; /**< validators of the latest response for conditional requests */
+  unsigned int retries; /**< number of retries of the current request */
+}; // struct
+
+/**
+ * Sums of the timings of the requests to an API.
+ */
+struct TimingTotals
+{
+  uint_least64_t requests; /**< number of requests */
+  RequestTiming sum; /**< sums of the durations of the request phases */
 }; // struct
 
 /**
@@ -56,13 +84,26 @@ class Collector
     /** \brief Gets all required information from the configuration.
      *
      * \param conf  the configuration
+     * \param enforceLimits  whether to delay requests that would exceed the
+     *                       request limits of the API plans
      * \return Returns true in case of success, returns false otherwise.
      *         Failure usually means that the configuration was not loaded.
      */
-    bool fromConfiguration(const Configuration& conf);
+    bool fromConfiguration(const Configuration& conf, const bool enforceLimits = true);
 
 
     /** \brief Starts data collection.
+     *
+     * \remarks The calling thread acts as scheduler and hands due tasks over
+     *          to a pool of worker threads which perform the requests. The
+     *          collected data is handed over to a separate storage stage that
+     *          writes it to the database in batches. A task is never executed
+     *          by more than one worker at the same time. Tasks of APIs that
+     *          support requests for several locations are combined into one
+     *          request, if they are due within the batch window. Requests for
+     *          a single location that need only one HTTP request are done by
+     *          a separate network thread instead, and the workers only parse
+     *          their responses.
      */
     void collect();
 
@@ -80,48 +121,287 @@ class Collector
      * \return Returns true, if stop of data collection was requested.
      */
     bool stopRequested() const;
+
+
+    /** \brief Gets the number of tasks that are queued for or currently
+     *         executed by the worker threads.
+     *
+     * \return Returns the number of tasks in flight.
+     */
+    std::size_t tasksInFlight() const;
   private:
-    /** \brief Gets the index of the next task that shall be executed.
+    /** \brief Result of a collection task that is executed by a worker. */
+    enum class Result
+    {
+      Success,          /**< the data was retrieved */
+      TransientFailure, /**< the request failed in a way that may go away, e. g. a timeout */
+      OtherFailure      /**< the task failed for any other or an unknown reason, e. g. invalid data */
+    }; // enum
+
+
+    /** \brief Determines how many tasks may be collected together with each
+     *         task in a single batched request.
+     *
+     * \return Returns the maximum batch size for each task, in the same order
+     *         as the tasks. One means that the task is never batched.
+     */
+    std::vector<std::size_t> batchLimitsOfTasks() const;
+
+
+    /** \brief Removes tasks from the scheduler that can be collected together
+     *         with the next task of the scheduler.
+     *
+     * \param limit  maximum number of tasks in the batch, including the next task
+     * \param until  latest due time of tasks that may be added to the batch
+     * \return Returns the scheduler entries of the removed tasks. The next task
+     *         itself is not part of it and stays in the scheduler.
+     */
+    std::vector<Scheduler::Entry> takeBatch(const std::size_t limit, const std::chrono::steady_clock::time_point& until);
+
+
+    /** \brief Creates the API implementation for an API type.
+     *
+     * \param type  the API type
+     * \return Returns the API implementation. Returns null, if the type is not
+     *         supported.
+     */
+    std::unique_ptr<API> createApi(const ApiType type) const;
+
+
+    /** \brief Executes a single collection task.
+     *
+     * \param index  index of the task to execute
+     * \return Returns Result::Success, if the data could be retrieved.
+     *         Returns Result::TransientFailure, if the request failed in a
+     *         way that a later request may not fail, and returns
+     *         Result::OtherFailure for all other failures.
+     * \remarks This is called from the worker threads.
+     */
+    Result execute(const std::size_t index) const;
+
+
+    /** \brief Executes several collection tasks with the same API and data
+     *         type with a single batched request.
+     *
+     * \param indices  indices of the tasks to execute
+     * \remarks This is called from the worker threads.
+     */
+    void executeBatch(const std::vector<std::size_t>& indices) const;
+
+
+    /** \brief Starts the request of a single collection task with the request
+     *         engine. The response is parsed by the worker threads.
+     *
+     * \param index   index of the task
+     * \param url     URL of the request
+     * \param engine  the engine that performs the request
+     * \param pool    the worker threads that parse the response
+     * \return Returns true, if the request was started.
+     *         Returns false otherwise.
+     */
+    bool executeAsync(const std::size_t index, const std::string& url, RequestEngine& engine, WorkerPool& pool);
+
+
+    /** \brief Starts the batched request of several collection tasks with
+     *         the request engine. The response is parsed by the worker
+     *         threads.
+     *
+     * \param indices  indices of the tasks, all of them use the same API and
+     *                  data type
+     * \param url      URL of the batched request
+     * \param engine   the engine that performs the request
+     * \param pool     the worker threads that parse the response
+     * \return Returns true, if the request was started.
+     *         Returns false otherwise.
+     */
+    bool executeBatchAsync(const std::vector<std::size_t>& indices, const std::string& url,
+                           RequestEngine& engine, WorkerPool& pool);
+
+
+    /** \brief Schedules a retry of a failed request of a single collection
+     *         task, if the retry policy allows it.
+     *
+     * \param index     index of the task
+     * \param info      details of the failed request
+     * \param deadline  time of the next regular request of the task
+     * \return Returns true, if a retry was scheduled. In that case the task
+     *         stays in flight until the retry is done.
+     * \remarks This is called from the thread of the request engine.
+     */
+    bool retryLater(const std::size_t index, const RequestEngine::TransferInfo& info,
+                    const std::chrono::steady_clock::time_point& deadline);
+
+
+    /** \brief Starts the retries that are due.
+     *
+     * \param engine  the engine that performs the requests
+     * \param pool    the worker threads that parse the responses
+     */
+    void startDueRetries(RequestEngine& engine, WorkerPool& pool);
+
+
+    /** \brief Waits until the given time, until a retry is due or until a stop
+     *         is requested, whatever happens first.
+     *
+     * \param tp  the time to wait for
+     * \return Returns true, if the given time has been reached.
+     *         Returns false, if a retry is due or a stop was requested.
+     */
+    bool waitUntil(const std::chrono::steady_clock::time_point& tp);
+
+
+    /** \brief Records a failed request for the circuit breaker of its API.
+     *
+     * \param api         the API
+     * \param retryAfter  delay that the API asked for, may be zero
+     */
+    void recordFailure(const ApiType api, const std::chrono::seconds& retryAfter) const;
+
+
+    /** \brief Adds the timing of a successful request to the totals of its
+     *         API and shows the timing of slow requests.
+     *
+     * \param index    index of the task
+     * \param outcome  outcome of the request
+     * \param timing   durations of the phases of the request
+     * \remarks This is called from the thread of the request engine.
+     */
+    void recordTiming(const std::size_t index, const RequestEngine::Outcome outcome, const RequestTiming& timing);
+
+
+    /** \brief Shows the average request timings per API.
+     */
+    void printTimings() const;
+
+
+    /** \brief Sets up the connection to the API of a collection task ahead of
+     *         its next request.
+     *
+     * \param index   index of the task
+     * \param engine  the engine that performs the requests
+     */
+    void prewarm(const std::size_t index, RequestEngine& engine);
+
+
+    /** \brief Gets the locations of several collection tasks.
+     *
+     * \param indices  indices of the tasks
+     * \return Returns the locations in the order of the indices.
+     */
+    std::vector<Location> locationsOf(const std::vector<std::size_t>& indices) const;
+
+
+    /** \brief Parses the response of a batched request for several collection
+     *         tasks and hands the data over to the storage stage.
+     *
+     * \param indices      indices of the tasks
+     * \param requestTime  time when the request was started
+     * \param json         the response
+     * \remarks This is called from the worker threads.
+     */
+    void processBatchResponse(const std::vector<std::size_t>& indices, const std::chrono::system_clock::time_point& requestTime,
+                              const std::string& json) const;
+
+
+    /** \brief Parses the response of a request for a single collection task
+     *         and hands the data over to the storage stage.
+     *
+     * \param index        index of the task
+     * \param requestTime  time when the request was started
+     * \param json         the response
+     * \return Returns true, if the response could be parsed.
+     * \remarks This is called from the worker threads.
+     */
+    bool processResponse(const std::size_t index, const std::chrono::system_clock::time_point& requestTime,
+                         const std::string& json) const;
+
+
+    /** \brief Marks collection tasks as finished, so they can be executed again.
      *
-     * \return Returns index of the next collection task to be executed.
-     *         Returns -1, if the task list is empty.
+     * \param indices  indices of the finished tasks
      */
-    int_least32_t nextIndex() const;
+    void release(const std::vector<std::size_t>& indices);
 
 
-    /** \brief Handles data collection and storage for current weather.
+    /** \brief Handles data collection for current weather.
      *
      * \param api   the API implementation that is used for collection
      * \param type  enumeration that indicates the API type
      * \param loc   location for which the data will be collected
+     * \return Returns true, if the data could be retrieved.
      */
-    void collectCurrent(API& api, const ApiType type, const Location& loc) const;
+    bool collectCurrent(API& api, const ApiType type, const Location& loc) const;
 
 
-    /** \brief Handles data collection and storage for forecast data.
+    /** \brief Handles data collection for forecast data.
      *
      * \param api   the API implementation that is used for collection
      * \param type  enumeration that indicates the API type
      * \param loc   location for which the data will be collected
+     * \return Returns true, if the data could be retrieved.
      */
-    void collectForecast(API& api, const ApiType type, const Location& loc) const;
+    bool collectForecast(API& api, const ApiType type, const Location& loc) const;
 
 
-    /** \brief Handles data collection and storage for current + forecast data.
+    /** \brief Handles data collection for current + forecast data.
      *
      * \param api   the API implementation that is used for collection
      * \param type  enumeration that indicates the API type
      * \param loc   location for which the data will be collected
+     * \return Returns true, if the data could be retrieved.
+     */
+    bool collectCurrentAndForecast(API& api, const ApiType type, const Location& loc) const;
+
+
+    /** \brief Hands current weather data over to the storage stage.
+     *
+     * \param type     enumeration that indicates the API type
+     * \param loc      location of the data
+     * \param weather  the weather data
+     */
+    void storeWeather(const ApiType type, const Location& loc, const Weather& weather) const;
+
+
+    /** \brief Hands forecast data over to the storage stage.
+     *
+     * \param type      enumeration that indicates the API type
+     * \param loc       location of the data
+     * \param forecast  the forecast data
      */
-    void collectCurrentAndForecast(API& api, const ApiType type, const Location& loc) const;
+    void storeForecast(const ApiType type, const Location& loc, const Forecast& forecast) const;
 
 
     std::vector<TaskData> tasksContainer; /**< container with all tasks */
+    Scheduler scheduler; /**< determines which task is due next */
     std::map<ApiType, std::string> apiKeys; /**< API keys */
     ConnectionInformation connInfo; /**< database connection information */
+    PlanOwm planOwm; /**< used pricing plan for OpenWeatherMap */
     PlanWeatherbit planWb; /**< used pricing plan for Weatherbit */
     PlanWeatherstack planWs; /**< used pricing plan for Weatherstack */
-    bool stopFlag; /**< set to true, when application requested to stop collection */
+    std::unique_ptr<RateLimiter> rateLimiter; /**< enforces API request limits, may be null */
+    std::unique_ptr<RetryPolicy> retryPolicy; /**< decides about retries and circuit breaking, only exists during collect() */
+    Scheduler retries; /**< retries of failed requests, guarded by stopMutex */
+    unsigned int workerThreads; /**< number of worker threads for collection */
+    std::size_t batchSize; /**< maximum number of locations in a batched request */
+    std::chrono::seconds batchWindow; /**< how far the collector looks ahead for tasks to add to a batch */
+    std::vector<std::size_t> batchLimits; /**< maximum batch size per task, only valid during collect() */
+    unsigned int connectionsPerHost; /**< maximum number of connections to a single API host */
+    bool http2; /**< whether requests to the same host share a connection via HTTP/2 */
+    bool openMeteoUnixTime; /**< whether requests to Open-Meteo get Unix timestamps */
+    std::chrono::milliseconds prewarmTime; /**< time before a due task when its connection is set up, zero means never */
+    Timeouts timeouts; /**< timeouts of the requests */
+    std::map<ApiType, TimingTotals> timings; /**< request timings per API, only changed by the thread of the request engine */
+    std::chrono::seconds flushInterval; /**< maximum time between two writes to the database */
+    unsigned int flushSize; /**< number of collected records that triggers a write */
+    unsigned int queueSize; /**< maximum number of records waiting for the database */
+    std::string spoolFile; /**< path of the spool file, empty means no spool */
+    std::unique_ptr<StorageStage> storage; /**< storage stage, only exists during collect() */
+    std::atomic<bool> stopFlag; /**< set to true, when application requested to stop collection */
+    std::mutex stopMutex; /**< mutex for waiting on stopSignal, guards retries */
+    std::condition_variable stopSignal; /**< wakes up the scheduler when a stop is requested or a retry is added */
+    std::mutex busyMutex; /**< mutex that guards busy */
+    std::vector<bool> busy; /**< whether the task at the same index is in flight */
+    std::atomic<std::size_t> inFlight; /**< number of tasks in flight */
 }; // class
 
 } // namespace
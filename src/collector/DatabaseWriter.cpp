@@ -0,0 +1,132 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "DatabaseWriter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+namespace wic
+{
+
+DatabaseWriter::DatabaseWriter(const ConnectionInformation& ci, const unsigned int size)
+: connInfo(ci),
+  batchSize(size > 0 ? size : 1),
+  store(nullptr)
+{
+}
+
+bool DatabaseWriter::operator()(const std::vector<StorageRecord>& batch, const bool replay)
+{
+  try
+  {
+    if (store == nullptr)
+      store = std::make_shared<StoreMariaDBBatch>(connInfo, batchSize);
+    if (!store->beginTransaction())
+    {
+      store = nullptr;
+      return false;
+    }
+    std::set<StoreMariaDBBatch::RequestKey> existingWeather;
+    std::set<StoreMariaDBBatch::RequestKey> existingForecasts;
+    if (replay && !existingRequests(batch, existingWeather, existingForecasts))
+    {
+      store->rollback();
+      store = nullptr;
+      return false;
+    }
+
+    for (const StorageRecord& record : batch)
+    {
+      const int_least32_t apiId = store->apiId(record.api);
+      const int_least32_t locationId = store->locationId(record.location);
+      bool success = (apiId > 0) && (locationId > 0);
+      if (success && replay)
+      {
+        const bool isForecast = record.type == DataType::Forecast;
+        const auto& existing = isForecast ? existingForecasts : existingWeather;
+        const auto& requestTime = isForecast ? record.forecast.requestTime() : record.weather.requestTime();
+        if (existing.find(StoreMariaDBBatch::key(apiId, locationId, requestTime)) != existing.end())
+          continue;
+      }
+      if (success)
+      {
+        if (record.type == DataType::Forecast)
+          success = store->saveForecast(apiId, locationId, record.forecast);
+        else
+          success = store->saveCurrentWeather(apiId, locationId, record.weather);
+      }
+      if (!success)
+      {
+        store->rollback();
+        // The connection might be broken, so start with a new one next time.
+        store = nullptr;
+        return false;
+      }
+    } // for
+
+    if (!store->commit())
+    {
+      store = nullptr;
+      return false;
+    }
+    return true;
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Error: Could not store data in database! " << ex.what() << std::endl;
+    store = nullptr;
+    return false;
+  }
+}
+
+bool DatabaseWriter::existingRequests(const std::vector<StorageRecord>& batch,
+                                      std::set<StoreMariaDBBatch::RequestKey>& weather,
+                                      std::set<StoreMariaDBBatch::RequestKey>& forecasts)
+{
+  using time_point = std::chrono::time_point<std::chrono::system_clock>;
+  time_point minData = time_point::max();
+  time_point maxData = time_point::min();
+  time_point minRequest = time_point::max();
+  time_point maxRequest = time_point::min();
+  for (const StorageRecord& record : batch)
+  {
+    if (record.type == DataType::Forecast)
+    {
+      minRequest = std::min(minRequest, record.forecast.requestTime());
+      maxRequest = std::max(maxRequest, record.forecast.requestTime());
+    }
+    else
+    {
+      minData = std::min(minData, record.weather.dataTime());
+      maxData = std::max(maxData, record.weather.dataTime());
+    }
+  } // for
+
+  // One query per table and batch is much cheaper than one query per record.
+  if ((minData <= maxData) && !store->existingWeather(minData, maxData, weather))
+    return false;
+  if ((minRequest <= maxRequest) && !store->existingForecasts(minRequest, maxRequest, forecasts))
+    return false;
+  return true;
+}
+
+} // namespace
@@ -0,0 +1,83 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_DATABASEWRITER_HPP
+#define WEATHER_INFORMATION_COLLECTOR_DATABASEWRITER_HPP
+
+#include <memory>
+#include <set>
+#include <vector>
+#include "../db/ConnectionInformation.hpp"
+#include "../db/mariadb/StoreMariaDBBatch.hpp"
+#include "StorageStage.hpp"
+
+namespace wic
+{
+
+/**
+ * Writes batches of the storage stage to the database. The connection is
+ * kept open between batches and only gets replaced after an error.
+ */
+class DatabaseWriter
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param ci         information for connection to the database
+     * \param batchSize  maximum number of records per insert statement
+     */
+    DatabaseWriter(const ConnectionInformation& ci, const unsigned int batchSize);
+
+
+    /** \brief Stores a batch of records in a single transaction.
+     *
+     * \param batch   the records to store
+     * \param replay  whether the records come from the spool and may already
+     *                be in the database
+     * \return Returns true, if all records were stored.
+     *         Returns false, if an error occurred. Nothing of the batch is
+     *         stored in that case.
+     * \remarks During a replay, records are skipped when the database already
+     *          contains data for the same API, location and request time, so
+     *          replaying a batch twice does not create duplicates.
+     */
+    bool operator()(const std::vector<StorageRecord>& batch, const bool replay);
+  private:
+    /** \brief Gets the requests of a batch that are already in the database.
+     *
+     * \param batch      the records
+     * \param weather    set that will receive the keys of existing current
+     *                   weather requests
+     * \param forecasts  set that will receive the keys of existing forecast
+     *                   requests
+     * \return Returns true, if the existing requests could be determined.
+     */
+    bool existingRequests(const std::vector<StorageRecord>& batch,
+                          std::set<StoreMariaDBBatch::RequestKey>& weather,
+                          std::set<StoreMariaDBBatch::RequestKey>& forecasts);
+
+    ConnectionInformation connInfo; /**< database connection information */
+    unsigned int batchSize; /**< maximum number of records per insert statement */
+    std::shared_ptr<StoreMariaDBBatch> store; /**< current connection, may be null */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_DATABASEWRITER_HPP
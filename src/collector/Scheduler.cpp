@@ -0,0 +1,113 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Scheduler.hpp"
+#include <utility>
+
+namespace wic
+{
+
+Scheduler::Scheduler()
+: heap(std::vector<Entry>())
+{
+}
+
+void Scheduler::schedule(const std::size_t index, const std::chrono::steady_clock::time_point& due)
+{
+  heap.push_back(Entry{ due, index });
+  siftUp(heap.size() - 1);
+}
+
+const Scheduler::Entry& Scheduler::next() const
+{
+  return heap.front();
+}
+
+Scheduler::Entry Scheduler::pop()
+{
+  const Entry result = heap.front();
+  heap.front() = heap.back();
+  heap.pop_back();
+  if (!heap.empty())
+    siftDown(0);
+  return result;
+}
+
+void Scheduler::rescheduleNext(const std::chrono::steady_clock::time_point& due)
+{
+  // The entry is the root of the heap, so it is due no later than all other
+  // entries. An earlier due time keeps it that way, so it never has to move
+  // up, and siftDown() leaves it in place in that case.
+  heap.front().due = due;
+  siftDown(0);
+}
+
+bool Scheduler::empty() const
+{
+  return heap.empty();
+}
+
+std::size_t Scheduler::size() const
+{
+  return heap.size();
+}
+
+void Scheduler::clear()
+{
+  heap.clear();
+}
+
+bool Scheduler::before(const Entry& a, const Entry& b)
+{
+  return (a.due < b.due) || ((a.due == b.due) && (a.index < b.index));
+}
+
+void Scheduler::siftUp(std::size_t pos)
+{
+  while (pos > 0)
+  {
+    const std::size_t parent = (pos - 1) / 2;
+    if (!before(heap[pos], heap[parent]))
+      return;
+    std::swap(heap[pos], heap[parent]);
+    pos = parent;
+  } // while
+}
+
+void Scheduler::siftDown(std::size_t pos)
+{
+  const std::size_t count = heap.size();
+  while (true)
+  {
+    const std::size_t left = 2 * pos + 1;
+    if (left >= count)
+      return;
+    std::size_t smallest = left;
+    const std::size_t right = left + 1;
+    if ((right < count) && before(heap[right], heap[left]))
+      smallest = right;
+    if (!before(heap[smallest], heap[pos]))
+      return;
+    std::swap(heap[pos], heap[smallest]);
+    pos = smallest;
+  } // while
+}
+
+} // namespace
@@ -0,0 +1,133 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_SCHEDULER_HPP
+#define WEATHER_INFORMATION_COLLECTOR_SCHEDULER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace wic
+{
+
+/**
+ * Min-heap of task indices, ordered by the time when the task is due next.
+ * Finding the next task is O(1), scheduling and rescheduling is O(log n).
+ */
+class Scheduler
+{
+  public:
+    /** \brief Entry of the scheduler. */
+    struct Entry
+    {
+      std::chrono::steady_clock::time_point due; /**< time when the task is due */
+      std::size_t index; /**< index of the task */
+    }; // struct
+
+
+    /** \brief Default constructor. Creates an empty scheduler. */
+    Scheduler();
+
+
+    /** \brief Adds a task to the scheduler.
+     *
+     * \param index  index of the task
+     * \param due    time when the task is due
+     */
+    void schedule(const std::size_t index, const std::chrono::steady_clock::time_point& due);
+
+
+    /** \brief Gets the task that is due next.
+     *
+     * \return Returns the entry of the task that is due next.
+     *         Tasks that are due at the same time are returned in order of
+     *         their index.
+     * \remarks Must not be called on an empty scheduler.
+     */
+    const Entry& next() const;
+
+
+    /** \brief Removes the task that is due next and returns it.
+     *
+     * \return Returns the entry of the task that was due next.
+     * \remarks Must not be called on an empty scheduler.
+     */
+    Entry pop();
+
+
+    /** \brief Moves the task that is due next to a new due time.
+     *
+     * \param due  the new due time of the task, may be earlier or later
+     *             than the current due time
+     * \remarks Must not be called on an empty scheduler.
+     *          This is faster than a call to pop() followed by schedule().
+     */
+    void rescheduleNext(const std::chrono::steady_clock::time_point& due);
+
+
+    /** \brief Checks whether the scheduler contains any tasks.
+     *
+     * \return Returns true, if there are no scheduled tasks.
+     */
+    bool empty() const;
+
+
+    /** \brief Gets the number of scheduled tasks.
+     *
+     * \return Returns the number of scheduled tasks.
+     */
+    std::size_t size() const;
+
+
+    /** \brief Removes all tasks from the scheduler. */
+    void clear();
+  private:
+    /** \brief Moves the element at the given position up until the heap
+     *         property is restored.
+     *
+     * \param pos  position of the element
+     */
+    void siftUp(std::size_t pos);
+
+
+    /** \brief Moves the element at the given position down until the heap
+     *         property is restored.
+     *
+     * \param pos  position of the element
+     */
+    void siftDown(std::size_t pos);
+
+
+    /** \brief Checks whether the first entry has to be executed before the second.
+     *
+     * \param a  the first entry
+     * \param b  the second entry
+     * \return Returns true, if a is due before b.
+     */
+    static bool before(const Entry& a, const Entry& b);
+
+
+    std::vector<Entry> heap; /**< binary min-heap of entries */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_SCHEDULER_HPP
@@ -0,0 +1,508 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Spool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace wic
+{
+
+const std::string Spool::header = std::string("WICSPOOL\x01\0\0\0", 12);
+
+/** \brief Appends an unsigned integer in little endian byte order.
+ *
+ * \param out    the destination
+ * \param value  the value
+ * \param bytes  number of bytes to write
+ */
+static void putUnsigned(std::string& out, uint64_t value, const unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; ++i)
+  {
+    out.push_back(static_cast<char>(value & 0xFF));
+    value >>= 8;
+  }
+}
+
+/** \brief Appends a float value as its IEEE 754 bit pattern.
+ *
+ * \param out    the destination
+ * \param value  the value
+ */
+static void putFloat(std::string& out, const float value)
+{
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  putUnsigned(out, bits, 4);
+}
+
+/** \brief Appends a string, preceded by its length.
+ *
+ * \param out    the destination
+ * \param value  the string
+ */
+static void putString(std::string& out, const std::string& value)
+{
+  putUnsigned(out, value.size(), 4);
+  out.append(value);
+}
+
+/** \brief Appends a point in time as nanoseconds since the epoch.
+ *
+ * \param out  the destination
+ * \param tp   the point in time
+ */
+static void putTime(std::string& out, const std::chrono::time_point<std::chrono::system_clock>& tp)
+{
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+  putUnsigned(out, static_cast<uint64_t>(ns), 8);
+}
+
+/** \brief Reads data that was written by the put...() functions. */
+struct SpoolReader
+{
+  std::string_view data; /**< remaining data */
+  bool ok; /**< whether all reads so far were successful */
+
+  uint64_t getUnsigned(const unsigned int bytes)
+  {
+    if (!ok || (data.size() < bytes))
+    {
+      ok = false;
+      return 0;
+    }
+    uint64_t value = 0;
+    for (unsigned int i = 0; i < bytes; ++i)
+    {
+      value |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+    }
+    data.remove_prefix(bytes);
+    return value;
+  }
+
+  float getFloat()
+  {
+    const uint32_t bits = static_cast<uint32_t>(getUnsigned(4));
+    float value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string getString()
+  {
+    const uint64_t length = getUnsigned(4);
+    if (!ok || (data.size() < length))
+    {
+      ok = false;
+      return std::string();
+    }
+    std::string value(data.substr(0, length));
+    data.remove_prefix(length);
+    return value;
+  }
+
+  std::chrono::time_point<std::chrono::system_clock> getTime()
+  {
+    const auto ns = std::chrono::nanoseconds(static_cast<int64_t>(getUnsigned(8)));
+    return std::chrono::time_point<std::chrono::system_clock>(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(ns));
+  }
+}; // struct
+
+/** \brief Appends the encoded weather data.
+ *
+ * \param out      the destination
+ * \param weather  the weather data
+ */
+static void putWeather(std::string& out, const Weather& weather)
+{
+  const unsigned int flags = (weather.hasTemperatureKelvin() ? 1 : 0)
+      | (weather.hasTemperatureCelsius() ? 2 : 0)
+      | (weather.hasTemperatureFahrenheit() ? 4 : 0)
+      | (weather.hasHumidity() ? 8 : 0)
+      | (weather.hasRain() ? 16 : 0)
+      | (weather.hasSnow() ? 32 : 0)
+      | (weather.hasPressure() ? 64 : 0)
+      | (weather.hasWindSpeed() ? 128 : 0)
+      | (weather.hasWindDegrees() ? 256 : 0)
+      | (weather.hasCloudiness() ? 512 : 0)
+      | (weather.hasJson() ? 1024 : 0);
+  putUnsigned(out, flags, 2);
+  putTime(out, weather.dataTime());
+  putTime(out, weather.requestTime());
+  if (weather.hasTemperatureKelvin())
+    putFloat(out, weather.temperatureKelvin());
+  if (weather.hasTemperatureCelsius())
+    putFloat(out, weather.temperatureCelsius());
+  if (weather.hasTemperatureFahrenheit())
+    putFloat(out, weather.temperatureFahrenheit());
+  if (weather.hasHumidity())
+    putUnsigned(out, static_cast<uint8_t>(weather.humidity()), 1);
+  if (weather.hasRain())
+    putFloat(out, weather.rain());
+  if (weather.hasSnow())
+    putFloat(out, weather.snow());
+  if (weather.hasPressure())
+    putUnsigned(out, static_cast<uint16_t>(weather.pressure()), 2);
+  if (weather.hasWindSpeed())
+    putFloat(out, weather.windSpeed());
+  if (weather.hasWindDegrees())
+    putUnsigned(out, static_cast<uint16_t>(weather.windDegrees()), 2);
+  if (weather.hasCloudiness())
+    putUnsigned(out, static_cast<uint8_t>(weather.cloudiness()), 1);
+  if (weather.hasJson())
+    putString(out, weather.json());
+}
+
+/** \brief Reads weather data that was encoded by putWeather().
+ *
+ * \param in       the reader
+ * \param weather  variable that will receive the weather data
+ */
+static void getWeather(SpoolReader& in, Weather& weather)
+{
+  weather = Weather();
+  const uint64_t flags = in.getUnsigned(2);
+  weather.setDataTime(in.getTime());
+  weather.setRequestTime(in.getTime());
+  if (flags & 1)
+    weather.setTemperatureKelvin(in.getFloat());
+  if (flags & 2)
+    weather.setTemperatureCelsius(in.getFloat());
+  if (flags & 4)
+    weather.setTemperatureFahrenheit(in.getFloat());
+  if (flags & 8)
+    weather.setHumidity(static_cast<int8_t>(in.getUnsigned(1)));
+  if (flags & 16)
+    weather.setRain(in.getFloat());
+  if (flags & 32)
+    weather.setSnow(in.getFloat());
+  if (flags & 64)
+    weather.setPressure(static_cast<int16_t>(in.getUnsigned(2)));
+  if (flags & 128)
+    weather.setWindSpeed(in.getFloat());
+  if (flags & 256)
+    weather.setWindDegrees(static_cast<int16_t>(in.getUnsigned(2)));
+  if (flags & 512)
+    weather.setCloudiness(static_cast<int8_t>(in.getUnsigned(1)));
+  if (flags & 1024)
+    weather.setJson(in.getString());
+}
+
+Spool::Spool(const std::string& fileName)
+: path(fileName),
+  usable(false),
+  readOffset(header.size()),
+  peekOffset(header.size()),
+  peekCount(0),
+  count(0),
+  mutex()
+{
+  usable = scan();
+}
+
+bool Spool::good() const
+{
+  return usable;
+}
+
+const std::string& Spool::fileName() const
+{
+  return path;
+}
+
+bool Spool::scan()
+{
+  std::error_code error;
+  if (!std::filesystem::exists(path, error) || (std::filesystem::file_size(path, error) == 0))
+  {
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream.write(header.data(), header.size());
+    stream.close();
+    if (!stream.good())
+    {
+      std::cerr << "Error: Could not create spool file " << path << "!" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  std::ifstream stream(path, std::ios::binary);
+  std::string buffer(header.size(), '\0');
+  if (!stream.read(buffer.data(), buffer.size()) || (buffer != header))
+  {
+    std::cerr << "Error: " << path << " is not a spool file of the weather "
+              << "information collector!" << std::endl;
+    return false;
+  }
+
+  uint64_t offset = header.size();
+  while (true)
+  {
+    std::string prefix(8, '\0');
+    if (!stream.read(prefix.data(), prefix.size()))
+      break;
+    SpoolReader reader{ prefix, true };
+    const uint64_t length = reader.getUnsigned(4);
+    const uint32_t sum = static_cast<uint32_t>(reader.getUnsigned(4));
+    buffer.resize(length);
+    if (!stream.read(buffer.data(), length) || (checksum(buffer) != sum))
+      break;
+    offset += 8 + length;
+    ++count;
+  } // while
+  stream.close();
+
+  const uint64_t size = std::filesystem::file_size(path, error);
+  if (!error && (size > offset))
+  {
+    std::cerr << "Warning: Spool file " << path << " ends with an incomplete "
+              << "record, the last " << (size - offset) << " byte(s) are "
+              << "discarded." << std::endl;
+    std::filesystem::resize_file(path, offset, error);
+    if (error)
+    {
+      std::cerr << "Error: Could not truncate spool file " << path << "! "
+                << error.message() << std::endl;
+      return false;
+    }
+  }
+  if (count > 0)
+  {
+    std::cout << "Info: Spool file " << path << " contains " << count
+              << " record(s) that will be written to the database." << std::endl;
+  }
+  return true;
+}
+
+bool Spool::append(const std::vector<StorageRecord>& records)
+{
+  std::string data;
+  for (const StorageRecord& record : records)
+  {
+    const std::string content = encode(record);
+    putUnsigned(data, content.size(), 4);
+    putUnsigned(data, checksum(content), 4);
+    data.append(content);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!usable)
+    return false;
+  std::ofstream stream(path, std::ios::binary | std::ios::app);
+  stream.write(data.data(), data.size());
+  stream.close();
+  if (!stream.good())
+  {
+    std::cerr << "Error: Could not write " << records.size() << " record(s) "
+              << "to spool file " << path << "!" << std::endl;
+    return false;
+  }
+  count += records.size();
+  return true;
+}
+
+bool Spool::peek(const std::size_t maxRecords, std::vector<StorageRecord>& records)
+{
+  records.clear();
+  std::lock_guard<std::mutex> lock(mutex);
+  peekOffset = readOffset;
+  peekCount = 0;
+  if (!usable || (count == 0))
+    return usable;
+
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream.seekg(readOffset))
+    return false;
+  const std::size_t wanted = std::min(maxRecords, count);
+  records.reserve(wanted);
+  std::string buffer;
+  while (records.size() < wanted)
+  {
+    std::string prefix(8, '\0');
+    if (!stream.read(prefix.data(), prefix.size()))
+      return false;
+    SpoolReader reader{ prefix, true };
+    const uint64_t length = reader.getUnsigned(4);
+    const uint32_t sum = static_cast<uint32_t>(reader.getUnsigned(4));
+    buffer.resize(length);
+    if (!stream.read(buffer.data(), length) || (checksum(buffer) != sum))
+    {
+      std::cerr << "Error: Spool file " << path << " contains an invalid record!" << std::endl;
+      return false;
+    }
+    StorageRecord record;
+    if (!decode(buffer, record))
+    {
+      std::cerr << "Error: Spool file " << path << " contains a record that "
+                << "cannot be decoded!" << std::endl;
+      return false;
+    }
+    records.push_back(std::move(record));
+    peekOffset += 8 + length;
+  } // while
+  peekCount = records.size();
+  return true;
+}
+
+void Spool::consume()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  readOffset = peekOffset;
+  count -= peekCount;
+  peekCount = 0;
+  if (count == 0)
+  {
+    // Everything is in the database, so the file can start from scratch.
+    std::error_code error;
+    std::filesystem::resize_file(path, header.size(), error);
+    if (error)
+    {
+      std::cerr << "Warning: Could not truncate spool file " << path << "! "
+                << error.message() << std::endl;
+      return;
+    }
+    readOffset = header.size();
+    peekOffset = header.size();
+  }
+}
+
+std::size_t Spool::pending() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return count;
+}
+
+std::string Spool::encode(const StorageRecord& record)
+{
+  std::string out;
+  putString(out, toString(record.api));
+  putUnsigned(out, record.type == DataType::Forecast ? 2 : 1, 1);
+
+  const Location& loc = record.location;
+  const unsigned int locFlags = (loc.hasOwmId() ? 1 : 0)
+      | (loc.hasCoordinates() ? 2 : 0)
+      | (loc.hasName() ? 4 : 0)
+      | (loc.hasCountryCode() ? 8 : 0)
+      | (loc.hasPostcode() ? 16 : 0);
+  putUnsigned(out, locFlags, 1);
+  if (loc.hasOwmId())
+    putUnsigned(out, loc.owmId(), 4);
+  if (loc.hasCoordinates())
+  {
+    putFloat(out, loc.latitude());
+    putFloat(out, loc.longitude());
+  }
+  if (loc.hasName())
+    putString(out, loc.name());
+  if (loc.hasCountryCode())
+    putString(out, loc.countryCode());
+  if (loc.hasPostcode())
+    putString(out, loc.postcode());
+
+  if (record.type == DataType::Forecast)
+  {
+    const Forecast& forecast = record.forecast;
+    putUnsigned(out, forecast.hasJson() ? 1 : 0, 1);
+    putTime(out, forecast.requestTime());
+    if (forecast.hasJson())
+      putString(out, forecast.json());
+    putUnsigned(out, forecast.data().size(), 4);
+    for (const Weather& w : forecast.data())
+    {
+      putWeather(out, w);
+    }
+  }
+  else
+  {
+    putWeather(out, record.weather);
+  }
+  return out;
+}
+
+bool Spool::decode(std::string_view data, StorageRecord& record)
+{
+  SpoolReader in{ data, true };
+  record.api = toApiType(in.getString());
+  const uint64_t type = in.getUnsigned(1);
+  if ((record.api == ApiType::none) || ((type != 1) && (type != 2)))
+    return false;
+  record.type = (type == 2) ? DataType::Forecast : DataType::Current;
+
+  record.location = Location();
+  const uint64_t locFlags = in.getUnsigned(1);
+  if (locFlags & 1)
+    record.location.setOwmId(static_cast<uint32_t>(in.getUnsigned(4)));
+  if (locFlags & 2)
+  {
+    const float lat = in.getFloat();
+    const float lon = in.getFloat();
+    record.location.setCoordinates(lat, lon);
+  }
+  if (locFlags & 4)
+    record.location.setName(in.getString());
+  if (locFlags & 8)
+    record.location.setCountryCode(in.getString());
+  if (locFlags & 16)
+    record.location.setPostcode(in.getString());
+
+  record.weather = Weather();
+  record.forecast = Forecast();
+  if (record.type == DataType::Forecast)
+  {
+    const uint64_t flags = in.getUnsigned(1);
+    record.forecast.setRequestTime(in.getTime());
+    if (flags & 1)
+      record.forecast.setJson(in.getString());
+    const uint64_t elements = in.getUnsigned(4);
+    // Every element needs at least 18 bytes, so a larger number is garbage.
+    if (!in.ok || (elements > in.data.size() / 18))
+      return false;
+    std::vector<Weather> weathers(elements);
+    for (Weather& w : weathers)
+    {
+      getWeather(in, w);
+    }
+    record.forecast.setData(weathers);
+  }
+  else
+  {
+    getWeather(in, record.weather);
+  }
+  return in.ok && in.data.empty();
+}
+
+uint32_t Spool::checksum(std::string_view data)
+{
+  uint32_t hash = 2166136261u;
+  for (const char c : data)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+} // namespace
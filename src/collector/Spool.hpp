@@ -0,0 +1,158 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_SPOOL_HPP
+#define WEATHER_INFORMATION_COLLECTOR_SPOOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "StorageStage.hpp"
+
+namespace wic
+{
+
+/**
+ * Append-only file that keeps collected data which could not be written to
+ * the database, so that it can be written later.
+ *
+ * The file starts with a fixed header, followed by the records. Each record
+ * consists of its length (four bytes, little endian), an FNV-1a checksum of
+ * the content (four bytes, little endian) and the content itself. The content
+ * contains all fields of the weather or forecast data, including the raw JSON.
+ * A record that is incomplete or has a wrong checksum, e.g. because the
+ * program was killed during a write, ends the usable part of the file.
+ */
+class Spool
+{
+  public:
+    /** \brief Constructor. Opens an existing spool file or creates a new one.
+     *
+     * \param fileName  path of the spool file
+     * \remarks Use good() to check whether the file could be opened.
+     */
+    explicit Spool(const std::string& fileName);
+
+
+    Spool(const Spool& other) = delete;
+    Spool(Spool&& other) = delete;
+    Spool& operator=(const Spool& other) = delete;
+    Spool& operator=(Spool&& other) = delete;
+
+
+    /** \brief Checks whether the spool file is usable.
+     *
+     * \return Returns true, if the spool file could be opened or created.
+     */
+    bool good() const;
+
+
+    /** \brief Gets the path of the spool file.
+     *
+     * \return Returns the path of the spool file.
+     */
+    const std::string& fileName() const;
+
+
+    /** \brief Appends records to the end of the spool file.
+     *
+     * \param records  the records to append
+     * \return Returns true, if the records were written to the file.
+     *         Returns false, if an error occurred.
+     */
+    bool append(const std::vector<StorageRecord>& records);
+
+
+    /** \brief Reads the oldest records that have not been consumed yet.
+     *
+     * \param maxRecords  maximum number of records to read
+     * \param records     vector that will receive the records
+     * \return Returns true, if the records could be read.
+     *         Returns false, if an error occurred.
+     * \remarks The records stay in the spool until consume() is called.
+     */
+    bool peek(const std::size_t maxRecords, std::vector<StorageRecord>& records);
+
+
+    /** \brief Marks the records of the latest successful call to peek() as
+     *         consumed. The file is truncated when all records are consumed.
+     */
+    void consume();
+
+
+    /** \brief Gets the number of records that have not been consumed yet.
+     *
+     * \return Returns the number of pending records.
+     */
+    std::size_t pending() const;
+
+
+    /** \brief Encodes a record into the format used by the spool file.
+     *
+     * \param record  the record
+     * \return Returns the encoded record without length and checksum.
+     */
+    static std::string encode(const StorageRecord& record);
+
+
+    /** \brief Decodes a record that was encoded by encode().
+     *
+     * \param data    the encoded data
+     * \param record  variable that will receive the decoded record
+     * \return Returns true, if the data could be decoded.
+     *         Returns false, if the data is invalid.
+     */
+    static bool decode(std::string_view data, StorageRecord& record);
+
+
+    /** \brief header at the start of every spool file */
+    static const std::string header;
+  private:
+    /** \brief Checks the file and counts its records. An invalid tail of
+     *         the file gets cut off.
+     *
+     * \return Returns true, if the file is usable.
+     */
+    bool scan();
+
+
+    /** \brief Calculates the 32 bit FNV-1a hash of some data.
+     *
+     * \param data  the data
+     * \return Returns the hash value.
+     */
+    static uint32_t checksum(std::string_view data);
+
+
+    std::string path; /**< path of the spool file */
+    bool usable; /**< whether the spool file is usable */
+    uint64_t readOffset; /**< position of the oldest unconsumed record */
+    uint64_t peekOffset; /**< position after the records of the last peek() */
+    std::size_t peekCount; /**< number of records of the last peek() */
+    std::size_t count; /**< number of unconsumed records */
+    mutable std::mutex mutex; /**< guards the file and all offsets */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_SPOOL_HPP
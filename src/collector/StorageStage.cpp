@@ -0,0 +1,267 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "StorageStage.hpp"
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "Spool.hpp"
+
+namespace wic
+{
+
+const std::size_t StorageStage::replayBatchSize = 1000;
+
+StorageStage::StorageStage(Writer w, const std::chrono::milliseconds& flushInterval,
+                           const std::size_t flushSz, const std::size_t queueSize,
+                           std::unique_ptr<Spool> sp)
+: writer(std::move(w)),
+  interval(flushInterval),
+  flushSize(flushSz > 0 ? flushSz : 1),
+  capacity(queueSize > 0 ? queueSize : 1),
+  queue(std::deque<StorageRecord>()),
+  mutex(),
+  recordsAvailable(),
+  spaceAvailable(),
+  stopped(false),
+  nearlyFull(false),
+  spooling(false),
+  spool(std::move(sp)),
+  stats(StorageStatistics{ 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                           std::chrono::milliseconds::zero(),
+                           std::chrono::milliseconds::zero(),
+                           std::chrono::milliseconds::zero() }),
+  thread(std::thread())
+{
+  thread = std::thread(&StorageStage::run, this);
+}
+
+StorageStage::~StorageStage()
+{
+  stop();
+}
+
+bool StorageStage::pushWeather(const ApiType api, const Location& location, const Weather& weather)
+{
+  return push(StorageRecord{ api, location, DataType::Current, weather, Forecast() });
+}
+
+bool StorageStage::pushForecast(const ApiType api, const Location& location, const Forecast& forecast)
+{
+  return push(StorageRecord{ api, location, DataType::Forecast, Weather(), forecast });
+}
+
+bool StorageStage::push(StorageRecord&& record)
+{
+  bool flushNow = false;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!stopped && (queue.size() >= capacity) && (spool != nullptr))
+    {
+      if (!spooling)
+      {
+        spooling = true;
+        std::cerr << "Warning: Storage queue is full, collected data is written "
+                  << "to the spool file " << spool->fileName() << " until the "
+                  << "database catches up." << std::endl;
+      }
+      lock.unlock();
+      if (spool->append({ record }))
+      {
+        std::lock_guard<std::mutex> guard(mutex);
+        ++stats.recordsSpooled;
+        return true;
+      }
+      // Spool does not work, so fall back to waiting.
+      lock.lock();
+    }
+    if (!stopped && (queue.size() >= capacity))
+    {
+      ++stats.blockedPushes;
+      spaceAvailable.wait(lock, [this] { return stopped || (queue.size() < capacity); });
+    }
+    if (stopped)
+      return false;
+    queue.push_back(std::move(record));
+    if (queue.size() > stats.maxQueueDepth)
+      stats.maxQueueDepth = queue.size();
+    // Warn once when the queue gets filled up to 80 %, because that means
+    // that the database cannot keep up with the collection.
+    if (!nearlyFull && (queue.size() * 5 >= capacity * 4))
+    {
+      nearlyFull = true;
+      std::cerr << "Warning: Storage queue is nearly full, " << queue.size()
+                << " of " << capacity << " record(s) are waiting for the "
+                << "database." << std::endl;
+    }
+    flushNow = queue.size() >= flushSize;
+  }
+  if (flushNow)
+    recordsAvailable.notify_one();
+  return true;
+}
+
+void StorageStage::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+  }
+  recordsAvailable.notify_all();
+  spaceAvailable.notify_all();
+  if (thread.joinable())
+    thread.join();
+}
+
+StorageStatistics StorageStage::statistics() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  StorageStatistics result = stats;
+  result.queueDepth = queue.size();
+  result.spoolPending = (spool != nullptr) ? spool->pending() : 0;
+  return result;
+}
+
+void StorageStage::printStatistics() const
+{
+  const StorageStatistics s = statistics();
+  std::cout << "Storage statistics: " << s.recordsWritten << " record(s) stored in "
+            << s.flushes << " flush(es), " << s.recordsFailed << " record(s) failed." << std::endl
+            << "  queue depth: " << s.queueDepth << " now, " << s.maxQueueDepth
+            << " at most, " << s.blockedPushes << " blocked push(es)" << std::endl;
+  if (s.flushes > 0)
+  {
+    std::cout << "  flush latency: " << s.lastFlushLatency.count() << " ms latest, "
+              << s.maxFlushLatency.count() << " ms at most, "
+              << s.totalFlushLatency.count() / static_cast<long long int>(s.flushes)
+              << " ms on average" << std::endl;
+  }
+  if (spool != nullptr)
+  {
+    std::cout << "  spool: " << s.recordsSpooled << " record(s) spooled, "
+              << s.recordsReplayed << " record(s) replayed, " << s.spoolPending
+              << " record(s) waiting in " << spool->fileName() << std::endl;
+  }
+}
+
+void StorageStage::run()
+{
+  auto nextFlush = std::chrono::steady_clock::now() + interval;
+  std::vector<StorageRecord> batch;
+  while (true)
+  {
+    bool done = false;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      recordsAvailable.wait_until(lock, nextFlush, [this] { return stopped || (queue.size() >= flushSize); });
+      done = stopped;
+      // Take everything that is queued. When the database lags behind, this
+      // makes the batches larger, which is exactly what helps it catch up.
+      batch.assign(std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.end()));
+      queue.clear();
+      nearlyFull = false;
+      spooling = false;
+    }
+    spaceAvailable.notify_all();
+
+    const bool success = batch.empty() || write(batch, false);
+    if (!success)
+    {
+      // Keep the data in the spool, if possible, so it is not lost.
+      const bool spooled = (spool != nullptr) && spool->append(batch);
+      std::lock_guard<std::mutex> lock(mutex);
+      if (spooled)
+        stats.recordsSpooled += batch.size();
+      else
+        stats.recordsFailed += batch.size();
+    }
+    batch.clear();
+
+    if (done)
+      return;
+    nextFlush = std::chrono::steady_clock::now() + interval;
+    // The database works, so this is a good time to replay spooled records.
+    // Do not wait for the next interval as long as there are more of them.
+    if (success && (spool != nullptr) && replay())
+      nextFlush = std::chrono::steady_clock::now();
+  } // while
+}
+
+bool StorageStage::write(const std::vector<StorageRecord>& records, const bool fromSpool)
+{
+  const auto start = std::chrono::steady_clock::now();
+  bool success = false;
+  try
+  {
+    success = writer(records, fromSpool);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << "Error: Exception while storing collected data: " << ex.what() << std::endl;
+    success = false;
+  }
+  const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++stats.flushes;
+    if (success && fromSpool)
+      stats.recordsReplayed += records.size();
+    else if (success)
+      stats.recordsWritten += records.size();
+    stats.lastFlushLatency = latency;
+    stats.totalFlushLatency += latency;
+    if (latency > stats.maxFlushLatency)
+      stats.maxFlushLatency = latency;
+  }
+  if (!success)
+  {
+    std::cerr << "Error: Could not store " << records.size()
+              << (fromSpool ? " spooled" : " collected") << " record(s) in the database!" << std::endl;
+  }
+  else if (!fromSpool && (latency > interval))
+  {
+    std::cerr << "Warning: Storing " << records.size() << " record(s) took "
+              << latency.count() << " ms, which is longer than the flush "
+              << "interval of " << interval.count() << " ms." << std::endl;
+  }
+  return success;
+}
+
+bool StorageStage::replay()
+{
+  if (spool->pending() == 0)
+    return false;
+
+  std::vector<StorageRecord> records;
+  if (!spool->peek(replayBatchSize, records) || records.empty())
+    return false;
+  if (!write(records, true))
+    return false;
+  spool->consume();
+  const std::size_t pending = spool->pending();
+  if (pending == 0)
+  {
+    std::cout << "Info: All spooled records have been written to the database." << std::endl;
+  }
+  return pending > 0;
+}
+
+} // namespace
@@ -0,0 +1,214 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_STORAGESTAGE_HPP
+#define WEATHER_INFORMATION_COLLECTOR_STORAGESTAGE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../api/Types.hpp"
+#include "../data/Forecast.hpp"
+#include "../data/Location.hpp"
+#include "../data/Weather.hpp"
+
+namespace wic
+{
+
+class Spool;
+
+/** \brief Data of a single collection that waits to be stored. */
+struct StorageRecord
+{
+  ApiType api; /**< API that delivered the data */
+  Location location; /**< location of the data */
+  DataType type; /**< either DataType::Current or DataType::Forecast */
+  Weather weather; /**< current weather data, if type is DataType::Current */
+  Forecast forecast; /**< forecast data, if type is DataType::Forecast */
+}; // struct
+
+/** \brief Snapshot of the metrics of the storage stage. */
+struct StorageStatistics
+{
+  std::size_t queueDepth; /**< number of records that are waiting right now */
+  std::size_t maxQueueDepth; /**< highest number of waiting records so far */
+  uint_least64_t flushes; /**< number of performed flushes */
+  uint_least64_t recordsWritten; /**< number of successfully stored records */
+  uint_least64_t recordsFailed; /**< number of records that could neither be stored nor spooled */
+  uint_least64_t blockedPushes; /**< number of pushes that had to wait for free space */
+  uint_least64_t recordsSpooled; /**< number of records that were written to the spool */
+  uint_least64_t recordsReplayed; /**< number of records that were replayed from the spool */
+  std::size_t spoolPending; /**< number of records that wait in the spool right now */
+  std::chrono::milliseconds lastFlushLatency; /**< duration of the latest flush */
+  std::chrono::milliseconds maxFlushLatency; /**< duration of the slowest flush */
+  std::chrono::milliseconds totalFlushLatency; /**< duration of all flushes */
+}; // struct
+
+/**
+ * Decouples the storage of collected data from the collection. Collection
+ * threads push their data into a bounded queue, and a separate writer thread
+ * flushes the queue to the database in batches. A flush happens when the
+ * queue contains at least flush size records or when the flush interval has
+ * passed since the previous flush, whatever happens first. When the queue is
+ * full, pushes block until the writer has made room again (backpressure).
+ *
+ * If there is a spool, records are written to the spool instead of blocking
+ * pushes or dropping records of failed flushes. The spooled records are
+ * replayed in large batches as soon as the database works again.
+ */
+class StorageStage
+{
+  public:
+    /** \brief Function that stores a batch of records.
+     *
+     * The second parameter is true, if the records are replayed from the
+     * spool. The function returns true, if all records were stored, and false
+     * otherwise.
+     */
+    typedef std::function<bool(const std::vector<StorageRecord>&, const bool)> Writer;
+
+
+    /** \brief maximum number of records that are replayed from the spool at once
+     */
+    static const std::size_t replayBatchSize;
+
+
+    /** \brief Constructor. Starts the writer thread.
+     *
+     * \param writer         function that stores a batch of records
+     * \param flushInterval  maximum time between two flushes
+     * \param flushSize      number of queued records that triggers a flush
+     * \param queueSize      maximum number of records in the queue
+     * \param spool          spool for records that cannot be stored right now,
+     *                       may be null
+     */
+    StorageStage(Writer writer, const std::chrono::milliseconds& flushInterval,
+                 const std::size_t flushSize, const std::size_t queueSize,
+                 std::unique_ptr<Spool> spool = nullptr);
+
+
+    StorageStage(const StorageStage& other) = delete;
+    StorageStage(StorageStage&& other) = delete;
+    StorageStage& operator=(const StorageStage& other) = delete;
+    StorageStage& operator=(StorageStage&& other) = delete;
+
+
+    /** \brief Destructor. Stops the stage after all queued records are flushed.
+     */
+    ~StorageStage();
+
+
+    /** \brief Queues current weather data for storage.
+     *
+     * \param api       the API that delivered the data
+     * \param location  location of the data
+     * \param weather   the weather data
+     * \return Returns true, if the data was queued or spooled.
+     *         Returns false, if the stage has been stopped.
+     * \remarks Blocks while the queue is full and there is no spool.
+     */
+    bool pushWeather(const ApiType api, const Location& location, const Weather& weather);
+
+
+    /** \brief Queues forecast data for storage.
+     *
+     * \param api       the API that delivered the data
+     * \param location  location of the data
+     * \param forecast  the forecast data
+     * \return Returns true, if the data was queued or spooled.
+     *         Returns false, if the stage has been stopped.
+     * \remarks Blocks while the queue is full and there is no spool.
+     */
+    bool pushForecast(const ApiType api, const Location& location, const Forecast& forecast);
+
+
+    /** \brief Flushes all queued records and stops the writer thread.
+     *
+     * \remarks Further pushes will fail after this call.
+     */
+    void stop();
+
+
+    /** \brief Gets the current metrics of the stage.
+     *
+     * \return Returns a snapshot of the metrics.
+     */
+    StorageStatistics statistics() const;
+
+
+    /** \brief Prints the metrics of the stage to the standard output.
+     */
+    void printStatistics() const;
+  private:
+    /** \brief Adds a record to the queue. If the queue is full, the record
+     *         goes to the spool or the call waits until there is room again.
+     *
+     * \param record  the record
+     * \return Returns true, if the record was queued or spooled.
+     */
+    bool push(StorageRecord&& record);
+
+
+    /** \brief Writes a batch of records with the writer and updates the metrics.
+     *
+     * \param records    the records
+     * \param fromSpool  whether the records are replayed from the spool
+     * \return Returns true, if the records were stored.
+     */
+    bool write(const std::vector<StorageRecord>& records, const bool fromSpool);
+
+
+    /** \brief Replays the oldest records of the spool.
+     *
+     * \return Returns true, if there are more records to replay right now.
+     */
+    bool replay();
+
+
+    /** \brief Main loop of the writer thread. */
+    void run();
+
+
+    Writer writer; /**< stores batches of records */
+    std::chrono::milliseconds interval; /**< maximum time between two flushes */
+    std::size_t flushSize; /**< number of records that triggers a flush */
+    std::size_t capacity; /**< maximum number of queued records */
+    std::deque<StorageRecord> queue; /**< records that wait for storage */
+    mutable std::mutex mutex; /**< guards queue, stopped, stats, nearlyFull and spooling */
+    std::condition_variable recordsAvailable; /**< signals new records or a stop to the writer */
+    std::condition_variable spaceAvailable; /**< signals free space to blocked pushes */
+    bool stopped; /**< whether the stage was stopped */
+    bool nearlyFull; /**< whether the high water mark warning was shown */
+    bool spooling; /**< whether the queue is full and pushes go to the spool */
+    std::unique_ptr<Spool> spool; /**< spool for records, may be null */
+    StorageStatistics stats; /**< metrics of the stage */
+    std::thread thread; /**< the writer thread */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_STORAGESTAGE_HPP
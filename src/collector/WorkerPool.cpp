@@ -0,0 +1,138 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "WorkerPool.hpp"
+#include <exception>
+#include <iostream>
+
+namespace wic
+{
+
+WorkerPool::WorkerPool(const unsigned int threads)
+: workers(std::vector<std::thread>()),
+  jobs(std::deque<std::function<void()>>()),
+  mutex(),
+  jobAvailable(),
+  idle(),
+  active(0),
+  stopped(false)
+{
+  const unsigned int count = threads > 0 ? threads : 1;
+  workers.reserve(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    workers.emplace_back(&WorkerPool::work, this);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  stop();
+}
+
+bool WorkerPool::submit(std::function<void()> job)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stopped)
+      return false;
+    jobs.push_back(std::move(job));
+  }
+  jobAvailable.notify_one();
+  return true;
+}
+
+std::size_t WorkerPool::size() const
+{
+  return workers.size();
+}
+
+std::size_t WorkerPool::inFlight() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return jobs.size() + active;
+}
+
+std::size_t WorkerPool::running() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return active;
+}
+
+void WorkerPool::waitUntilIdle()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  idle.wait(lock, [this] { return jobs.empty() && (active == 0); });
+}
+
+void WorkerPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+    jobs.clear();
+  }
+  jobAvailable.notify_all();
+  for (auto& worker : workers)
+  {
+    if (worker.joinable())
+      worker.join();
+  }
+  idle.notify_all();
+}
+
+void WorkerPool::work()
+{
+  while (true)
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      jobAvailable.wait(lock, [this] { return stopped || !jobs.empty(); });
+      if (stopped)
+        return;
+      job = std::move(jobs.front());
+      jobs.pop_front();
+      ++active;
+    }
+
+    try
+    {
+      job();
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << "Error: Uncaught exception in worker thread: "
+                << ex.what() << std::endl;
+    }
+    catch (...)
+    {
+      std::cerr << "Error: Uncaught exception in worker thread!" << std::endl;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      --active;
+    }
+    idle.notify_all();
+  } // while
+}
+
+} // namespace
@@ -0,0 +1,118 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_WORKERPOOL_HPP
+#define WEATHER_INFORMATION_COLLECTOR_WORKERPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wic
+{
+
+/**
+ * Fixed-size pool of worker threads that executes submitted jobs.
+ */
+class WorkerPool
+{
+  public:
+    /** \brief Constructor. Starts the worker threads.
+     *
+     * \param threads  number of worker threads, values below one are treated as one
+     */
+    explicit WorkerPool(const unsigned int threads);
+
+
+    WorkerPool(const WorkerPool& other) = delete;
+    WorkerPool(WorkerPool&& other) = delete;
+    WorkerPool& operator=(const WorkerPool& other) = delete;
+    WorkerPool& operator=(WorkerPool&& other) = delete;
+
+
+    /** \brief Destructor. Stops the pool and waits for all worker threads.
+     */
+    ~WorkerPool();
+
+
+    /** \brief Adds a job to the queue of the pool.
+     *
+     * \param job   the job that shall be executed by one of the workers
+     * \return Returns true, if the job was queued.
+     *         Returns false, if the pool has already been stopped.
+     */
+    bool submit(std::function<void()> job);
+
+
+    /** \brief Gets the number of worker threads in the pool.
+     *
+     * \return Returns the number of worker threads.
+     */
+    std::size_t size() const;
+
+
+    /** \brief Gets the number of jobs that are queued or currently running.
+     *
+     * \return Returns the number of jobs in flight.
+     */
+    std::size_t inFlight() const;
+
+
+    /** \brief Gets the number of jobs that are currently running.
+     *
+     * \return Returns the number of running jobs.
+     */
+    std::size_t running() const;
+
+
+    /** \brief Blocks until there are no more queued or running jobs. This
+     *         includes jobs that are submitted while waiting, e. g. by jobs
+     *         that are still running.
+     */
+    void waitUntilIdle();
+
+
+    /** \brief Stops the pool. Jobs that are already running will be finished,
+     *         but queued jobs that have not been started yet are discarded.
+     *         Blocks until all worker threads have finished.
+     */
+    void stop();
+  private:
+    /** \brief Main loop of a single worker thread.
+     */
+    void work();
+
+
+    std::vector<std::thread> workers; /**< worker threads */
+    std::deque<std::function<void()>> jobs; /**< queued jobs */
+    mutable std::mutex mutex; /**< mutex that guards the job queue and counters */
+    std::condition_variable jobAvailable; /**< signals new jobs or stop request */
+    std::condition_variable idle; /**< signals that a job has finished */
+    std::size_t active; /**< number of jobs that are currently running */
+    bool stopped; /**< whether the pool has been stopped */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_WORKERPOOL_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2019, 2020, 2021, 2023, 2024  Dirk Stolle
+    Copyright (C) 2017, 2019, 2020, 2021, 2023, 2024, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -18,14 +18,18 @@
  -------------------------------------------------------------------------------
 */
 
+#include <filesystem>
 #include <iostream>
 #include <utility>
 #include "../api/Apixu.hpp"
 #include "../conf/Configuration.hpp"
 #include "../db/ConnectionInformation.hpp"
+#include "../db/mariadb/Connection.hpp"
 #include "../db/mariadb/StoreMariaDB.hpp"
 #include "../db/mariadb/client_version.hpp"
 #include "../db/mariadb/guess.hpp"
+#include "../net/Curly.hpp"
+#include "../net/Replay.hpp"
 #include "../net/curl_version.hpp"
 #include "../tasks/TaskManager.hpp"
 #include "../util/SemVer.hpp"
@@ -46,12 +50,21 @@ void showHelp()
             << "                           during the program run. If this option is omitted,\n"
             << "                           then the program will search for the configuration\n"
             << "                           in some predefined locations.\n"
-            << "  -l | --ignore-limits   - Ignore check for API limits during startup.\n"
+            << "  -l | --ignore-limits   - Ignore API request limits, both for the check during\n"
+            << "                           startup and during the data collection.\n"
             << "  --skip-update-check    - Skips the check to determine whether the database\n"
-            << "                           is up to date during program startup.\n";
+            << "                           is up to date during program startup.\n"
+            << "  --record DIR           - Writes the responses of the APIs into fixture files\n"
+            << "                           in the directory DIR, one file per URL pattern.\n"
+            << "                           Those can be served by weather-information-\n"
+            << "                           collector-replay later.\n"
+            << "  --redirect URL         - Sends all requests to the replay server at URL,\n"
+            << "                           e.g. http://127.0.0.1:8080, instead of the APIs.\n"
+            << "                           Intended for load tests only.\n";
 }
 
-std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& configurationFile, bool& checkApiLimits, bool& skipUpdateCheck)
+std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& configurationFile, bool& checkApiLimits, bool& skipUpdateCheck,
+                                    std::string& recordDirectory, std::string& redirectUrl)
 {
   if ((argc <= 1) || (argv == nullptr))
     return std::make_pair(0, false);
@@ -117,6 +130,56 @@ std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& co
       }
       skipUpdateCheck = true;
     } // if database update check shall be skipped
+    else if (param == "--record")
+    {
+      if (!recordDirectory.empty())
+      {
+        std::cerr << "Error: Fixture directory was already set to "
+                  << recordDirectory << "!\n";
+        return std::make_pair(wic::rcInvalidParameter, true);
+      }
+      // enough parameters?
+      if ((i+1 < argc) && (argv[i+1] != nullptr) && (argv[i+1][0] != '\0'))
+      {
+        recordDirectory = std::string(argv[i+1]);
+        // Skip next parameter, because it's already used as directory.
+        ++i;
+      }
+      else
+      {
+        std::cerr << "Error: You have to enter a directory after \""
+                  << param << "\".\n";
+        return std::make_pair(wic::rcInvalidParameter, true);
+      }
+    } // if responses shall be recorded
+    else if (param == "--redirect")
+    {
+      if (!redirectUrl.empty())
+      {
+        std::cerr << "Error: Replay server was already set to "
+                  << redirectUrl << "!\n";
+        return std::make_pair(wic::rcInvalidParameter, true);
+      }
+      // enough parameters?
+      if ((i+1 < argc) && (argv[i+1] != nullptr))
+      {
+        redirectUrl = std::string(argv[i+1]);
+        // Skip next parameter, because it's already used as URL.
+        ++i;
+      }
+      else
+      {
+        std::cerr << "Error: You have to enter an URL after \""
+                  << param << "\".\n";
+        return std::make_pair(wic::rcInvalidParameter, true);
+      }
+      if ((redirectUrl.find("http://") != 0) && (redirectUrl.find("https://") != 0))
+      {
+        std::cerr << "Error: The URL after \"" << param << "\" has to start "
+                  << "with http:// or https://.\n";
+        return std::make_pair(wic::rcInvalidParameter, true);
+      }
+    } // if requests shall be redirected
     else
     {
       std::cerr << "Error: Unknown parameter " << param << "!\n"
@@ -125,6 +188,20 @@ std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& co
     }
   } // for i
 
+  if (!recordDirectory.empty() && !redirectUrl.empty())
+  {
+    std::cerr << "Error: Parameters --record and --redirect cannot be used "
+              << "at the same time!\n";
+    return std::make_pair(wic::rcInvalidParameter, true);
+  }
+  std::error_code error;
+  if (!recordDirectory.empty() && !std::filesystem::is_directory(recordDirectory, error))
+  {
+    std::cerr << "Error: The fixture directory " << recordDirectory
+              << " does not exist!\n";
+    return std::make_pair(wic::rcInvalidParameter, true);
+  }
+
   return std::make_pair(0, false);
 }
 
@@ -133,10 +210,20 @@ int main(int argc, char** argv)
   std::string configurationFile; /**< path of configuration file */
   bool checkApiLimits = true; /**< whether to check if tasks exceed API limits */
   bool skipUpdateCheck = false; /**< whether to skip check for up to date DB */
+  std::string recordDirectory; /**< directory for recorded responses */
+  std::string redirectUrl; /**< base URL of the replay server */
 
-  const auto [exitCode, forceExit] = parseArguments(argc, argv, configurationFile, checkApiLimits, skipUpdateCheck);
+  const auto [exitCode, forceExit] = parseArguments(argc, argv, configurationFile, checkApiLimits, skipUpdateCheck,
+                                                    recordDirectory, redirectUrl);
   if (forceExit || (exitCode != 0))
     return exitCode;
+  Replay::setRecordDirectory(recordDirectory);
+  Replay::setRedirect(redirectUrl);
+  if (!redirectUrl.empty())
+  {
+    std::cout << "Warning: All requests are sent to the replay server at "
+              << redirectUrl << " instead of the weather APIs." << std::endl;
+  }
 
   wic::Collector collector;
   {
@@ -206,13 +293,25 @@ int main(int argc, char** argv)
                 << " that the database is up to date." << std::endl;
     }
 
-    if (!collector.fromConfiguration(config))
+    if (!collector.fromConfiguration(config, checkApiLimits))
     {
       std::cerr << "Error: Could not transfer configuration data to collector!\n";
       return wic::rcConfigurationError;
     }
   } // end of scope for configuration
 
+  // The worker threads of the collector use cURL and MariaDB concurrently, so
+  // both libraries have to be initialized before any thread is started.
+  if (!Curly::globalInit())
+  {
+    std::cerr << "Error: Could not initialize cURL library!\n";
+    return wic::rcInputOutputError;
+  }
+  if (!wic::db::mariadb::Connection::libraryInit())
+  {
+    return wic::rcDatabaseError;
+  }
+
   /* collect() currently starts an endless loop that cannot be interrupted by
      the user, yet. Future versions might use something like signal handling
      (as in SIGINT or SIGTERM) to stop the collection.
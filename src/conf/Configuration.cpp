@@ -35,6 +35,28 @@ namespace wic
 // use same comment character as in task files: '#'
 const char Configuration::commentCharacter = '#';
 
+const unsigned int Configuration::defaultCollectorThreads = 4;
+
+const unsigned int Configuration::defaultCollectorBatchSize = 20;
+
+const unsigned int Configuration::defaultCollectorBatchWindow = 15;
+
+const unsigned int Configuration::defaultCollectorConnectionsPerHost = 4;
+
+const unsigned int Configuration::defaultCollectorPrewarmTime = 500;
+
+const unsigned int Configuration::defaultCollectorConnectTimeout = 10;
+
+const unsigned int Configuration::defaultCollectorRequestTimeout = 60;
+
+const unsigned int Configuration::defaultCollectorStallTimeout = 30;
+
+const unsigned int Configuration::defaultStorageFlushInterval = 5;
+
+const unsigned int Configuration::defaultStorageFlushSize = 100;
+
+const unsigned int Configuration::defaultStorageQueueSize = 10000;
+
 Configuration::Configuration()
 :
   #ifndef wic_no_tasks_in_config
@@ -46,7 +68,21 @@ Configuration::Configuration()
   planWs(PlanWeatherstack::none),
   connInfo(ConnectionInformation("", "", "", "", 0)),
   tasksDirectory(""),
-  tasksExtension("")
+  tasksExtension(""),
+  threads(0),
+  batchSize(0),
+  batchWindow(-1),
+  connectionsPerHost(0),
+  http2(-1),
+  prewarmTime(-1),
+  connectTimeout(-1),
+  requestTimeout(-1),
+  stallTimeout(-1),
+  openMeteoUnixTime(-1),
+  flushInterval(0),
+  flushSize(0),
+  queueSize(0),
+  spoolFile(std::string())
 {
 }
 
@@ -133,6 +169,76 @@ PlanWeatherstack Configuration::planWeatherstack() const
   return planWs;
 }
 
+unsigned int Configuration::collectorThreads() const
+{
+  return threads == 0 ? defaultCollectorThreads : threads;
+}
+
+unsigned int Configuration::collectorBatchSize() const
+{
+  return batchSize == 0 ? defaultCollectorBatchSize : batchSize;
+}
+
+std::chrono::seconds Configuration::collectorBatchWindow() const
+{
+  return std::chrono::seconds(batchWindow < 0 ? defaultCollectorBatchWindow : batchWindow);
+}
+
+unsigned int Configuration::collectorConnectionsPerHost() const
+{
+  return connectionsPerHost == 0 ? defaultCollectorConnectionsPerHost : connectionsPerHost;
+}
+
+bool Configuration::collectorHttp2() const
+{
+  return http2 != 0;
+}
+
+std::chrono::milliseconds Configuration::collectorPrewarmTime() const
+{
+  return std::chrono::milliseconds(prewarmTime < 0 ? defaultCollectorPrewarmTime : prewarmTime);
+}
+
+std::chrono::seconds Configuration::collectorConnectTimeout() const
+{
+  return std::chrono::seconds(connectTimeout < 0 ? defaultCollectorConnectTimeout : connectTimeout);
+}
+
+std::chrono::seconds Configuration::collectorRequestTimeout() const
+{
+  return std::chrono::seconds(requestTimeout < 0 ? defaultCollectorRequestTimeout : requestTimeout);
+}
+
+std::chrono::seconds Configuration::collectorStallTimeout() const
+{
+  return std::chrono::seconds(stallTimeout < 0 ? defaultCollectorStallTimeout : stallTimeout);
+}
+
+bool Configuration::collectorOpenMeteoUnixTime() const
+{
+  return openMeteoUnixTime > 0;
+}
+
+std::chrono::seconds Configuration::storageFlushInterval() const
+{
+  return std::chrono::seconds(flushInterval == 0 ? defaultStorageFlushInterval : flushInterval);
+}
+
+unsigned int Configuration::storageFlushSize() const
+{
+  return flushSize == 0 ? defaultStorageFlushSize : flushSize;
+}
+
+unsigned int Configuration::storageQueueSize() const
+{
+  return queueSize == 0 ? defaultStorageQueueSize : queueSize;
+}
+
+const std::string& Configuration::storageSpoolFile() const
+{
+  return spoolFile;
+}
+
 void Configuration::findConfigurationFile(std::string& realName)
 {
   namespace fs = std::filesystem;
@@ -404,6 +510,241 @@ bool Configuration::loadCoreConfigurationValue(const std::string& name, const st
     }
     planWs = plan;
   } // if plan.weatherstack
+  else if ((name == "collector.threads") || (name == "collector.workers"))
+  {
+    if (threads != 0)
+    {
+      std::cerr << "Error: Number of collector threads is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int count = -1;
+    if (!stringToInt(value, count) || (count < 1) || (count > 256))
+    {
+      std::cerr << "Error: Number of collector threads in file " << fileName
+                << " must be an integer within the range [1;256]!" << std::endl;
+      return false;
+    }
+    threads = static_cast<unsigned int>(count);
+  } // if collector.threads
+  else if (name == "collector.batch_size")
+  {
+    if (batchSize != 0)
+    {
+      std::cerr << "Error: Collector batch size is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int count = -1;
+    if (!stringToInt(value, count) || (count < 1) || (count > 100))
+    {
+      std::cerr << "Error: Collector batch size in file " << fileName
+                << " must be an integer within the range [1;100]!" << std::endl;
+      return false;
+    }
+    batchSize = static_cast<unsigned int>(count);
+  } // if collector.batch_size
+  else if (name == "collector.batch_window")
+  {
+    if (batchWindow >= 0)
+    {
+      std::cerr << "Error: Collector batch window is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int seconds = -1;
+    if (!stringToInt(value, seconds) || (seconds < 0) || (seconds > 3600))
+    {
+      std::cerr << "Error: Collector batch window in file " << fileName
+                << " must be an integer within the range [0;3600]!" << std::endl;
+      return false;
+    }
+    batchWindow = seconds;
+  } // if collector.batch_window
+  else if (name == "collector.connections_per_host")
+  {
+    if (connectionsPerHost != 0)
+    {
+      std::cerr << "Error: Collector connections per host are specified more "
+                << "than once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int count = -1;
+    if (!stringToInt(value, count) || (count < 1) || (count > 100))
+    {
+      std::cerr << "Error: Collector connections per host in file " << fileName
+                << " must be an integer within the range [1;100]!" << std::endl;
+      return false;
+    }
+    connectionsPerHost = static_cast<unsigned int>(count);
+  } // if collector.connections_per_host
+  else if (name == "collector.http2")
+  {
+    if (http2 >= 0)
+    {
+      std::cerr << "Error: Use of HTTP/2 is specified more than once in file "
+                << fileName << "!" << std::endl;
+      return false;
+    }
+    if (value == "true")
+      http2 = 1;
+    else if (value == "false")
+      http2 = 0;
+    else
+    {
+      std::cerr << "Error: Value of collector.http2 in file " << fileName
+                << " must be either true or false!" << std::endl;
+      return false;
+    }
+  } // if collector.http2
+  else if (name == "collector.prewarm_time")
+  {
+    if (prewarmTime >= 0)
+    {
+      std::cerr << "Error: Pre-warm time of connections is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int millis = -1;
+    if (!stringToInt(value, millis) || (millis < 0) || (millis > 60000))
+    {
+      std::cerr << "Error: Pre-warm time of connections in file " << fileName
+                << " must be an integer within the range [0;60000]!" << std::endl;
+      return false;
+    }
+    prewarmTime = millis;
+  } // if collector.prewarm_time
+  else if (name == "collector.connect_timeout")
+  {
+    if (connectTimeout >= 0)
+    {
+      std::cerr << "Error: Connect timeout is specified more than once in file "
+                << fileName << "!" << std::endl;
+      return false;
+    }
+    int seconds = -1;
+    if (!stringToInt(value, seconds) || (seconds < 1) || (seconds > 300))
+    {
+      std::cerr << "Error: Connect timeout in file " << fileName
+                << " must be an integer within the range [1;300]!" << std::endl;
+      return false;
+    }
+    connectTimeout = seconds;
+  } // if collector.connect_timeout
+  else if (name == "collector.request_timeout")
+  {
+    if (requestTimeout >= 0)
+    {
+      std::cerr << "Error: Request timeout is specified more than once in file "
+                << fileName << "!" << std::endl;
+      return false;
+    }
+    int seconds = -1;
+    if (!stringToInt(value, seconds) || (seconds < 0) || (seconds > 3600))
+    {
+      std::cerr << "Error: Request timeout in file " << fileName
+                << " must be an integer within the range [0;3600]!" << std::endl;
+      return false;
+    }
+    requestTimeout = seconds;
+  } // if collector.request_timeout
+  else if (name == "collector.stall_timeout")
+  {
+    if (stallTimeout >= 0)
+    {
+      std::cerr << "Error: Stall timeout is specified more than once in file "
+                << fileName << "!" << std::endl;
+      return false;
+    }
+    int seconds = -1;
+    if (!stringToInt(value, seconds) || (seconds < 0) || (seconds > 3600))
+    {
+      std::cerr << "Error: Stall timeout in file " << fileName
+                << " must be an integer within the range [0;3600]!" << std::endl;
+      return false;
+    }
+    stallTimeout = seconds;
+  } // if collector.stall_timeout
+  else if (name == "collector.openmeteo_unixtime")
+  {
+    if (openMeteoUnixTime >= 0)
+    {
+      std::cerr << "Error: Time format of Open-Meteo is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    if (value == "true")
+      openMeteoUnixTime = 1;
+    else if (value == "false")
+      openMeteoUnixTime = 0;
+    else
+    {
+      std::cerr << "Error: Value of collector.openmeteo_unixtime in file "
+                << fileName << " must be either true or false!" << std::endl;
+      return false;
+    }
+  } // if collector.openmeteo_unixtime
+  else if (name == "storage.flush_interval")
+  {
+    if (flushInterval != 0)
+    {
+      std::cerr << "Error: Storage flush interval is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int seconds = -1;
+    if (!stringToInt(value, seconds) || (seconds < 1) || (seconds > 3600))
+    {
+      std::cerr << "Error: Storage flush interval in file " << fileName
+                << " must be an integer within the range [1;3600]!" << std::endl;
+      return false;
+    }
+    flushInterval = static_cast<unsigned int>(seconds);
+  } // if storage.flush_interval
+  else if (name == "storage.flush_size")
+  {
+    if (flushSize != 0)
+    {
+      std::cerr << "Error: Storage flush size is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int count = -1;
+    if (!stringToInt(value, count) || (count < 1) || (count > 10000))
+    {
+      std::cerr << "Error: Storage flush size in file " << fileName
+                << " must be an integer within the range [1;10000]!" << std::endl;
+      return false;
+    }
+    flushSize = static_cast<unsigned int>(count);
+  } // if storage.flush_size
+  else if (name == "storage.queue_size")
+  {
+    if (queueSize != 0)
+    {
+      std::cerr << "Error: Storage queue size is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    int count = -1;
+    if (!stringToInt(value, count) || (count < 1) || (count > 1000000))
+    {
+      std::cerr << "Error: Storage queue size in file " << fileName
+                << " must be an integer within the range [1;1000000]!" << std::endl;
+      return false;
+    }
+    queueSize = static_cast<unsigned int>(count);
+  } // if storage.queue_size
+  else if (name == "storage.spool_file")
+  {
+    if (!spoolFile.empty())
+    {
+      std::cerr << "Error: Storage spool file is specified more than "
+                << "once in file " << fileName << "!" << std::endl;
+      return false;
+    }
+    spoolFile = value;
+  } // if storage.spool_file
   else
   {
     std::cerr << "Error while reading configuration file " << fileName
@@ -621,6 +962,20 @@ void Configuration::clear()
   connInfo.clear();
   tasksDirectory.erase();
   tasksExtension.erase();
+  threads = 0;
+  batchSize = 0;
+  batchWindow = -1;
+  connectionsPerHost = 0;
+  http2 = -1;
+  prewarmTime = -1;
+  connectTimeout = -1;
+  requestTimeout = -1;
+  stallTimeout = -1;
+  openMeteoUnixTime = -1;
+  flushInterval = 0;
+  flushSize = 0;
+  queueSize = 0;
+  spoolFile.erase();
 }
 
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,7 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_CONFIGURATION_HPP
 #define WEATHER_INFORMATION_COLLECTOR_CONFIGURATION_HPP
 
+#include <chrono>
 #include <map>
 #include <vector>
 #include "../api/Plans.hpp"
@@ -60,6 +61,65 @@ class Configuration
     static std::vector<std::string> potentialTaskDirectories();
 
 
+    /** \brief default number of worker threads used by the collector
+     */
+    static const unsigned int defaultCollectorThreads;
+
+
+    /** \brief default maximum number of locations in one batched request
+     */
+    static const unsigned int defaultCollectorBatchSize;
+
+
+    /** \brief default time in seconds that the collector looks ahead for tasks
+     *         that can be added to a batched request
+     */
+    static const unsigned int defaultCollectorBatchWindow;
+
+
+    /** \brief default maximum number of simultaneous connections to a single
+     *         API host
+     */
+    static const unsigned int defaultCollectorConnectionsPerHost;
+
+
+    /** \brief default time in milliseconds before a due task when the
+     *         connection to its API is set up
+     */
+    static const unsigned int defaultCollectorPrewarmTime;
+
+
+    /** \brief default maximum time in seconds to set up a connection
+     */
+    static const unsigned int defaultCollectorConnectTimeout;
+
+
+    /** \brief default maximum time in seconds of a whole request
+     */
+    static const unsigned int defaultCollectorRequestTimeout;
+
+
+    /** \brief default time in seconds after which a request without received
+     *         data is aborted
+     */
+    static const unsigned int defaultCollectorStallTimeout;
+
+
+    /** \brief default maximum time in seconds between two writes of collected data
+     */
+    static const unsigned int defaultStorageFlushInterval;
+
+
+    /** \brief default number of collected records that triggers a write
+     */
+    static const unsigned int defaultStorageFlushSize;
+
+
+    /** \brief default maximum number of collected records waiting to be written
+     */
+    static const unsigned int defaultStorageQueueSize;
+
+
     /** \brief Gets the connection information.
      *
      * \return Returns the database connection information.
@@ -120,6 +180,117 @@ class Configuration
     PlanWeatherstack planWeatherstack() const;
 
 
+    /** \brief Gets the number of worker threads the collector shall use.
+     *
+     * \return Returns the number of worker threads for data collection.
+     */
+    unsigned int collectorThreads() const;
+
+
+    /** \brief Gets the maximum number of locations the collector shall request
+     *         with a single batched request.
+     *
+     * \return Returns the maximum batch size. One means no batching.
+     */
+    unsigned int collectorBatchSize() const;
+
+
+    /** \brief Gets the time span in which tasks that are due later may be added
+     *         to a batched request.
+     *
+     * \return Returns the batch window of the collector.
+     */
+    std::chrono::seconds collectorBatchWindow() const;
+
+
+    /** \brief Gets the maximum number of simultaneous connections that the
+     *         collector may open to a single host.
+     *
+     * \return Returns the maximum number of connections per host.
+     */
+    unsigned int collectorConnectionsPerHost() const;
+
+
+    /** \brief Checks whether the collector uses HTTP/2, so that simultaneous
+     *         requests to the same host share a single connection.
+     *
+     * \return Returns true, if HTTP/2 shall be used. That is the default.
+     */
+    bool collectorHttp2() const;
+
+
+    /** \brief Gets the time before a task is due when the collector sets up
+     *         the connection to the API of the task.
+     *
+     * \return Returns the lead time of the pre-warming of connections.
+     *         Zero means that connections are not pre-warmed.
+     */
+    std::chrono::milliseconds collectorPrewarmTime() const;
+
+
+    /** \brief Gets the maximum time that the setup of a connection may take.
+     *
+     * \return Returns the connect timeout of the requests.
+     */
+    std::chrono::seconds collectorConnectTimeout() const;
+
+
+    /** \brief Gets the maximum time that a whole request may take.
+     *
+     * \return Returns the timeout of the requests.
+     *         Zero means that the duration of requests is not limited.
+     */
+    std::chrono::seconds collectorRequestTimeout() const;
+
+
+    /** \brief Gets the time after which a request is aborted, if it does
+     *         not receive any data.
+     *
+     * \return Returns the stall timeout of the requests.
+     *         Zero means that stalled requests are not aborted.
+     */
+    std::chrono::seconds collectorStallTimeout() const;
+
+
+    /** \brief Indicates whether the collector requests Open-Meteo data with
+     *         Unix timestamps instead of ISO 8601 times.
+     *
+     * \return Returns true, if Unix timestamps shall be requested.
+     */
+    bool collectorOpenMeteoUnixTime() const;
+
+
+    /** \brief Gets the maximum time between two writes of collected data.
+     *
+     * \return Returns the flush interval of the storage stage.
+     */
+    std::chrono::seconds storageFlushInterval() const;
+
+
+    /** \brief Gets the number of collected records that triggers a write.
+     *
+     * \return Returns the flush size of the storage stage.
+     */
+    unsigned int storageFlushSize() const;
+
+
+    /** \brief Gets the maximum number of collected records that may wait for
+     *         being written to the database.
+     *
+     * \return Returns the queue size of the storage stage.
+     */
+    unsigned int storageQueueSize() const;
+
+
+    /** \brief Gets the path of the spool file for collected data that cannot
+     *         be written to the database right away.
+     *
+     * \return Returns the path of the spool file.
+     *         Returns an empty string, if no spool file shall be used.
+     */
+    const std::string& storageSpoolFile() const;
+
+
     /** \brief Loads the configuration from a file.
      *
      * \param  fileName   file name of the configuration file
@@ -177,6 +348,20 @@ class Configuration
     ConnectionInformation connInfo; /**< database connection information */
     std::string tasksDirectory; /**< directory for tasks */
     std::string tasksExtension; /**< file extension (incl. dot) for task files */
+    unsigned int threads; /**< number of collector worker threads, zero means not set */
+    unsigned int batchSize; /**< maximum batch size, zero means not set */
+    int batchWindow; /**< batch window in seconds, negative means not set */
+    unsigned int connectionsPerHost; /**< connections per host, zero means not set */
+    int http2; /**< whether to use HTTP/2 (1) or not (0), negative means not set */
+    int prewarmTime; /**< pre-warm lead time in milliseconds, negative means not set */
+    int connectTimeout; /**< connect timeout in seconds, negative means not set */
+    int requestTimeout; /**< request timeout in seconds, negative means not set */
+    int stallTimeout; /**< stall timeout in seconds, negative means not set */
+    int openMeteoUnixTime; /**< whether Open-Meteo requests get Unix timestamps (1) or not (0), negative means not set */
+    unsigned int flushInterval; /**< storage flush interval in seconds, zero means not set */
+    unsigned int flushSize; /**< storage flush size, zero means not set */
+    unsigned int queueSize; /**< storage queue size, zero means not set */
+    std::string spoolFile; /**< path of the spool file, empty means no spool */
 }; // class
 
 } // namespace
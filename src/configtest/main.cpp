@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2020, 2021, 2023, 2024  Dirk Stolle
+    Copyright (C) 2017, 2020, 2021, 2023, 2024, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,7 @@
 #include <utility>
 #include "../conf/Configuration.hpp"
 #include "../db/ConnectionInformation.hpp"
+#include "../tasks/Phases.hpp"
 #include "../tasks/TaskManager.hpp"
 #include "../ReturnCodes.hpp"
 #include "../Version.hpp"
@@ -39,10 +40,12 @@ void showHelp()
             << "                           during the program run. If this option is omitted,\n"
             << "                           then the program will search for the configuration\n"
             << "                           in some predefined locations.\n"
-            << "  -l | --ignore-limits   - Ignore check for API limits during startup.\n";
+            << "  -l | --ignore-limits   - Ignore check for API limits during startup.\n"
+            << "  -r | --request-rates   - Shows the request rates per API that result from the\n"
+            << "                           staggered start of the configured tasks.\n";
 }
 
-std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& configurationFile, bool& checkApiLimits)
+std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& configurationFile, bool& checkApiLimits, bool& showRequestRates)
 {
   if ((argc <= 1) || (argv == nullptr))
     return std::make_pair(0, false);
@@ -97,6 +100,15 @@ std::pair<int, bool> parseArguments(const int argc, char** argv, std::string& co
       }
       checkApiLimits = false;
     } // if help
+    else if ((param == "--request-rates") || (param == "-r"))
+    {
+      if (showRequestRates)
+      {
+        std::cerr << "Error: Parameter " << param << " was already specified!\n";
+        return std::make_pair(wic::rcInvalidParameter, true);
+      }
+      showRequestRates = true;
+    } // if request rates
     else
     {
       std::cerr << "Error: Unknown parameter " << param << "!\n"
@@ -112,8 +124,9 @@ int main(int argc, char** argv)
 {
   std::string configurationFile; /**< path of configuration file */
   bool checkApiLimits = true; /**< whether to check if tasks exceed API limits */
+  bool showRequestRates = false; /**< whether to show request rates per API */
 
-  const auto [exitCode, forceExit] = parseArguments(argc, argv, configurationFile, checkApiLimits);
+  const auto [exitCode, forceExit] = parseArguments(argc, argv, configurationFile, checkApiLimits, showRequestRates);
   if (forceExit || (exitCode != 0))
     return exitCode;
 
@@ -147,6 +160,14 @@ int main(int argc, char** argv)
     return wic::rcTasksExceedApiRequestLimit;
   } // if check shall be performed and failed
 
+  if (showRequestRates)
+  {
+    // The collector merges some tasks, so do the same here.
+    std::vector<wic::Task> tasks = config.tasks();
+    wic::TaskManager::coalesce(tasks, config.planWeatherbit(), config.planWeatherstack());
+    wic::Phases::showRates(wic::Phases::rates(tasks, wic::Phases::offsets(tasks)));
+  }
+
   std::cout << "OK." << std::endl;
   return 0;
 }
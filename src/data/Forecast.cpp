@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2018, 2019, 2021  Dirk Stolle
+    Copyright (C) 2018, 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,13 +19,14 @@
 */
 
 #include "Forecast.hpp"
+#include <utility>
 
 namespace wic
 {
 
 Forecast::Forecast()
 : m_requestTime(std::chrono::time_point<std::chrono::system_clock>()),
-  m_json(std::string("")),
+  m_json(nullptr),
   m_forecast(std::vector<Weather>())
 {
 }
@@ -47,17 +48,26 @@ const std::chrono::time_point<std::chrono::system_clock>& Forecast::requestTime(
 
 bool Forecast::hasJson() const
 {
-  return !m_json.empty();
+  return (m_json != nullptr) && !m_json->empty();
 }
 
 const std::string& Forecast::json() const
 {
-  return m_json;
+  static const std::string empty;
+  return m_json != nullptr ? *m_json : empty;
 }
 
-void Forecast::setJson(const std::string_view newJson)
+void Forecast::setJson(std::string newJson)
 {
-  m_json = newJson;
+  if (newJson.empty())
+    m_json = nullptr;
+  else
+    m_json = std::make_shared<const std::string>(std::move(newJson));
+}
+
+void Forecast::setJson(std::shared_ptr<const std::string> newJson)
+{
+  m_json = std::move(newJson);
 }
 
 const std::vector<Weather>& Forecast::data() const
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2018, 2019, 2021  Dirk Stolle
+    Copyright (C) 2018, 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,8 +22,8 @@
 #define WEATHER_INFORMATION_COLLECTOR_FORECAST_HPP
 
 #include <chrono>
+#include <memory>
 #include <string>
-#include <string_view>
 #include <vector>
 #include "Weather.hpp"
 
@@ -82,8 +82,19 @@ class Forecast
     /** \brief Sets the raw JSON data.
      *
      * \param newJson  the new JSON data
+     * \remarks Pass a temporary or use std::move() to take over the data of a
+     *          string without copying it, e. g. the response of a request.
      */
-    void setJson(const std::string_view newJson);
+    void setJson(std::string newJson);
+
+
+    /** \brief Sets the raw JSON data to data that may be shared with other
+     * instances, e. g. when current weather data and forecast data are parsed
+     * from the same response.
+     *
+     * \param newJson  the new JSON data, may be nullptr to remove the JSON data
+     */
+    void setJson(std::shared_ptr<const std::string> newJson);
 
 
     /** \brief Gets the weather forecast data of this instance.
@@ -120,7 +131,7 @@ class Forecast
     #endif // wic_weather_comparison
   private:
     std::chrono::time_point<std::chrono::system_clock> m_requestTime; /**< time when the API request was performed */
-    std::string m_json; /**< raw JSON data */
+    std::shared_ptr<const std::string> m_json; /**< raw JSON data, may be shared with other instances */
     std::vector<Weather> m_forecast; /**< weather forecast data */
 }; // class
 
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,7 @@
 #include "Weather.hpp"
 #include <cmath>
 #include <limits>
+#include <utility>
 
 namespace wic
 {
@@ -38,7 +39,7 @@ Weather::Weather()
   m_windSpeed(std::numeric_limits<float>::quiet_NaN()),
   m_windDegrees(-1),
   m_cloudiness(-1),
-  m_json(std::string(""))
+  m_json(nullptr)
 {
 }
 
@@ -246,17 +247,26 @@ void Weather::setCloudiness(const int8_t newCloudiness)
 
 bool Weather::hasJson() const
 {
-  return !m_json.empty();
+  return (m_json != nullptr) && !m_json->empty();
 }
 
 const std::string& Weather::json() const
 {
-  return m_json;
+  static const std::string empty;
+  return m_json != nullptr ? *m_json : empty;
 }
 
-void Weather::setJson(const std::string_view newJson)
+void Weather::setJson(std::string newJson)
 {
-  m_json = newJson;
+  if (newJson.empty())
+    m_json = nullptr;
+  else
+    m_json = std::make_shared<const std::string>(std::move(newJson));
+}
+
+void Weather::setJson(std::shared_ptr<const std::string> newJson)
+{
+  m_json = std::move(newJson);
 }
 
 #ifdef wic_weather_comparison
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,8 +23,8 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
-#include <string_view>
 
 namespace wic
 {
@@ -333,8 +333,19 @@ class Weather
     /** \brief Sets the raw JSON data.
      *
      * \param newJson  the new JSON data
+     * \remarks Pass a temporary or use std::move() to take over the data of a
+     *          string without copying it, e. g. the response of a request.
      */
-    void setJson(const std::string_view newJson);
+    void setJson(std::string newJson);
+
+
+    /** \brief Sets the raw JSON data to data that may be shared with other
+     * instances, e. g. when current weather data and forecast data are parsed
+     * from the same response.
+     *
+     * \param newJson  the new JSON data, may be nullptr to remove the JSON data
+     */
+    void setJson(std::shared_ptr<const std::string> newJson);
 
     #ifdef wic_weather_comparison
     /** \brief Equality operator for Weather class.
@@ -367,7 +378,7 @@ class Weather
     float m_windSpeed; /**< wind speed in meters per second */
     int16_t m_windDegrees; /**< wind direction in degrees */
     int8_t m_cloudiness; /**< cloudiness in percent */
-    std::string m_json; /**< raw JSON data */
+    std::shared_ptr<const std::string> m_json; /**< raw JSON data, may be shared with other instances */
 }; // class
 
 } // namespace
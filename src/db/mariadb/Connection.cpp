@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2020, 2021, 2022, 2024  Dirk Stolle
+    Copyright (C) 2020, 2021, 2022, 2024, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -62,6 +62,16 @@ Connection::~Connection()
   }
 }
 
+bool Connection::libraryInit()
+{
+  if (mysql_library_init(0, nullptr, nullptr) != 0)
+  {
+    std::cerr << "Error: Could not initialize MariaDB client library!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 MYSQL* Connection::raw() const
 {
   return conn;
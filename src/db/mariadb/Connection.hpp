@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -61,6 +61,17 @@ class Connection
     /** Destructor. Frees internal resources. */
     ~Connection();
 
+    /** \brief Initializes the MariaDB client library.
+     *
+     * \return Returns true, if the library was initialized successfully.
+     *         Returns false otherwise.
+     * \remarks Programs that create connections from several threads have to
+     *          call this once before the threads are started, because the
+     *          implicit initialization done by the first connection is not
+     *          thread-safe.
+     */
+    static bool libraryInit();
+
     /** \brief Returns the raw connection handle. You should not need to use that directly.
      *
      * \return Returns the raw database connection handle.
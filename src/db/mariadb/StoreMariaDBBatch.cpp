@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,8 @@
 
 #include "StoreMariaDBBatch.hpp"
 #include <iostream>
+#include "API.hpp"
+#include "Result.hpp"
 #include "Utilities.hpp"
 
 namespace wic
@@ -27,9 +29,15 @@ namespace wic
 
 StoreMariaDBBatch::StoreMariaDBBatch(const ConnectionInformation& ci, const unsigned int batchSize)
 : records(0),
+  forecastRecords(0),
   batchLimit(batchSize),
+  inTransaction(false),
+  failed(false),
   conn(ci),
-  insertQuery(std::string())
+  insertQuery(std::string()),
+  forecastQuery(std::string()),
+  apiIds(std::map<ApiType, int_least32_t>()),
+  locationIds(std::vector<std::pair<Location, int_least32_t> >())
 {
 }
 
@@ -40,6 +48,9 @@ StoreMariaDBBatch::~StoreMariaDBBatch()
 
 bool StoreMariaDBBatch::saveCurrentWeather(const int apiId, const int locationId, const Weather& weather)
 {
+  if (failed)
+    return false;
+
   if (records == 0)
   {
     insertQuery = "INSERT INTO weatherdata (apiID, locationID, dataTime, requestTime, "
@@ -150,12 +161,239 @@ bool StoreMariaDBBatch::saveCurrentWeather(const int apiId, const int locationId
   ++records;
 
   if (records >= batchLimit)
-    return commit();
+    return commitWeatherData();
   else
     return true;
 }
 
+bool StoreMariaDBBatch::saveForecast(const int apiId, const int locationId, const Forecast& forecast)
+{
+  if (failed)
+    return false;
+  if (forecast.data().empty())
+  {
+    // No data, nothing to save here.
+    std::cerr << "Error: Forecast data is empty!" << std::endl;
+    return false;
+  }
+
+  // Insert general forecast record.
+  std::string forecastInsert = "INSERT INTO forecast SET apiID=" + conn.quote(std::to_string(apiId))
+            + ", locationID=" + conn.quote(std::to_string(locationId))
+            + ", requestTime=" + conn.quote(forecast.requestTime())
+            + ",json=";
+  if (forecast.hasJson())
+  {
+    forecastInsert += conn.quote(forecast.json()) + ";";
+  }
+  else
+  {
+    forecastInsert += std::string("NULL;");
+  }
+  if (conn.exec(forecastInsert) < 0)
+  {
+    std::cerr << "Error: INSERT of forecast data failed. "
+              << conn.errorInfo() << std::endl;
+    failed = inTransaction;
+    return false;
+  }
+  const std::string forecastId = conn.quote(std::to_string(conn.lastInsertId()));
+
+  // Collect data elements.
+  for (const Weather& weather: forecast.data())
+  {
+    if (forecastRecords == 0)
+    {
+      forecastQuery = "INSERT INTO forecastdata (forecastID, dataTime, "
+                    + std::string("temperature_K, temperature_C, temperature_F, humidity, rain, snow, ")
+                    + "pressure, wind_speed, wind_degrees, cloudiness) VALUES ";
+    }
+    else
+    {
+      forecastQuery.append(", ");
+    }
+    forecastQuery.append("(" + forecastId);
+    // dataTime
+    forecastQuery.append(", " + conn.quote(weather.dataTime()));
+    // temperatures (K, °C, °F)
+    if (weather.hasTemperatureKelvin())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.temperatureKelvin())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasTemperatureCelsius())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.temperatureCelsius())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasTemperatureFahrenheit())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.temperatureFahrenheit())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasHumidity())
+      forecastQuery.append(", " + conn.quote(std::to_string(static_cast<int>(weather.humidity()))));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasRain())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.rain())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasSnow())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.snow())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasPressure())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.pressure())));
+    else
+      forecastQuery.append(", NULL");
+    // wind
+    if (weather.hasWindSpeed())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.windSpeed())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasWindDegrees())
+      forecastQuery.append(", " + conn.quote(std::to_string(weather.windDegrees())));
+    else
+      forecastQuery.append(", NULL");
+    if (weather.hasCloudiness())
+      forecastQuery.append(", " + conn.quote(std::to_string(static_cast<int>(weather.cloudiness()))) + ")");
+    else
+      forecastQuery.append(", NULL)");
+    ++forecastRecords;
+
+    if ((forecastRecords >= batchLimit) && !commitForecastData())
+      return false;
+  } // for (range-based)
+
+  return true;
+}
+
+int_least32_t StoreMariaDBBatch::apiId(const ApiType type)
+{
+  const auto iter = apiIds.find(type);
+  if (iter != apiIds.end())
+    return iter->second;
+
+  const int id = db::API::getId(conn, type);
+  if (id <= 0)
+  {
+    std::cerr << "Error: Could not find database record for API "
+              << toString(type) << "!" << std::endl;
+    return -1;
+  }
+  apiIds[type] = id;
+  return id;
+}
+
+int_least32_t StoreMariaDBBatch::locationId(const Location& location)
+{
+  for (const auto& elem : locationIds)
+  {
+    if (elem.first == location)
+      return elem.second;
+  }
+
+  const int_least32_t id = getLocationId(conn, location);
+  if (id > 0)
+    locationIds.emplace_back(location, id);
+  return id;
+}
+
+bool StoreMariaDBBatch::existingWeather(const std::chrono::time_point<std::chrono::system_clock>& from,
+                                        const std::chrono::time_point<std::chrono::system_clock>& to,
+                                        std::set<RequestKey>& keys)
+{
+  // The data time is indexed, the request time is not.
+  return queryKeys("SELECT apiID, locationID, requestTime FROM weatherdata WHERE dataTime BETWEEN "
+                   + conn.quote(from) + " AND " + conn.quote(to) + ";", keys);
+}
+
+bool StoreMariaDBBatch::existingForecasts(const std::chrono::time_point<std::chrono::system_clock>& from,
+                                          const std::chrono::time_point<std::chrono::system_clock>& to,
+                                          std::set<RequestKey>& keys)
+{
+  return queryKeys("SELECT apiID, locationID, requestTime FROM forecast WHERE requestTime BETWEEN "
+                   + conn.quote(from) + " AND " + conn.quote(to) + ";", keys);
+}
+
+StoreMariaDBBatch::RequestKey StoreMariaDBBatch::key(const int_least32_t apiId, const int_least32_t locationId,
+                                                    const std::chrono::time_point<std::chrono::system_clock>& requestTime)
+{
+  // quote() adds single quotes around the date, but the database returns the
+  // value without them.
+  const std::string quoted = db::mariadb::Connection::quote(requestTime);
+  return RequestKey(apiId, locationId, quoted.substr(1, quoted.size() - 2));
+}
+
+bool StoreMariaDBBatch::queryKeys(const std::string& sql, std::set<RequestKey>& keys)
+{
+  const auto result = conn.query(sql);
+  if (!result.good())
+  {
+    std::cerr << "Failed to get query result: " << conn.errorInfo() << "\n";
+    return false;
+  }
+  for (const auto& row : result.rows())
+  {
+    keys.emplace(row.getInt32(0), row.getInt32(1), row.column(2));
+  }
+  return true;
+}
+
+bool StoreMariaDBBatch::beginTransaction()
+{
+  if (inTransaction)
+    return true;
+  // Statements that are still pending belong to the previous "transaction".
+  if (!commitWeatherData() || !commitForecastData())
+    return false;
+  if (conn.exec("START TRANSACTION;") < 0)
+  {
+    std::cerr << "Error: Could not start transaction! " << conn.errorInfo() << "\n";
+    return false;
+  }
+  inTransaction = true;
+  failed = false;
+  return true;
+}
+
 bool StoreMariaDBBatch::commit()
+{
+  bool success = !failed && commitWeatherData() && commitForecastData();
+  if (!inTransaction)
+    return success;
+
+  if (success)
+  {
+    success = conn.exec("COMMIT;") >= 0;
+    if (!success)
+    {
+      std::cerr << "Error: Could not commit transaction! " << conn.errorInfo() << "\n";
+    }
+  }
+  if (!success)
+  {
+    rollback();
+    return false;
+  }
+  inTransaction = false;
+  return true;
+}
+
+void StoreMariaDBBatch::rollback()
+{
+  records = 0;
+  forecastRecords = 0;
+  if (!inTransaction)
+    return;
+
+  inTransaction = false;
+  failed = false;
+  conn.exec("ROLLBACK;");
+  // Locations may have been inserted during the transaction, so their ids
+  // are not valid anymore.
+  locationIds.clear();
+}
+
+bool StoreMariaDBBatch::commitWeatherData()
 {
   if (records == 0)
     return true;
@@ -165,9 +403,26 @@ bool StoreMariaDBBatch::commit()
   {
     std::cerr << "Could not insert " << records << " record(s) into database!\n"
               << conn.errorInfo() << "\n";
+    failed = inTransaction;
   }
   records = 0;
   return success;
 }
 
+bool StoreMariaDBBatch::commitForecastData()
+{
+  if (forecastRecords == 0)
+    return true;
+
+  const bool success = conn.exec(forecastQuery) > 0;
+  if (!success)
+  {
+    std::cerr << "Error: Forecast data INSERT into database failed. "
+              << conn.errorInfo() << "\n";
+    failed = inTransaction;
+  }
+  forecastRecords = 0;
+  return success;
+}
+
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,7 +21,16 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_STOREMARIADBBATCH_HPP
 #define WEATHER_INFORMATION_COLLECTOR_STOREMARIADBBATCH_HPP
 
+#include <chrono>
+#include <map>
+#include <set>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../../api/Types.hpp"
+#include "../../data/Forecast.hpp"
+#include "../../data/Location.hpp"
 #include "../../data/Weather.hpp"
 #include "Connection.hpp"
 
@@ -32,6 +41,12 @@ namespace wic
 class StoreMariaDBBatch
 {
   public:
+    /** \brief Identifies the data of a single request: API id, location id
+     *         and request time in database format ("YYYY-MM-DD hh:mm:ss").
+     */
+    typedef std::tuple<int_least32_t, int_least32_t, std::string> RequestKey;
+
+
     /** \brief Constructor.
      *
      * \param ci  information for connection to the database
@@ -54,12 +69,144 @@ class StoreMariaDBBatch
      *         Returns false, if an error occurred.
      */
     bool saveCurrentWeather(const int apiId, const int locationId, const Weather& weather);
-  private:
+
+
+    /** \brief Saves a forecast for a given location and API.
+     *
+     * \param apiId       id of the API that was used to gather the information
+     * \param locationId  id of the location for the forecast
+     * \param forecast    forecast information
+     * \return Returns true, if the data was saved.
+     *         Returns false, if an error occurred.
+     * \remarks The general forecast record is inserted immediately, because
+     *          its id is needed for the forecast data. The data itself is
+     *          collected in a multi-row insert statement like the current
+     *          weather data. Use beginTransaction() to make sure that no
+     *          forecast without its data ends up in the database.
+     */
+    bool saveForecast(const int apiId, const int locationId, const Forecast& forecast);
+
+
+    /** \brief Gets the id of an API in the database.
+     *
+     * \param type  the API
+     * \return Returns the id of the API, if it was found.
+     *         Returns -1, if an error occurred.
+     * \remarks Ids are cached, so the database is queried only once per API.
+     */
+    int_least32_t apiId(const ApiType type);
+
+
+    /** \brief Gets the id of a location in the database. The location is
+     *         inserted into the database, if it does not exist yet.
+     *
+     * \param location  the location
+     * \return Returns the id of the location, if it was found or inserted.
+     *         Returns -1, if an error occurred.
+     * \remarks Ids are cached, so the database is queried only once per
+     *          location.
+     */
+    int_least32_t locationId(const Location& location);
+
+
+    /** \brief Gets the requests of current weather data that are already in
+     *         the database.
+     *
+     * \param from  earliest data time of interest
+     * \param to    latest data time of interest
+     * \param keys  set that will receive the keys of the requests
+     * \return Returns true, if the query was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool existingWeather(const std::chrono::time_point<std::chrono::system_clock>& from,
+                         const std::chrono::time_point<std::chrono::system_clock>& to,
+                         std::set<RequestKey>& keys);
+
+
+    /** \brief Gets the requests of forecast data that are already in the
+     *         database.
+     *
+     * \param from  earliest request time of interest
+     * \param to    latest request time of interest
+     * \param keys  set that will receive the keys of the requests
+     * \return Returns true, if the query was successful.
+     *         Returns false, if an error occurred.
+     */
+    bool existingForecasts(const std::chrono::time_point<std::chrono::system_clock>& from,
+                           const std::chrono::time_point<std::chrono::system_clock>& to,
+                           std::set<RequestKey>& keys);
+
+
+    /** \brief Creates the key of a request.
+     *
+     * \param apiId        id of the API
+     * \param locationId   id of the location
+     * \param requestTime  time of the request
+     * \return Returns the key of the request.
+     */
+    static RequestKey key(const int_least32_t apiId, const int_least32_t locationId,
+                          const std::chrono::time_point<std::chrono::system_clock>& requestTime);
+
+
+    /** \brief Starts a transaction that lasts until the next call of commit().
+     *
+     * \return Returns true, if the transaction was started.
+     *         Returns false, if an error occurred.
+     * \remarks Without a transaction every insert statement is committed on
+     *          its own. Within a transaction a failed statement causes all
+     *          data since the start of the transaction to be rolled back.
+     */
+    bool beginTransaction();
+
+
+    /** \brief Executes all pending insert statements and commits an open
+     *         transaction.
+     *
+     * \return Returns true, if all data was saved.
+     *         Returns false, if an error occurred.
+     */
     bool commit();
-    unsigned int records;
-    unsigned int batchLimit;
+
+
+    /** \brief Discards all pending insert statements and rolls back an open
+     *         transaction.
+     */
+    void rollback();
+  private:
+    /** \brief Executes the pending insert statement for current weather data.
+     *
+     * \return Returns true, if the statement succeeded or nothing was pending.
+     */
+    bool commitWeatherData();
+
+
+    /** \brief Executes the pending insert statement for forecast data.
+     *
+     * \return Returns true, if the statement succeeded or nothing was pending.
+     */
+    bool commitForecastData();
+
+
+    /** \brief Executes a query that returns API id, location id and request
+     *         time, and adds the results to a set of keys.
+     *
+     * \param sql   the query
+     * \param keys  set that will receive the keys
+     * \return Returns true, if the query was successful.
+     */
+    bool queryKeys(const std::string& sql, std::set<RequestKey>& keys);
+
+
+    unsigned int records; /**< number of records in insertQuery */
+    unsigned int forecastRecords; /**< number of records in forecastQuery */
+    unsigned int batchLimit; /**< maximum number of records per statement */
+    bool inTransaction; /**< whether a transaction is open */
+    bool failed; /**< whether a statement failed in the open transaction */
     db::mariadb::Connection conn; /**< MariaDB connection */
-    std::string insertQuery;
+    std::string insertQuery; /**< pending insert for current weather data */
+    std::string forecastQuery; /**< pending insert for forecast data */
+    std::map<ApiType, int_least32_t> apiIds; /**< cached API ids */
+    std::vector<std::pair<Location, int_least32_t> > locationIds; /**< cached location ids */
 }; // class
 
 } // namespace
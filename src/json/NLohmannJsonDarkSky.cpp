@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2021  Dirk Stolle
+    Copyright (C) 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 #include "NLohmannJsonDarkSky.hpp"
 #include <iostream>
+#include <memory>
 #include "../util/NumericPrecision.hpp"
 
 namespace wic
@@ -40,7 +41,11 @@ bool NLohmannJsonDarkSky::parseCurrentWeather(const std::string& json, Weather&
   }
 
   weather.setJson(json);
+  return parseCurrentWeatherElement(root, weather);
+}
 
+bool NLohmannJsonDarkSky::parseCurrentWeatherElement(const value_type& root, Weather& weather)
+{
   if (root.empty())
     return false;
 
@@ -70,6 +75,11 @@ bool NLohmannJsonDarkSky::parseForecast(const std::string& json, Forecast& forec
   }
 
   forecast.setJson(json);
+  return parseForecastElement(root, forecast);
+}
+
+bool NLohmannJsonDarkSky::parseForecastElement(const value_type& root, Forecast& forecast)
+{
   if (root.empty())
     return false;
 
@@ -79,14 +89,14 @@ bool NLohmannJsonDarkSky::parseForecast(const std::string& json, Forecast& forec
     std::cerr << "Error in NLohmannJsonDarkSky::parseForecast(): The element \"hourly\" is missing or is not an object!" << std::endl;
     return false;
   }
-  const value_type hourly = *find;
+  const value_type& hourly = *find;
   const auto findData = hourly.find("data");
   if (findData ==  hourly.end() || !findData->is_array())
   {
     std::cerr << "Error in NLohmannJsonDarkSky::parseForecast(): The element \"data\" is missing or is not an array!" << std::endl;
     return false;
   }
-  const value_type hourlyData = *findData;
+  const value_type& hourlyData = *findData;
 
   forecast.setData({ });
   auto data = forecast.data();
@@ -106,6 +116,29 @@ bool NLohmannJsonDarkSky::parseForecast(const std::string& json, Forecast& forec
   return true;
 }
 
+bool NLohmannJsonDarkSky::parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast)
+{
+  value_type root; // will contain the root value after parsing.
+  try
+  {
+    root = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonDarkSky::parseCurrentAndForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  if (!parseCurrentWeatherElement(root, weather) || !parseForecastElement(root, forecast))
+    return false;
+  // Both objects get their data from the same response, so they can share it.
+  const auto shared = std::make_shared<const std::string>(json);
+  weather.setJson(shared);
+  forecast.setJson(shared);
+  return true;
+}
+
 bool NLohmannJsonDarkSky::parseSingleWeatherItem(const value_type& dataPoint, Weather& weather)
 {
   if (dataPoint.empty() || !dataPoint.is_object())
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2021  Dirk Stolle
+    Copyright (C) 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -51,11 +51,44 @@ class NLohmannJsonDarkSky
      *         Returns false, if an error occurred.
      */
     static bool parseForecast(const std::string& json, Forecast& forecast);
+
+
+    /** \brief Parses current weather and forecast information from the same
+     * JSON response into a Weather and a Forecast object. The JSON is only
+     * parsed once, and both objects share the same raw JSON data.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the current weather will be stored
+     * \param forecast variable where the forecast will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast);
   private:
     // alias for type that keeps JSON values / objects / arrays, etc.
     using value_type = nlohmann::json;
 
 
+    /** \brief Parses the current weather from the root element of the JSON.
+     *
+     * \param root     the root element of the JSON
+     * \param weather  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherElement(const value_type& root, Weather& weather);
+
+
+    /** \brief Parses the weather forecast from the root element of the JSON.
+     *
+     * \param root      the root element of the JSON
+     * \param forecast  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseForecastElement(const value_type& root, Forecast& forecast);
+
+
     /** \brief Parses weather data from a single JSON weather item into an
      * instance of Weather class.
      *
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022, 2023  Dirk Stolle
+    Copyright (C) 2022, 2023, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,8 +20,8 @@
 
 #include "NLohmannJsonOpenMeteo.hpp"
 #include <iostream>
+#include <memory>
 #include "OpenMeteoFunctions.hpp"
-#include "../util/NumericPrecision.hpp"
 
 namespace wic
 {
@@ -41,7 +41,48 @@ bool NLohmannJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather
   }
 
   weather.setJson(json);
+  return parseCurrentWeatherElement(root, weather);
+}
 
+bool NLohmannJsonOpenMeteo::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather)
+{
+  nlohmann::json root; // will contain the root value after parsing.
+  try
+  {
+    root = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonOpenMeteo::parseCurrentWeatherBatch(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  if (!root.is_array())
+  {
+    Weather w;
+    w.setJson(json);
+    if (!parseCurrentWeatherElement(root, w))
+      return false;
+    weather.push_back(w);
+    return true;
+  }
+  for (const auto& elem : root)
+  {
+    Weather w;
+    w.setJson(elem.dump());
+    if (!parseCurrentWeatherElement(elem, w))
+      return false;
+    weather.push_back(w);
+  }
+  return true;
+}
+
+bool NLohmannJsonOpenMeteo::parseCurrentWeatherElement(const nlohmann::json& root, Weather& weather)
+{
   if (root.empty())
     return false;
 
@@ -54,7 +95,7 @@ bool NLohmannJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather
               << std::endl;
     return false;
   }
-  nlohmann::json& current_weather = *find;
+  const nlohmann::json& current_weather = *find;
   find = current_weather.find("temperature");
   if (find == current_weather.end() || !find->is_number())
   {
@@ -89,10 +130,29 @@ bool NLohmannJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather
   weather.setWindDegrees(find->get<float>());
 
   find = current_weather.find("time");
+  // Requests with timeformat=unixtime get a Unix timestamp instead of a string.
+  if (find != current_weather.end() && find->is_number_integer())
+  {
+    const auto offset = root.find("utc_offset_seconds");
+    if (offset == root.end() || !offset->is_number_integer())
+    {
+      std::cerr << "Error in NLohmannJsonOpenMeteo::parseCurrentWeather(): JSON "
+                << "element 'utc_offset_seconds' is either missing or not an "
+                << "integer!" << std::endl;
+      return false;
+    }
+    const auto dt = unixTimeToTime(find->get<int64_t>(), offset->get<int64_t>());
+    if (!dt.has_value())
+    {
+      return false;
+    }
+    weather.setDataTime(dt.value());
+    return true;
+  }
   if (find == current_weather.end() || !find->is_string())
   {
     std::cerr << "Error in NLohmannJsonOpenMeteo::parseCurrentWeather(): JSON "
-              << "element 'time' is either missing or not a string!"
+              << "element 'time' is either missing or neither a string nor an integer!"
               << std::endl;
     return false;
   }
@@ -104,11 +164,10 @@ bool NLohmannJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather
   weather.setDataTime(dt.value());
 
   // There is no more data in current weather in Open-Meteo.
-  weather.setJson(json);
   return true;
 }
 
-std::optional<std::string> NLohmannJsonOpenMeteo::hourlyUnitCheck(const nlohmann::json& doc)
+std::optional<std::string> NLohmannJsonOpenMeteo::hourlyUnitCheck(const nlohmann::json& doc, bool& unixTime)
 {
   auto find = doc.find("hourly_units");
   if (find == doc.end() || !find->is_object())
@@ -119,8 +178,10 @@ std::optional<std::string> NLohmannJsonOpenMeteo::hourlyUnitCheck(const nlohmann
   // "time" is usually "iso8601", values are something like "2022-10-12T04:00" then.
   // However, "unixtime" uses Unix timestamps instead.
   find = hourly_units.find("time");
-  if (find == hourly_units.end() || !find->is_string() || find->get<std::string>() != "iso8601")
-    return std::optional("Time format is missing or not in ISO 8601 format.");
+  if (find == hourly_units.end() || !find->is_string()
+      || (find->get<std::string>() != "iso8601" && find->get<std::string>() != "unixtime"))
+    return std::optional("Time format is missing or neither ISO 8601 nor Unix time.");
+  unixTime = find->get<std::string>() == "unixtime";
   // "temperature_2m" should be "°C" for Celsius scale.
   find = hourly_units.find("temperature_2m");
   if (find == hourly_units.end() || !find->is_string() || find->get<std::string>() != "°C")
@@ -166,7 +227,7 @@ std::optional<std::string> NLohmannJsonOpenMeteo::hourlyUnitCheck(const nlohmann
   return std::nullopt;
 }
 
-bool NLohmannJsonOpenMeteo::parseTemperature(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseTemperature(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column)
 {
   const auto find = hourly.find("temperature_2m");
   if (find == hourly.end() || !find->is_array())
@@ -177,14 +238,14 @@ bool NLohmannJsonOpenMeteo::parseTemperature(const nlohmann::json& hourly, std::
     return false;
   }
   const auto temperature = *find;
-  if (temperature.size() != data.size())
+  if (temperature.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.temperature_2m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << temperature.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: temperature)
   {
     if (!elem.is_number())
@@ -193,28 +254,13 @@ bool NLohmannJsonOpenMeteo::parseTemperature(const nlohmann::json& hourly, std::
       return false;
     }
     const double celsius = elem.get<double>();
-    data[idx].setTemperatureCelsius(celsius);
-    data[idx].setTemperatureFahrenheit(celsius * 1.8 + 32.0);
-    // Avoid values like 6.9999... ° F by rounding, if appropriate.
-    const float fahrenheitRounded = NumericPrecision<float>::enforce(data[idx].temperatureFahrenheit());
-    if (fahrenheitRounded != data[idx].temperatureFahrenheit())
-    {
-      data[idx].setTemperatureFahrenheit(fahrenheitRounded);
-    }
-    data[idx].setTemperatureKelvin(celsius + 273.15);
-    // Avoid values like 296.9999... K by rounding, if appropriate.
-    const float kelvinRounded = NumericPrecision<float>::enforce(data[idx].temperatureKelvin());
-    if (kelvinRounded != data[idx].temperatureKelvin())
-    {
-      data[idx].setTemperatureKelvin(kelvinRounded);
-    }
-    ++idx;
+    column.push_back(celsius);
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parseHumidity(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseHumidity(const nlohmann::json& hourly, const std::size_t expected, std::vector<int64_t>& column)
 {
   const auto find = hourly.find("relativehumidity_2m");
   if (find == hourly.end() || !find->is_array())
@@ -225,14 +271,14 @@ bool NLohmannJsonOpenMeteo::parseHumidity(const nlohmann::json& hourly, std::vec
     return false;
   }
   const auto humidity = *find;
-  if (humidity.size() != data.size())
+  if (humidity.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.relativehumidity_2m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << humidity.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: humidity)
   {
     if (!elem.is_number_integer())
@@ -240,14 +286,13 @@ bool NLohmannJsonOpenMeteo::parseHumidity(const nlohmann::json& hourly, std::vec
       std::cerr << "Error: Humidity element is not an integer value!" << std::endl;
       return false;
     }
-    data[idx].setHumidity(elem.get<int>());
-    ++idx;
+    column.push_back(elem.get<int>());
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parseRain(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseRain(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column)
 {
   const auto find = hourly.find("rain");
   if (find == hourly.end() || !find->is_array())
@@ -258,14 +303,14 @@ bool NLohmannJsonOpenMeteo::parseRain(const nlohmann::json& hourly, std::vector<
     return false;
   }
   const auto rain = *find;
-  if (rain.size() != data.size())
+  if (rain.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.rain does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << rain.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: rain)
   {
     if (!elem.is_number())
@@ -273,14 +318,13 @@ bool NLohmannJsonOpenMeteo::parseRain(const nlohmann::json& hourly, std::vector<
       std::cerr << "Error: Rain element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setRain(elem.get<double>());
-    ++idx;
+    column.push_back(elem.get<double>());
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parseSnowfall(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseSnowfall(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column)
 {
   const auto find = hourly.find("snowfall");
   if (find == hourly.end() || !find->is_array())
@@ -291,14 +335,14 @@ bool NLohmannJsonOpenMeteo::parseSnowfall(const nlohmann::json& hourly, std::vec
     return false;
   }
   const auto snowfall = *find;
-  if (snowfall.size() != data.size())
+  if (snowfall.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.snowfall does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << snowfall.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: snowfall)
   {
     if (!elem.is_number())
@@ -306,14 +350,13 @@ bool NLohmannJsonOpenMeteo::parseSnowfall(const nlohmann::json& hourly, std::vec
       std::cerr << "Error: Snowfall element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setSnow(elem.get<double>() / 0.7);
-    ++idx;
+    column.push_back(elem.get<double>());
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parsePressure(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parsePressure(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column)
 {
   const auto find = hourly.find("pressure_msl");
   if (find == hourly.end() || !find->is_array())
@@ -324,14 +367,14 @@ bool NLohmannJsonOpenMeteo::parsePressure(const nlohmann::json& hourly, std::vec
     return false;
   }
   const auto pressure_msl = *find;
-  if (pressure_msl.size() != data.size())
+  if (pressure_msl.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.pressure_msl does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << pressure_msl.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: pressure_msl)
   {
     if (!elem.is_number())
@@ -339,14 +382,13 @@ bool NLohmannJsonOpenMeteo::parsePressure(const nlohmann::json& hourly, std::vec
       std::cerr << "Error: Pressure element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setPressure(elem.get<double>());
-    ++idx;
+    column.push_back(elem.get<double>());
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parseCloudCover(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseCloudCover(const nlohmann::json& hourly, const std::size_t expected, std::vector<int64_t>& column)
 {
   const auto find = hourly.find("cloudcover");
   if (find == hourly.end() || !find->is_array())
@@ -357,14 +399,14 @@ bool NLohmannJsonOpenMeteo::parseCloudCover(const nlohmann::json& hourly, std::v
     return false;
   }
   const auto clouds = *find;
-  if (clouds.size() != data.size())
+  if (clouds.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.cloudcover does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << clouds.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: clouds)
   {
     if (!elem.is_number_integer())
@@ -372,14 +414,13 @@ bool NLohmannJsonOpenMeteo::parseCloudCover(const nlohmann::json& hourly, std::v
       std::cerr << "Error: Cloud cover element is not an integer value!" << std::endl;
       return false;
     }
-    data[idx].setCloudiness(elem.get<int>());
-    ++idx;
+    column.push_back(elem.get<int>());
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parseWindSpeed(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseWindSpeed(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column)
 {
   const auto find = hourly.find("windspeed_10m");
   if (find == hourly.end() || !find->is_array())
@@ -390,14 +431,14 @@ bool NLohmannJsonOpenMeteo::parseWindSpeed(const nlohmann::json& hourly, std::ve
     return false;
   }
   const auto windspeed_10m = *find;
-  if (windspeed_10m.size() != data.size())
+  if (windspeed_10m.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.windspeed_10m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << windspeed_10m.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: windspeed_10m)
   {
     if (!elem.is_number())
@@ -405,14 +446,13 @@ bool NLohmannJsonOpenMeteo::parseWindSpeed(const nlohmann::json& hourly, std::ve
       std::cerr << "Error: Pressure element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setWindSpeed(elem.get<double>());
-    ++idx;
+    column.push_back(elem.get<double>());
   }
 
   return true;
 }
 
-bool NLohmannJsonOpenMeteo::parseWindDirection(const nlohmann::json& hourly, std::vector<Weather>& data)
+bool NLohmannJsonOpenMeteo::parseWindDirection(const nlohmann::json& hourly, const std::size_t expected, std::vector<int64_t>& column)
 {
   const auto find = hourly.find("winddirection_10m");
   if (find == hourly.end() || !find->is_array())
@@ -423,14 +463,14 @@ bool NLohmannJsonOpenMeteo::parseWindDirection(const nlohmann::json& hourly, std
     return false;
   }
   const auto winddirection_10m = *find;
-  if (winddirection_10m.size() != data.size())
+  if (winddirection_10m.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.winddirection_10m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << winddirection_10m.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: winddirection_10m)
   {
     if (!elem.is_number_integer())
@@ -438,8 +478,7 @@ bool NLohmannJsonOpenMeteo::parseWindDirection(const nlohmann::json& hourly, std
       std::cerr << "Error: Wind direction element is not an integer value!" << std::endl;
       return false;
     }
-    data[idx].setWindDegrees(elem.get<int>());
-    ++idx;
+    column.push_back(elem.get<int>());
   }
 
   return true;
@@ -460,10 +499,122 @@ bool NLohmannJsonOpenMeteo::parseForecast(const std::string& json, Forecast& for
   }
 
   forecast.setJson(json);
+  return parseForecastElement(doc, forecast);
+}
+
+bool NLohmannJsonOpenMeteo::parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast)
+{
+  nlohmann::json doc; // will contain the root value after parsing.
+  try
+  {
+    doc = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonOpenMeteo::parseCurrentAndForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  if (!parseCurrentWeatherElement(doc, weather) || !parseForecastElement(doc, forecast))
+    return false;
+  // Both objects get their data from the same response, so they can share it.
+  const auto shared = std::make_shared<const std::string>(json);
+  weather.setJson(shared);
+  forecast.setJson(shared);
+  return true;
+}
+
+bool NLohmannJsonOpenMeteo::parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts)
+{
+  nlohmann::json doc; // will contain the root value after parsing.
+  try
+  {
+    doc = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonOpenMeteo::parseForecastBatch(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  forecasts.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  if (!doc.is_array())
+  {
+    Forecast f;
+    f.setJson(json);
+    if (!parseForecastElement(doc, f))
+      return false;
+    forecasts.push_back(f);
+    return true;
+  }
+  for (const auto& elem : doc)
+  {
+    Forecast f;
+    f.setJson(elem.dump());
+    if (!parseForecastElement(elem, f))
+      return false;
+    forecasts.push_back(f);
+  }
+  return true;
+}
+
+bool NLohmannJsonOpenMeteo::parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts)
+{
+  nlohmann::json doc; // will contain the root value after parsing.
+  try
+  {
+    doc = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonOpenMeteo::parseCurrentAndForecastBatch(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  forecasts.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  if (!doc.is_array())
+  {
+    Weather w;
+    Forecast f;
+    if (!parseCurrentWeatherElement(doc, w) || !parseForecastElement(doc, f))
+      return false;
+    const auto shared = std::make_shared<const std::string>(json);
+    w.setJson(shared);
+    f.setJson(shared);
+    weather.push_back(w);
+    forecasts.push_back(f);
+    return true;
+  }
+  for (const auto& elem : doc)
+  {
+    Weather w;
+    Forecast f;
+    if (!parseCurrentWeatherElement(elem, w) || !parseForecastElement(elem, f))
+      return false;
+    const auto shared = std::make_shared<const std::string>(elem.dump());
+    w.setJson(shared);
+    f.setJson(shared);
+    weather.push_back(w);
+    forecasts.push_back(f);
+  }
+  return true;
+}
+
+bool NLohmannJsonOpenMeteo::parseForecastElement(const nlohmann::json& doc, Forecast& forecast)
+{
   if (doc.empty())
     return false;
 
-  const auto optional_error = hourlyUnitCheck(doc);
+  bool unixTime = false;
+  const auto optional_error = hourlyUnitCheck(doc, unixTime);
   if (optional_error.has_value())
   {
     std::cerr << "Error in NLohmannJsonOpenMeteo::parseForecast(): Unexpected unit values found!"
@@ -471,14 +622,30 @@ bool NLohmannJsonOpenMeteo::parseForecast(const std::string& json, Forecast& for
     return false;
   }
 
-  auto find = doc.find("hourly");
+  // Unix timestamps need the offset of the location's time zone to get the
+  // same time points as ISO 8601 times, see unixTimeToTime().
+  int64_t utcOffset = 0;
+  auto find = doc.find("utc_offset_seconds");
+  if (unixTime)
+  {
+    if (find == doc.end() || !find->is_number_integer())
+    {
+      std::cerr << "Error in NLohmannJsonOpenMeteo::parseForecast(): JSON element"
+                << " 'utc_offset_seconds' is either missing or not an integer!"
+                << std::endl;
+      return false;
+    }
+    utcOffset = find->get<int64_t>();
+  }
+
+  find = doc.find("hourly");
   if (find == doc.end() || !find->is_object())
   {
     std::cerr << "Error in NLohmannJsonOpenMeteo::parseForecast(): JSON element"
               << " 'hourly' is either missing or not an object!" << std::endl;
     return false;
   }
-  nlohmann::json& hourly = *find;
+  const nlohmann::json& hourly = *find;
 
   find = hourly.find("time");
   if (find == hourly.end() || !find->is_array())
@@ -498,39 +665,60 @@ bool NLohmannJsonOpenMeteo::parseForecast(const std::string& json, Forecast& for
     return false;
   }
   std::vector<Weather> data;
+  HourlyTimeDecoder decoder;
   for (const auto& elem: time)
   {
-    if (!elem.is_string())
+    Weather weather;
+    if (unixTime)
     {
-      std::cerr << "Error: Time element is not a string!" << std::endl;
-      return false;
+      if (!elem.is_number_integer())
+      {
+        std::cerr << "Error: Time element is not an integer!" << std::endl;
+        return false;
+      }
+      const auto dt = decoder.decode(elem.get<int64_t>(), utcOffset);
+      if (!dt.has_value())
+      {
+        return false;
+      }
+      weather.setDataTime(dt.value());
     }
-    const auto dt = isoStringToTime(std::string(elem.get<std::string>()));
-    if (!dt.has_value())
+    else
     {
-      return false;
+      if (!elem.is_string())
+      {
+        std::cerr << "Error: Time element is not a string!" << std::endl;
+        return false;
+      }
+      const auto dt = decoder.decode(elem.get_ref<const std::string&>());
+      if (!dt.has_value())
+      {
+        return false;
+      }
+      weather.setDataTime(dt.value());
     }
-    Weather weather;
-    weather.setDataTime(dt.value());
     data.emplace_back(weather);
   }
 
-  if (!parseTemperature(hourly, data))
+  // Read all hourly arrays into columns first, then convert them as a whole.
+  OpenMeteoHourlyColumns columns;
+  if (!parseTemperature(hourly, data.size(), columns.temperature))
     return false;
-  if (!parseHumidity(hourly, data))
+  if (!parseHumidity(hourly, data.size(), columns.humidity))
     return false;
-  if (!parseRain(hourly, data))
+  if (!parseRain(hourly, data.size(), columns.rain))
     return false;
-  if (!parseSnowfall(hourly, data))
+  if (!parseSnowfall(hourly, data.size(), columns.snowfall))
     return false;
-  if (!parsePressure(hourly, data))
+  if (!parsePressure(hourly, data.size(), columns.pressure))
     return false;
-  if (!parseCloudCover(hourly, data))
+  if (!parseCloudCover(hourly, data.size(), columns.cloudCover))
     return false;
-  if (!parseWindSpeed(hourly, data))
+  if (!parseWindSpeed(hourly, data.size(), columns.windSpeed))
     return false;
-  if (!parseWindDirection(hourly, data))
+  if (!parseWindDirection(hourly, data.size(), columns.windDirection))
     return false;
+  setHourlyData(columns, data);
 
   forecast.setData(data);
   return true;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,7 @@
 #define WEATHER_INFORMATION_COLLECTOR_NLOHMANNOPENMETEO_HPP
 
 #include <optional>
+#include <vector>
 #include "../../third-party/nlohmann/json.hpp"
 #include "../data/Forecast.hpp"
 #include "../data/Weather.hpp"
@@ -56,6 +57,60 @@ class NLohmannJsonOpenMeteo
      */
     static bool parseForecast(const std::string& json, Forecast& forecast);
 
+
+    /** \brief Parses current weather and forecast information from the same
+     * JSON response into a Weather and a Forecast object. The JSON is only
+     * parsed once, and both objects share the same raw JSON data.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the current weather will be stored
+     * \param forecast variable where the forecast will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast);
+
+
+    /** \brief Parses the current weather information of several locations
+     *         from JSON into Weather objects.
+     *
+     * \param json     string containing the JSON, usually an array with one
+     *                 element per location
+     * \param weather  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather);
+
+
+    /** \brief Parses the weather forecast information of several locations
+     *         from JSON into Forecast objects.
+     *
+     * \param json       string containing the JSON, usually an array with one
+     *                   element per location
+     * \param forecasts  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts);
+
+
+    /** \brief Parses current weather and forecast information of several
+     *         locations from the same JSON response into Weather and Forecast
+     *         objects. The JSON is only parsed once, and the Weather and the
+     *         Forecast of a location share the same raw JSON data.
+     *
+     * \param json       string containing the JSON, usually an array with one
+     *                   element per location
+     * \param weather    variable where the current weather will be stored, one
+     *                   per location
+     * \param forecasts  variable where the forecasts will be stored, one per
+     *                   location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts);
+
     #ifdef wic_openmeteo_find_location
     /** \brief Parses found locations.
      *
@@ -67,22 +122,44 @@ class NLohmannJsonOpenMeteo
     static bool parseLocations(const std::string& json, std::vector<Location>& locations);
     #endif // wic_openmeteo_find_location
   private:
+    /** \brief Parses the current weather of a single location.
+     *
+     * \param root     JSON element of the location
+     * \param weather  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherElement(const nlohmann::json& root, Weather& weather);
+
+
+    /** \brief Parses the weather forecast of a single location.
+     *
+     * \param doc       JSON element of the location
+     * \param forecast  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseForecastElement(const nlohmann::json& doc, Forecast& forecast);
+
+
     /** \brief Checks whether the units match the expected values.
      *
-     * \param doc   root element of the JSON document
+     * \param doc       root element of the JSON document
+     * \param unixTime  variable that receives whether times are Unix timestamps
+     *                  instead of ISO 8601 strings
      * \return Returns an empty optional, if units are correct.
      *         Returns an error message otherwise.
      */
-    static std::optional<std::string> hourlyUnitCheck(const nlohmann::json& doc);
-
-    static bool parseTemperature(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parseHumidity(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parseRain(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parseSnowfall(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parsePressure(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parseCloudCover(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parseWindSpeed(const nlohmann::json& hourly, std::vector<Weather>& data);
-    static bool parseWindDirection(const nlohmann::json& hourly, std::vector<Weather>& data);
+    static std::optional<std::string> hourlyUnitCheck(const nlohmann::json& doc, bool& unixTime);
+
+    static bool parseTemperature(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseHumidity(const nlohmann::json& hourly, const std::size_t expected, std::vector<int64_t>& column);
+    static bool parseRain(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseSnowfall(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parsePressure(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseCloudCover(const nlohmann::json& hourly, const std::size_t expected, std::vector<int64_t>& column);
+    static bool parseWindSpeed(const nlohmann::json& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseWindDirection(const nlohmann::json& hourly, const std::size_t expected, std::vector<int64_t>& column);
 }; // class
 
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2021, 2022  Dirk Stolle
+    Copyright (C) 2019, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -206,6 +206,61 @@ bool NLohmannJsonOwm::parseForecast(const std::string& json, Forecast& forecast)
   return true;
 }
 
+bool NLohmannJsonOwm::parseCurrentWeatherGroup(const std::string& json, std::vector<std::pair<uint32_t, Weather> >& weather)
+{
+  value_type root; // will contain the root value after parsing.
+  try
+  {
+    root = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonOwm::parseCurrentWeatherGroup(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  const auto findList = root.find("list");
+  if ((findList == root.end()) || !findList->is_array())
+  {
+    std::cerr << "Error in NLohmannJsonOwm::parseCurrentWeatherGroup(): list is either missing or not an array!" << std::endl;
+    return false;
+  }
+  weather.clear();
+  for (const value_type& val : *findList)
+  {
+    const auto findId = val.find("id");
+    if ((findId == val.end()) || !findId->is_number_unsigned())
+    {
+      std::cerr << "Error in NLohmannJsonOwm::parseCurrentWeatherGroup(): id is either missing or not an integer!" << std::endl;
+      return false;
+    }
+    Weather w;
+    if (!parseSingleWeatherItem(val, w))
+    {
+      std::cerr << "Error in NLohmannJsonOwm::parseCurrentWeatherGroup(): Parsing single item failed!" << std::endl;
+      return false;
+    }
+    // Each item has the same structure as the response for a single location.
+    w.setJson(val.dump());
+    weather.emplace_back(findId->get<uint32_t>(), w);
+  } // for (range-based)
+  const auto findCnt = root.find("cnt");
+  if ((findCnt == root.end()) || !findCnt->is_number_unsigned())
+  {
+    std::cerr << "Error in NLohmannJsonOwm::parseCurrentWeatherGroup(): cnt is either missing or not an integer!" << std::endl;
+    return false;
+  }
+  const decltype(weather.size()) cnt = findCnt->get<unsigned int>();
+  if (weather.size() != cnt)
+  {
+    std::cerr << "Error in NLohmannJsonOwm::parseCurrentWeatherGroup(): Expected " << cnt
+              << " items, but " << weather.size() << " items were found!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 #ifdef wic_owm_find_location
 bool NLohmannJsonOwm::parseLocations(const std::string& json, std::vector<std::pair<Location, Weather> >& locations)
 {
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2021  Dirk Stolle
+    Copyright (C) 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,9 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_NLOHMANNJSONOWM_HPP
 #define WEATHER_INFORMATION_COLLECTOR_NLOHMANNJSONOWM_HPP
 
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "../../third-party/nlohmann/json.hpp"
 #include "../data/Forecast.hpp"
 #include "../data/Weather.hpp"
@@ -55,6 +58,18 @@ class NLohmannJsonOwm
      */
     static bool parseForecast(const std::string& json, Forecast& forecast);
 
+
+    /** \brief Parses the current weather information of several locations
+     *         from the JSON of the group endpoint.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the results will be stored, each one
+     *                 together with the OpenWeatherMap id of its location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherGroup(const std::string& json, std::vector<std::pair<uint32_t, Weather> >& weather);
+
     #ifdef wic_owm_find_location
     /** \brief Parses found locations.
      *
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2021  Dirk Stolle
+    Copyright (C) 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -129,6 +129,55 @@ bool NLohmannJsonWeatherbit::parseCurrentWeather(const std::string& json, Weathe
   return parseSingleWeatherItem(foundData->at(0), weather);
 }
 
+bool NLohmannJsonWeatherbit::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather)
+{
+  value_type root; // will contain the root value after parsing.
+  try
+  {
+    root = nlohmann::json::parse(json);
+  }
+  catch(const nlohmann::json::parse_error& ex)
+  {
+    std::cerr << "Error in NLohmannJsonWeatherbit::parseCurrentWeatherBatch(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << ex.what() << std::endl;
+    return false;
+  }
+
+  const auto foundData = root.find("data");
+  if (foundData == root.end() || !foundData->is_array())
+  {
+    std::cerr << "Error in NLohmannJsonWeatherbit::parseCurrentWeatherBatch(): JSON "
+              << "does not contain a data element or data element is not an "
+              << "array!" << std::endl;
+    return false;
+  }
+  const auto count = root.find("count");
+  if (count == root.end() || !count->is_number_unsigned())
+  {
+    std::cerr << "Error in NLohmannJsonWeatherbit::parseCurrentWeatherBatch(): JSON does not contain a count element or the element is not a valid number!" << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  for (const value_type& item : *foundData)
+  {
+    Weather w;
+    if (!parseSingleWeatherItem(item, w))
+      return false;
+    // Keep the JSON in the same form as the response for a single location.
+    w.setJson("{\"data\":[" + item.dump() + "],\"count\":1}");
+    weather.push_back(w);
+  }
+  if (weather.size() != count->get<unsigned int>())
+  {
+    std::cerr << "Error in NLohmannJsonWeatherbit::parseCurrentWeatherBatch(): Expected "
+              << count->get<unsigned int>() << " items, but " << weather.size()
+              << " items were found!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 bool NLohmannJsonWeatherbit::parseForecast(const std::string& json, Forecast& forecast)
 {
   value_type root; // will contain the root value after parsing.
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2021  Dirk Stolle
+    Copyright (C) 2019, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,7 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_NLOHMANNJSONWEATHERBIT_HPP
 #define WEATHER_INFORMATION_COLLECTOR_NLOHMANNJSONWEATHERBIT_HPP
 
+#include <vector>
 #include "../../third-party/nlohmann/json.hpp"
 #include "../data/Forecast.hpp"
 #include "../data/Weather.hpp"
@@ -51,6 +52,18 @@ class NLohmannJsonWeatherbit
      *         Returns false, if an error occurred.
      */
     static bool parseForecast(const std::string& json, Forecast& forecast);
+
+
+    /** \brief Parses the current weather information of several locations
+     *         from JSON into Weather objects.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the results will be stored, one per
+     *                 location and in the order of the JSON data
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather);
   private:
     // alias for type that keeps JSON values / objects / arrays, etc.
     using value_type = nlohmann::json;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,82 +21,298 @@
 #include "OpenMeteoFunctions.hpp"
 #include <ctime>
 #include <iostream>
+#include "../util/NumericPrecision.hpp"
 
 namespace wic
 {
 
-std::optional<std::chrono::time_point<std::chrono::system_clock> > isoStringToTime(const std::string& value)
+namespace
+{
+
+/** \brief Gets the value of a fixed number of decimal digits.
+ *
+ * \param value   string containing the digits
+ * \param pos     position of the first digit
+ * \param length  number of digits
+ * \return Returns the value of the digits.
+ *         Returns -1, if one of the characters is not a digit.
+ */
+int fixedWidthNumber(const std::string_view value, const std::size_t pos, const std::size_t length)
+{
+  int result = 0;
+  for (std::size_t i = pos; i < pos + length; ++i)
+  {
+    if (value[i] < '0' || value[i] > '9')
+      return -1;
+    result = result * 10 + (value[i] - '0');
+  }
+  return result;
+}
+
+/** \brief Splits a time like '2022-09-23T12:34' into its parts.
+ *
+ * \param value   string containing the time
+ * \param tm      variable that receives year, month, day, hour and minute
+ * \return Returns true, if the string is a valid time.
+ *         Returns false otherwise.
+ */
+bool isoStringToParts(const std::string_view value, struct tm& tm)
 {
   // Open-Meteo time format is something like '2020-04-04T12:34', so length is 16 chars.
   if (value.size() != 16 || value[4] != '-' || value[7] != '-' || value[13] != ':')
   {
     std::cerr << "Error: " << value << " is not a valid ISO 8601 time, it "
               << "must follow the pattern 'YYYY-MM-DDThh:mm'." << std::endl;
+    return false;
+  }
+
+  const int year = fixedWidthNumber(value, 0, 4);
+  if (year < 0)
+  {
+    std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
+              << value.substr(0, 4) << "' is not a valid year." << std::endl;
+    return false;
+  }
+  const int month = fixedWidthNumber(value, 5, 2);
+  if (month > 12 || month < 1)
+  {
+    std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
+              << value.substr(5, 2) << "' is not a valid month." << std::endl;
+    return false;
+  }
+  const int day = fixedWidthNumber(value, 8, 2);
+  if (day < 1 || day > 31)
+  {
+    std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
+              << value.substr(8, 2) << "' is not a valid day." << std::endl;
+    return false;
+  }
+  const int hour = fixedWidthNumber(value, 11, 2);
+  if (hour < 0 || hour > 23)
+  {
+    std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
+              << value.substr(11, 2) << "' is not a valid hour." << std::endl;
+    return false;
+  }
+  const int minute = fixedWidthNumber(value, 14, 2);
+  if (minute < 0 || minute > 59)
+  {
+    std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
+              << value.substr(14, 2) << "' is not a valid minute." << std::endl;
+    return false;
+  }
+
+  tm.tm_sec = 0;
+  tm.tm_min = minute;
+  tm.tm_hour = hour;
+  tm.tm_mday = day;
+  tm.tm_mon = month - 1;
+  tm.tm_year = year - 1900;
+  tm.tm_isdst = -1;
+  return true;
+}
+
+/** \brief Splits a Unix timestamp into the parts of the matching UTC time.
+ *
+ * \param seconds  seconds since 1970-01-01 00:00 UTC
+ * \param tm       variable that receives year, month, day, hour, minute and second
+ */
+void unixTimeToParts(const int64_t seconds, struct tm& tm)
+{
+  int64_t days = seconds / 86400;
+  int64_t secondsOfDay = seconds % 86400;
+  if (secondsOfDay < 0)
+  {
+    secondsOfDay += 86400;
+    --days;
+  }
+  // Convert days since 1970-01-01 to year, month and day of the proleptic
+  // Gregorian calendar, using eras of 400 years that start on March 1st.
+  days += 719468;
+  const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const int64_t dayOfEra = days - era * 146097;
+  const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const int64_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+  const int64_t month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+  const int64_t year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+  tm.tm_sec = static_cast<int>(secondsOfDay % 60);
+  tm.tm_min = static_cast<int>(secondsOfDay / 60 % 60);
+  tm.tm_hour = static_cast<int>(secondsOfDay / 3600);
+  tm.tm_mday = static_cast<int>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+  tm.tm_mon = static_cast<int>(month - 1);
+  tm.tm_year = static_cast<int>(year - 1900);
+  tm.tm_isdst = -1;
+}
+
+} // namespace
+
+std::optional<std::chrono::time_point<std::chrono::system_clock> > isoStringToTime(const std::string_view value)
+{
+  struct tm tm;
+  if (!isoStringToParts(value, tm))
+    return std::nullopt;
+  const time_t tt = mktime(&tm);
+  if (tt == static_cast<time_t>(-1))
+  {
+    std::cerr << "Error: mktime() failed when converting " << value
+              << " to time_t." << std::endl;
     return std::nullopt;
   }
+  return std::chrono::system_clock::from_time_t(tt);
+}
 
-  std::size_t pos;
-  try
+std::optional<std::chrono::time_point<std::chrono::system_clock> > unixTimeToTime(const int64_t seconds, const int64_t utcOffset)
+{
+  struct tm tm;
+  unixTimeToParts(seconds + utcOffset, tm);
+  const time_t tt = mktime(&tm);
+  if (tt == static_cast<time_t>(-1))
   {
-    const int year = std::stoi(value, &pos);
-    if (pos != 4 || year < 0)
-    {
-      std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
-                << value.substr(0, 4) << "' is not a valid year." << std::endl;
-      return std::nullopt;
-    }
-    const int month = std::stoi(value.substr(5, 2), &pos);
-    if (pos != 2 || month > 12 || month < 1)
-    {
-      std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
-                << value.substr(5, 2) << "' is not a valid month." << std::endl;
-      return std::nullopt;
-    }
-    const int day = std::stoi(value.substr(8, 2), &pos);
-    if (pos != 2 || day < 1 || day > 31)
-    {
-      std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
-                << value.substr(8, 2) << "' is not a valid day." << std::endl;
-      return std::nullopt;
-    }
+    std::cerr << "Error: mktime() failed when converting Unix time " << seconds
+              << " to time_t." << std::endl;
+    return std::nullopt;
+  }
+  return std::chrono::system_clock::from_time_t(tt);
+}
 
-    const int hour = std::stoi(value.substr(11, 2), &pos);
-    if (pos != 2 || hour < 0 || hour > 23)
-    {
-      std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
-                << value.substr(11, 2) << "' is not a valid hour." << std::endl;
-      return std::nullopt;
-    }
-    const int minute = std::stoi(value.substr(14, 2), &pos);
-    if (pos != 2 || minute < 0 || minute > 59)
-    {
-      std::cerr << "Error: " << value << " is not a valid ISO 8601 time. Maybe '"
-                << value.substr(14, 2) << "' is not a valid minute." << std::endl;
-      return std::nullopt;
-    }
+HourlyTimeDecoder::HourlyTimeDecoder()
+: year(-1),
+  month(-1),
+  day(-1),
+  dayStart(static_cast<time_t>(-1))
+{
+}
+
+std::optional<std::chrono::time_point<std::chrono::system_clock> > HourlyTimeDecoder::decode(const std::string_view value)
+{
+  struct tm tm;
+  if (!isoStringToParts(value, tm))
+    return std::nullopt;
+  const time_t tt = decodeParts(tm);
+  if (tt == static_cast<time_t>(-1))
+  {
+    std::cerr << "Error: mktime() failed when converting " << value
+              << " to time_t." << std::endl;
+    return std::nullopt;
+  }
+  return std::chrono::system_clock::from_time_t(tt);
+}
+
+std::optional<std::chrono::time_point<std::chrono::system_clock> > HourlyTimeDecoder::decode(const int64_t seconds, const int64_t utcOffset)
+{
+  struct tm tm;
+  unixTimeToParts(seconds + utcOffset, tm);
+  const time_t tt = decodeParts(tm);
+  if (tt == static_cast<time_t>(-1))
+  {
+    std::cerr << "Error: mktime() failed when converting Unix time " << seconds
+              << " to time_t." << std::endl;
+    return std::nullopt;
+  }
+  return std::chrono::system_clock::from_time_t(tt);
+}
 
-    struct tm tm;
-    tm.tm_sec = 0;
-    tm.tm_min = minute;
-    tm.tm_hour = hour;
-    tm.tm_mday = day;
-    tm.tm_mon = month - 1;
-    tm.tm_year = year - 1900;
-    tm.tm_isdst = -1;
-    const time_t tt = mktime(&tm);
-    if (tt == static_cast<time_t>(-1))
+time_t HourlyTimeDecoder::decodeParts(struct tm& tm)
+{
+  if (tm.tm_year != year || tm.tm_mon != month || tm.tm_mday != day)
+  {
+    // New day: Get the start of the day and check that the offset to UTC does
+    // not change during the day, e. g. due to daylight saving time.
+    year = tm.tm_year;
+    month = tm.tm_mon;
+    day = tm.tm_mday;
+    struct tm first = tm;
+    first.tm_hour = 0;
+    first.tm_min = 0;
+    struct tm last = tm;
+    last.tm_hour = 23;
+    last.tm_min = 59;
+    dayStart = mktime(&first);
+    const time_t dayEnd = mktime(&last);
+    if (dayStart != static_cast<time_t>(-1) && dayEnd - dayStart != 23 * 3600 + 59 * 60)
     {
-      std::cerr << "Error: mktime() failed when converting " << value
-                << " to time_t." << std::endl;
-      return std::nullopt;
+      dayStart = static_cast<time_t>(-1);
     }
-    return std::chrono::system_clock::from_time_t(tt);
   }
-  catch(const std::exception& ex)
+
+  if (dayStart == static_cast<time_t>(-1))
   {
-    std::cerr << "Error: ISO 8601 time conversion threw an exception.\n"
-              << "Exception message: " << ex.what() << std::endl;
-    return std::nullopt;
+    // Offset changes during that day, so every time needs mktime().
+    return mktime(&tm);
+  }
+  return dayStart + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+}
+
+// The conversions work on whole columns instead of single Weather objects.
+// The loops are simple enough to be vectorized by the compiler.
+
+void celsiusToFahrenheit(const std::vector<double>& celsius, std::vector<float>& fahrenheit)
+{
+  const std::size_t count = celsius.size();
+  fahrenheit.resize(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    fahrenheit[i] = static_cast<float>(celsius[i] * 1.8 + 32.0);
+  }
+}
+
+void celsiusToKelvin(const std::vector<double>& celsius, std::vector<float>& kelvin)
+{
+  const std::size_t count = celsius.size();
+  kelvin.resize(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    kelvin[i] = static_cast<float>(celsius[i] + 273.15);
+  }
+}
+
+void snowfallToSnow(const std::vector<double>& snowfall, std::vector<float>& snow)
+{
+  const std::size_t count = snowfall.size();
+  snow.resize(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    snow[i] = static_cast<float>(snowfall[i] / 0.7);
+  }
+}
+
+void enforcePrecision(std::vector<float>& values)
+{
+  for (float& value : values)
+  {
+    value = NumericPrecision<float>::enforce(value);
+  }
+}
+
+void setHourlyData(const OpenMeteoHourlyColumns& columns, std::vector<Weather>& data)
+{
+  std::vector<float> fahrenheit;
+  celsiusToFahrenheit(columns.temperature, fahrenheit);
+  // Avoid values like 6.9999... ° F by rounding, if appropriate.
+  enforcePrecision(fahrenheit);
+  std::vector<float> kelvin;
+  celsiusToKelvin(columns.temperature, kelvin);
+  // Avoid values like 296.9999... K by rounding, if appropriate.
+  enforcePrecision(kelvin);
+  std::vector<float> snow;
+  snowfallToSnow(columns.snowfall, snow);
+
+  const std::size_t count = data.size();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Weather& w = data[i];
+    w.setTemperatureCelsius(static_cast<float>(columns.temperature[i]));
+    w.setTemperatureFahrenheit(fahrenheit[i]);
+    w.setTemperatureKelvin(kelvin[i]);
+    w.setHumidity(static_cast<int8_t>(columns.humidity[i]));
+    w.setRain(static_cast<float>(columns.rain[i]));
+    w.setSnow(snow[i]);
+    w.setPressure(static_cast<int16_t>(columns.pressure[i]));
+    w.setCloudiness(static_cast<int8_t>(columns.cloudCover[i]));
+    w.setWindSpeed(static_cast<float>(columns.windSpeed[i]));
+    w.setWindDegrees(static_cast<int16_t>(columns.windDirection[i]));
   }
 }
 
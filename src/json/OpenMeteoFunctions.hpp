@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,8 +22,12 @@
 #define WEATHER_INFORMATION_COLLECTOR_OPENMETEOFUNCTIONS_HPP
 
 #include <chrono>
+#include <cstdint>
+#include <ctime>
 #include <optional>
-#include <string>
+#include <string_view>
+#include <vector>
+#include "../data/Weather.hpp"
 
 namespace wic
 {
@@ -34,7 +38,125 @@ namespace wic
  * \return Returns the matching time point in case of success.
  *         Returns an empty optional, if the string could not be converted.
  */
-std::optional<std::chrono::time_point<std::chrono::system_clock> > isoStringToTime(const std::string& value);
+std::optional<std::chrono::time_point<std::chrono::system_clock> > isoStringToTime(const std::string_view value);
+
+/** \brief Converts a Unix timestamp of Open-Meteo to a time point.
+ *
+ * Open-Meteo returns ISO 8601 times in the local time of the location, and
+ * isoStringToTime() reads those as local time of the machine. The timestamp is
+ * shifted by the UTC offset of the location and read the same way, so that
+ * both time formats result in the same time point.
+ *
+ * \param seconds    Unix timestamp, i. e. seconds since 1970-01-01 00:00 UTC
+ * \param utcOffset  offset of the local time of the location to UTC in seconds,
+ *                   as given by 'utc_offset_seconds' in the response
+ * \return Returns the matching time point in case of success.
+ *         Returns an empty optional, if the timestamp could not be converted.
+ */
+std::optional<std::chrono::time_point<std::chrono::system_clock> > unixTimeToTime(const int64_t seconds, const int64_t utcOffset);
+
+/** \brief Converts the ISO 8601 times or Unix timestamps of the hourly data of
+ *         a forecast to time points.
+ *
+ * The times of hourly data are consecutive hours, so most of them are on the
+ * same day as the time before. The decoder only converts the start of each day
+ * with mktime() and gets the other times of that day by adding the hours and
+ * minutes. Days where the offset to UTC changes, e. g. due to daylight saving
+ * time, fall back to mktime() for every time.
+ */
+class HourlyTimeDecoder
+{
+  public:
+    /** \brief Constructor.
+     */
+    HourlyTimeDecoder();
+
+
+    /** \brief Converts a string containing an ISO 8601 time like
+     *         '2022-09-23T12:34' to a time point.
+     *
+     * \param value   string containing the time
+     * \return Returns the matching time point in case of success.
+     *         Returns an empty optional, if the string could not be converted.
+     */
+    std::optional<std::chrono::time_point<std::chrono::system_clock> > decode(const std::string_view value);
+
+
+    /** \brief Converts a Unix timestamp to a time point the same way as
+     *         unixTimeToTime() does.
+     *
+     * \param seconds    Unix timestamp, i. e. seconds since 1970-01-01 00:00 UTC
+     * \param utcOffset  offset of the local time of the location to UTC in seconds
+     * \return Returns the matching time point in case of success.
+     *         Returns an empty optional, if the timestamp could not be converted.
+     */
+    std::optional<std::chrono::time_point<std::chrono::system_clock> > decode(const int64_t seconds, const int64_t utcOffset);
+  private:
+    /** \brief Converts the parts of a local time to time_t.
+     *
+     * \param tm  year, month, day, hour, minute and second of the time
+     * \return Returns the matching time_t value, or -1 if it cannot be converted.
+     */
+    time_t decodeParts(struct tm& tm);
+
+
+    int year; /**< year of the previous time, minus 1900 */
+    int month; /**< month of the previous time, zero-based */
+    int day; /**< day of month of the previous time */
+    time_t dayStart; /**< time at 00:00 of that day, -1 if it cannot be used */
+}; // class
+
+/** \brief hourly forecast data of Open-Meteo, one column per quantity
+ *
+ * Each column holds the values of the matching array of the JSON element
+ * 'hourly' in the units of the API response, one element per hour.
+ */
+struct OpenMeteoHourlyColumns
+{
+  std::vector<double> temperature; /**< temperature in °C */
+  std::vector<int64_t> humidity; /**< relative humidity in percent */
+  std::vector<double> rain; /**< rain in mm */
+  std::vector<double> snowfall; /**< snowfall in cm */
+  std::vector<double> pressure; /**< air pressure at mean sea level in hPa */
+  std::vector<int64_t> cloudCover; /**< cloud cover in percent */
+  std::vector<double> windSpeed; /**< wind speed in m/s */
+  std::vector<int64_t> windDirection; /**< wind direction in degrees */
+}; // struct
+
+/** \brief Converts temperatures from degrees Celsius to degrees Fahrenheit.
+ *
+ * \param celsius     temperatures in °C
+ * \param fahrenheit  vector that receives the temperatures in °F
+ */
+void celsiusToFahrenheit(const std::vector<double>& celsius, std::vector<float>& fahrenheit);
+
+/** \brief Converts temperatures from degrees Celsius to Kelvin.
+ *
+ * \param celsius  temperatures in °C
+ * \param kelvin   vector that receives the temperatures in K
+ */
+void celsiusToKelvin(const std::vector<double>& celsius, std::vector<float>& kelvin);
+
+/** \brief Converts the snowfall of Open-Meteo to the amount of snow in mm.
+ *
+ * \param snowfall  snowfall in cm
+ * \param snow      vector that receives the amount of snow in mm
+ */
+void snowfallToSnow(const std::vector<double>& snowfall, std::vector<float>& snow);
+
+/** \brief Rounds all values to three decimals after the point, or to the
+ *         nearest integer, if they are close to it.
+ *
+ * \param values  the values to round
+ */
+void enforcePrecision(std::vector<float>& values);
+
+/** \brief Converts the hourly columns and stores them in the weather data.
+ *
+ * \param columns  hourly data, each column must have as many elements as data
+ * \param data     weather data of the forecast, one element per hour
+ */
+void setHourlyData(const OpenMeteoHourlyColumns& columns, std::vector<Weather>& data);
 
 } // namespace
 
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2020, 2021  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,13 +21,14 @@
 #include "SimdJsonApixu.hpp"
 #include <iostream>
 #include "ApixuFunctions.hpp"
+#include "SimdJsonParser.hpp"
 
 namespace wic
 {
 
 bool SimdJsonApixu::parseCurrentWeather(const std::string& json, Weather& weather)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto parseError = parser.parse(json).get(doc);
   if (parseError)
@@ -105,7 +106,7 @@ bool SimdJsonApixu::parseCurrentWeather(const std::string& json, Weather& weathe
 
 bool SimdJsonApixu::parseForecast(const std::string& json, Forecast& forecast)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto parseError = parser.parse(json).get(doc);
   if (parseError)
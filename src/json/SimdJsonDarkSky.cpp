@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2020, 2021  Dirk Stolle
+    Copyright (C) 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 #include "SimdJsonDarkSky.hpp"
 #include <iostream>
+#include "SimdJsonParser.hpp"
 #include "../util/NumericPrecision.hpp"
 
 namespace wic
@@ -27,7 +28,7 @@ namespace wic
 
 bool SimdJsonDarkSky::parseCurrentWeather(const std::string& json, Weather& weather)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto error = parser.parse(json).get(doc);
   if (error)
@@ -53,7 +54,7 @@ bool SimdJsonDarkSky::parseCurrentWeather(const std::string& json, Weather& weat
 
 bool SimdJsonDarkSky::parseForecast(const std::string& json, Forecast& forecast)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto error = parser.parse(json).get(doc);
   if (error)
@@ -0,0 +1,278 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SimdJsonOnDemandApixu.hpp"
+#include <iostream>
+#include "ApixuFunctions.hpp"
+#include "SimdJsonParser.hpp"
+
+namespace wic
+{
+
+bool SimdJsonOnDemandApixu::parseCurrentWeather(const std::string& json, Weather& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto parseError = SimdJsonParser::iterate(json, copy).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandApixu::parseCurrentWeather(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  weather.setJson(json);
+
+  simdjson::ondemand::object current;
+  auto error = doc["current"].get_object().get(current);
+  if (error)
+  {
+    // No current object - return false to indicate failure.
+    return false;
+  }
+
+  double number = 0.0;
+  int64_t integer = 0;
+  // temperature
+  error = current["temp_c"].get_double().get(number);
+  if (!error)
+  {
+    weather.setTemperatureCelsius(static_cast<float>(number));
+  }
+  error = current["temp_f"].get_double().get(number);
+  if (!error)
+  {
+    weather.setTemperatureFahrenheit(static_cast<float>(number));
+  }
+  // wind
+  error = current["wind_degree"].get_int64().get(integer);
+  if (!error)
+    weather.setWindDegrees(static_cast<int16_t>(integer));
+  error = current["wind_kph"].get_double().get(number);
+  if (!error)
+    weather.setWindSpeed(static_cast<float>(number / 3.6));
+  else
+  {
+    error = current["wind_mph"].get_double().get(number);
+    if (!error)
+      weather.setWindSpeed(static_cast<float>(number * 1.609344 / 3.6));
+  }
+  // humidity
+  error = current["humidity"].get_int64().get(integer);
+  if (!error)
+    weather.setHumidity(static_cast<int8_t>(integer));
+  // rain or snow
+  error = current["precip_mm"].get_double().get(number);
+  if (!error)
+  {
+    const float amount = static_cast<float>(number);
+    precipitationDistinction(amount, weather);
+  }
+  // pressure
+  error = current["pressure_mb"].get_double().get(number);
+  if (!error)
+  {
+    weather.setPressure(static_cast<int16_t>(number));
+  }
+  // cloudiness
+  error = current["cloud"].get_int64().get(integer);
+  if (!error)
+    weather.setCloudiness(static_cast<int8_t>(integer));
+  // date of data update
+  error = current["last_updated_epoch"].get_int64().get(integer);
+  if (!error)
+  {
+    const auto dt = std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(integer));
+    weather.setDataTime(dt);
+  }
+  return true;
+}
+
+bool SimdJsonOnDemandApixu::parseForecast(const std::string& json, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto parseError = SimdJsonParser::iterate(json, copy).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  forecast.setJson(json);
+
+  simdjson::ondemand::object jsForecast;
+  const auto forecastError = doc["forecast"].get_object().get(jsForecast);
+  if (forecastError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): forecast element is missing or it is not an object!" << std::endl;
+    return false;
+  }
+  simdjson::ondemand::array forecastday;
+  auto error = jsForecast["forecastday"].get_array().get(forecastday);
+  // forecastday must be a non-empty array.
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): forecastday element is missing or it is not an array!" << std::endl;
+    return false;
+  }
+  forecast.setData({ });
+  auto data = forecast.data();
+  double number = 0.0;
+  int64_t integer = 0;
+  for (auto value : forecastday)
+  {
+    Weather w_min;
+    simdjson::ondemand::object fcDay;
+    int64_t date_epoch = 0;
+    if (value.get_object().get(fcDay) || fcDay["date_epoch"].get_int64().get(date_epoch))
+    {
+      std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): date_epoch element is missing or not an integer!" << std::endl;
+      return false;
+    }
+    const auto dt = std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(date_epoch));
+    w_min.setDataTime(dt);
+    simdjson::ondemand::value hour;
+    const auto errorHour = fcDay["hour"].get(hour);
+    if (!errorHour)
+    {
+      // If hour is present but not an array, then it is an error.
+      simdjson::ondemand::array hours;
+      if (hour.get_array().get(hours))
+      {
+        std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): hour element is not an array!" << std::endl;
+        return false;
+      }
+      // hourly data is present, use that.
+      for (auto hourValue: hours)
+      {
+        Weather w;
+        simdjson::ondemand::object elem;
+        if (hourValue.get_object().get(elem) || elem["time_epoch"].get_int64().get(integer))
+        {
+          std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): Hourly forecast data has no timestamp!" << std::endl;
+          return false;
+        }
+        w.setDataTime(std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(integer)));
+        // temperature
+        error = elem["temp_c"].get_double().get(number);
+        if (!error)
+          w.setTemperatureCelsius(static_cast<float>(number));
+        error = elem["temp_f"].get_double().get(number);
+        if (!error)
+          w.setTemperatureFahrenheit(static_cast<float>(number));
+        // wind
+        error = elem["wind_kph"].get_double().get(number);
+        if (!error)
+          w.setWindSpeed(static_cast<float>(number / 3.6));
+        error = elem["wind_degree"].get_int64().get(integer);
+        if (!error)
+          w.setWindDegrees(static_cast<int16_t>(integer));
+        // air pressure: pressure_mb
+        error = elem["pressure_mb"].get_double().get(number);
+        if (!error)
+          w.setPressure(static_cast<int16_t>(number));
+        // rain or snow: precip_mm
+        error = elem["precip_mm"].get_double().get(number);
+        if (!error)
+        {
+          const float amount = static_cast<float>(number);
+          precipitationDistinction(amount, w);
+        }
+        // humidity
+        error = elem["humidity"].get_int64().get(integer);
+        if (!error)
+          w.setHumidity(static_cast<int8_t>(integer));
+        // cloudiness
+        error = elem["cloud"].get_int64().get(integer);
+        if (!error)
+          w.setCloudiness(static_cast<int8_t>(integer));
+        // Push data of current element onto result.
+        data.push_back(w);
+      } // for (range-based)
+    } // if (hourly data)
+    else
+    {
+      simdjson::ondemand::object day;
+      const auto errorDay = fcDay["day"].get_object().get(day);
+      // day must be a non-empty object.
+      if (errorDay)
+      {
+        std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): JSON element 'day' is missing or not an object!" << std::endl;
+        return false;
+      }
+      error = day["mintemp_c"].get_double().get(number);
+      if (!error)
+      {
+        w_min.setTemperatureCelsius(static_cast<float>(number));
+      }
+      error = day["mintemp_f"].get_double().get(number);
+      if (!error)
+      {
+        w_min.setTemperatureFahrenheit(static_cast<float>(number));
+      }
+      double avghumidity = 0.0;
+      const auto errorHum = day["avghumidity"].get_double().get(avghumidity);
+      if (!errorHum)
+        w_min.setHumidity(static_cast<int8_t>(avghumidity));
+      double totalprecip_mm = 0.0;
+      const auto errorPrecip = day["totalprecip_mm"].get_double().get(totalprecip_mm);
+      if (!errorPrecip)
+      {
+        const float amount = static_cast<float>(totalprecip_mm);
+        precipitationDistinction(amount, w_min);
+      }
+      data.push_back(w_min);
+
+      Weather w_max;
+      w_max.setDataTime(std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(date_epoch + 3600 * 12)));
+      error = day["maxtemp_c"].get_double().get(number);
+      if (!error)
+      {
+        w_max.setTemperatureCelsius(static_cast<float>(number));
+      }
+      error = day["maxtemp_f"].get_double().get(number);
+      if (!error)
+      {
+        w_max.setTemperatureFahrenheit(static_cast<float>(number));
+      }
+      if (!errorHum)
+        w_max.setHumidity(static_cast<int8_t>(avghumidity));
+      if (!errorPrecip)
+      {
+        const float amount = static_cast<float>(totalprecip_mm);
+        precipitationDistinction(amount, w_max);
+      }
+      data.push_back(w_max);
+    } // else (daily data)
+  } // for (range-based)
+
+  if (data.empty())
+  {
+    std::cerr << "Error in SimdJsonOnDemandApixu::parseForecast(): JSON does not contain any forecast data!" << std::endl;
+    return false;
+  }
+
+  forecast.setData(data);
+  return true;
+}
+
+} // namespace
@@ -0,0 +1,245 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SimdJsonOnDemandDarkSky.hpp"
+#include <iostream>
+#include <memory>
+#include "SimdJsonParser.hpp"
+#include "../util/NumericPrecision.hpp"
+
+namespace wic
+{
+
+bool SimdJsonOnDemandDarkSky::parseCurrentWeather(const std::string& json, Weather& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandDarkSky::parseCurrentWeather(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  weather.setJson(json);
+  return parseCurrentWeatherElement(doc, weather);
+}
+
+bool SimdJsonOnDemandDarkSky::parseCurrentWeatherElement(simdjson::ondemand::document& doc, Weather& weather)
+{
+  // Current weather data is located in the currently object below the root.
+  simdjson::ondemand::value currently;
+  if (doc["currently"].get(currently))
+  {
+    std::cerr << "Error in SimdJsonOnDemandDarkSky::parseCurrentWeather(): No JSON element \"currently\" found!" << std::endl;
+    return false;
+  }
+  value_type dataPoint;
+  if (currently.get_object().get(dataPoint))
+    return false;
+  return parseSingleWeatherItem(dataPoint, weather);
+}
+
+bool SimdJsonOnDemandDarkSky::parseForecast(const std::string& json, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandDarkSky::parseForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  forecast.setJson(json);
+  return parseForecastElement(doc, forecast);
+}
+
+bool SimdJsonOnDemandDarkSky::parseForecastElement(simdjson::ondemand::document& doc, Forecast& forecast)
+{
+  simdjson::ondemand::object hourly;
+  const auto e = doc["hourly"].get_object().get(hourly);
+  if (e)
+  {
+    std::cerr << "Error in SimdJsonOnDemandDarkSky::parseForecast(): The element \"hourly\" is missing or is not an object!" << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::array hourlyData;
+  const auto e2 = hourly["data"].get_array().get(hourlyData);
+  if (e2)
+  {
+    std::cerr << "Error in SimdJsonOnDemandDarkSky::parseForecast(): The element \"data\" is missing or is not an array!" << std::endl;
+    return false;
+  }
+
+  forecast.setData({ });
+  auto data = forecast.data();
+  for (auto val : hourlyData)
+  {
+    Weather w;
+    value_type dataPoint;
+    if (val.get_object().get(dataPoint) || !parseSingleWeatherItem(dataPoint, w))
+    {
+      std::cerr << "Error in SimdJsonOnDemandDarkSky::parseForecast(): Parsing of element in data array failed!" << std::endl;
+      return false;
+    }
+    data.push_back(w);
+  } // for (range-based)
+  // Set data to parsed data ...
+  forecast.setData(data);
+  // And we are done here.
+  return true;
+}
+
+bool SimdJsonOnDemandDarkSky::parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandDarkSky::parseCurrentAndForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  // "currently" comes before "hourly" in responses of DarkSky, so both parts
+  // are found within one pass over the document.
+  if (!parseCurrentWeatherElement(doc, weather) || !parseForecastElement(doc, forecast))
+    return false;
+  // Both objects get their data from the same response, so they can share it.
+  const auto shared = std::make_shared<const std::string>(json);
+  weather.setJson(shared);
+  forecast.setJson(shared);
+  return true;
+}
+
+bool SimdJsonOnDemandDarkSky::parseSingleWeatherItem(value_type& dataPoint, Weather& weather)
+{
+  int64_t time = 0;
+  auto error = dataPoint["time"].get_int64().get(time);
+  if (!error)
+  {
+    weather.setDataTime(std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(time)));
+  }
+  double number = 0.0;
+  // temperature (in °C)
+  error = dataPoint["temperature"].get_double().get(number);
+  if (!error)
+  {
+    weather.setTemperatureCelsius(static_cast<float>(number));
+    // Since there are no other values (Fahrenheit or Kelvin), we can just
+    // calculate them on the fly.
+    weather.setTemperatureFahrenheit(static_cast<float>(weather.temperatureCelsius() * 1.8 + 32.0));
+    // Avoid values like 6.9999... ° F by rounding, if appropriate.
+    const float fahrenheitRounded = NumericPrecision<float>::enforce(weather.temperatureFahrenheit());
+    if (fahrenheitRounded != weather.temperatureFahrenheit())
+    {
+      weather.setTemperatureFahrenheit(fahrenheitRounded);
+    }
+    weather.setTemperatureKelvin(static_cast<float>(weather.temperatureCelsius() + 273.15));
+  }
+  // relative humidity, [0;1]
+  error = dataPoint["humidity"].get_double().get(number);
+  if (!error)
+  {
+    const long int humidity = std::lround(number * 100);
+    weather.setHumidity(static_cast<int8_t>(humidity));
+  }
+  // rain or snow (mm/m² in an hour)
+  error = dataPoint["precipIntensity"].get_double().get(number);
+  if (!error)
+  {
+    const float amount = static_cast<float>(number);
+    std::string_view typeStr;
+    const auto typeError = dataPoint["precipType"].get_string().get(typeStr);
+    if (!typeError)
+    {
+      if (typeStr == "rain")
+      {
+        weather.setRain(amount);
+        weather.setSnow(0.0);
+      }
+      else if (typeStr == "snow")
+      {
+        weather.setRain(0.0);
+        weather.setSnow(amount);
+      }
+      else if (typeStr == "sleet")
+      {
+        // Sleet could be described as mixture of snow and rain.
+        weather.setRain(amount);
+        weather.setSnow(amount);
+      }
+      else
+      {
+        std::cerr << "Error in SimdJsonOnDemandDarkSky::parseCurrentWeather(): Unknown precipType "
+                  << typeStr << "!" << std::endl;
+        return false;
+      }
+    }
+    // precipType may not be present, if precipIntensity is zero.
+    else if (amount == 0.0)
+    {
+      weather.setRain(0.0);
+      weather.setSnow(0.0);
+    }
+    else
+    {
+      std::cerr << "Error in SimdJsonOnDemandDarkSky::parseCurrentWeather(): Missing precipType!"
+                << std::endl;
+      return false;
+    }
+  } // if precipIntensity
+  // pressure [hPa]
+  error = dataPoint["pressure"].get_double().get(number);
+  if (!error)
+  {
+    const int16_t press = static_cast<int16_t>(std::lround(number));
+    weather.setPressure(press);
+  }
+  // wind speed [m/s]
+  error = dataPoint["windSpeed"].get_double().get(number);
+  if (!error)
+  {
+    weather.setWindSpeed(static_cast<float>(number));
+  }
+  // wind windBearing [°], with 0=N,90=E,180=S,270=W
+  error = dataPoint["windBearing"].get_double().get(number);
+  if (!error)
+  {
+    const int16_t degrees = static_cast<int16_t>(std::lround(number));
+    weather.setWindDegrees(degrees);
+  }
+  // cloud cover, [0;1]
+  error = dataPoint["cloudCover"].get_double().get(number);
+  if (!error)
+  {
+    long int cloudCover = std::min(101L, std::lround(number * 100));
+    cloudCover = std::max(-1L, cloudCover);
+    weather.setCloudiness(static_cast<int8_t>(cloudCover));
+  }
+  return weather.hasDataTime() && weather.hasTemperatureCelsius() && weather.hasHumidity();
+}
+
+} // namespace
@@ -0,0 +1,876 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SimdJsonOnDemandOpenMeteo.hpp"
+#include <iostream>
+#include <memory>
+#include "OpenMeteoFunctions.hpp"
+#include "SimdJsonParser.hpp"
+
+namespace wic
+{
+
+bool SimdJsonOnDemandOpenMeteo::parseCurrentWeather(const std::string& json, Weather& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::object root;
+  if (doc.get_object().get(root) || !parseCurrentWeatherElement(root, weather))
+    return false;
+
+  // There is no more data in current weather in Open-Meteo.
+  weather.setJson(json);
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeatherBatch(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  simdjson::ondemand::array locations;
+  if (doc.get_array().get(locations))
+  {
+    Weather w;
+    simdjson::ondemand::object root;
+    if (doc.get_object().get(root) || !parseCurrentWeatherElement(root, w))
+      return false;
+    w.setJson(json);
+    weather.push_back(w);
+    return true;
+  }
+  for (auto value : locations)
+  {
+    Weather w;
+    simdjson::ondemand::object elem;
+    if (value.get_object().get(elem) || !parseCurrentWeatherElement(elem, w))
+      return false;
+    std::string_view raw;
+    if (elem.raw_json().get(raw))
+      return false;
+    w.setJson(SimdJsonParser::minify(raw));
+    weather.push_back(w);
+  }
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseCurrentWeatherElement(simdjson::ondemand::object& doc, Weather& weather)
+{
+  simdjson::ondemand::object current_weather;
+  auto error = doc["current_weather"].get_object().get(current_weather);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+              << "element 'current_weather' is either missing or not an object!"
+              << std::endl;
+    return false;
+  }
+
+  double number = 0.0;
+  error = current_weather["temperature"].get_double().get(number);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+              << "element 'temperature' is either missing or not a floating "
+              << "point value!" << std::endl;
+    return false;
+  }
+  const double celsius = number;
+  weather.setTemperatureCelsius(celsius);
+  weather.setTemperatureFahrenheit(celsius * 1.8 + 32.0);
+  weather.setTemperatureKelvin(celsius + 273.15);
+
+  error = current_weather["windspeed"].get_double().get(number);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+              << "element 'windspeed' is either missing or not a floating "
+              << "point value!" << std::endl;
+    return false;
+  }
+  weather.setWindSpeed(number);
+
+  error = current_weather["winddirection"].get_double().get(number);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+              << "element 'winddirection' is either missing or not a number!"
+              << std::endl;
+    return false;
+  }
+  weather.setWindDegrees(number);
+
+  // Requests with timeformat=unixtime get a Unix timestamp instead of a string.
+  simdjson::ondemand::value time;
+  simdjson::ondemand::json_type type;
+  error = current_weather["time"].get(time);
+  if (!error && !time.type().get(type) && type == simdjson::ondemand::json_type::number)
+  {
+    int64_t seconds = 0;
+    if (time.get_int64().get(seconds))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+                << "element 'time' is not an integer!" << std::endl;
+      return false;
+    }
+    int64_t utcOffset = 0;
+    if (doc["utc_offset_seconds"].get_int64().get(utcOffset))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+                << "element 'utc_offset_seconds' is either missing or not an "
+                << "integer!" << std::endl;
+      return false;
+    }
+    const auto dt = unixTimeToTime(seconds, utcOffset);
+    if (!dt.has_value())
+    {
+      return false;
+    }
+    weather.setDataTime(dt.value());
+    return true;
+  }
+  std::string_view timeString;
+  if (error || time.get_string().get(timeString))
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentWeather(): JSON "
+              << "element 'time' is either missing or neither a string nor an integer!"
+              << std::endl;
+    return false;
+  }
+  const auto dt = isoStringToTime(timeString);
+  if (!dt.has_value())
+  {
+    return false;
+  }
+  weather.setDataTime(dt.value());
+  return true;
+}
+
+std::optional<std::string> SimdJsonOnDemandOpenMeteo::hourlyUnitCheck(simdjson::ondemand::object& doc, bool& unixTime)
+{
+  simdjson::ondemand::object hourly_units;
+  auto error = doc["hourly_units"].get_object().get(hourly_units);
+  if (error)
+  {
+    return std::optional("Data about hourly units is missing or not a JSON object!");
+  }
+  std::string_view unit;
+  // "time" is usually "iso8601", values are something like "2022-10-12T04:00" then.
+  // However, "unixtime" uses Unix timestamps instead.
+  error = hourly_units["time"].get_string().get(unit);
+  if (error || (unit != "iso8601" && unit != "unixtime"))
+    return std::optional("Time format is missing or neither ISO 8601 nor Unix time.");
+  unixTime = unit == "unixtime";
+  // "temperature_2m" should be "°C" for Celsius scale.
+  error = hourly_units["temperature_2m"].get_string().get(unit);
+  if (error || unit != "°C")
+    return std::optional("Temperature unit is missing or not degrees Celsius.");
+  // "relativehumidity_2m" is always "%".
+  error = hourly_units["relativehumidity_2m"].get_string().get(unit);
+  if (error || unit != "%")
+    return std::optional("Relative humidity unit is missing or not a percentage.");
+  // "rain" should be "mm" for millimeters.
+  error = hourly_units["rain"].get_string().get(unit);
+  if (error || unit != "mm")
+    return std::optional("Rain unit is missing or not millimeters.");
+  // "showers" should be "mm" for millimeters.
+  error = hourly_units["showers"].get_string().get(unit);
+  if (error || unit != "mm")
+    return std::optional("Shower unit is missing or not millimeters.");
+  // "snowfall" should be "cm" for centimeters.
+  error = hourly_units["snowfall"].get_string().get(unit);
+  if (error || unit != "cm")
+    return std::optional("Snowfall unit is missing or not centimeters.");
+  // "pressure_msl" should be "hPa" for hectopascal.
+  error = hourly_units["pressure_msl"].get_string().get(unit);
+  if (error || unit != "hPa")
+    return std::optional("Pressure unit is missing or not hPa.");
+  // "surface_pressure" should be "hPa" for hectopascal.
+  error = hourly_units["surface_pressure"].get_string().get(unit);
+  if (error || unit != "hPa")
+    return std::optional("Pressure unit is missing or not hPa.");
+  // "cloudcover" is always "%".
+  error = hourly_units["cloudcover"].get_string().get(unit);
+  if (error || unit != "%")
+    return std::optional("Cloud cover unit is missing or not a percentage.");
+  // "windspeed_10m" should be "m/s" for meters per second.
+  error = hourly_units["windspeed_10m"].get_string().get(unit);
+  if (error || unit != "m/s")
+    return std::optional("Wind speed unit is missing or not m/s.");
+  // "winddirection_10m" should be "°" for degrees.
+  error = hourly_units["winddirection_10m"].get_string().get(unit);
+  if (error || unit != "°")
+    return std::optional("Wind direction unit is missing or not degrees.");
+
+  // All units match the expected values.
+  return std::nullopt;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseTemperature(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column)
+{
+  simdjson::ondemand::array temperature;
+  const auto error = hourly["temperature_2m"].get_array().get(temperature);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'hourly.temperature_2m' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (temperature.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.temperature_2m does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: temperature)
+  {
+    double celsius = 0.0;
+    if (elem.get_double().get(celsius))
+    {
+      std::cerr << "Error: Temperature element is not a floating point value!" << std::endl;
+      return false;
+    }
+    column.push_back(celsius);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseHumidity(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<int64_t>& column)
+{
+  simdjson::ondemand::array humidity;
+  const auto error = hourly["relativehumidity_2m"].get_array().get(humidity);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.relativehumidity_2m' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (humidity.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.relativehumidity_2m does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: humidity)
+  {
+    int64_t value = 0;
+    if (elem.get_int64().get(value))
+    {
+      std::cerr << "Error: Humidity element is not an integer value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseRain(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column)
+{
+  simdjson::ondemand::array rain;
+  const auto error = hourly["rain"].get_array().get(rain);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.rain' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (rain.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.rain does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: rain)
+  {
+    double value = 0.0;
+    if (elem.get_double().get(value))
+    {
+      std::cerr << "Error: Rain element is not a floating point value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseSnowfall(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column)
+{
+  simdjson::ondemand::array snowfall;
+  const auto error = hourly["snowfall"].get_array().get(snowfall);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.snowfall' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (snowfall.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.snowfall does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: snowfall)
+  {
+    double value = 0.0;
+    if (elem.get_double().get(value))
+    {
+      std::cerr << "Error: Snowfall element is not a floating point value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parsePressure(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column)
+{
+  simdjson::ondemand::array pressure_msl;
+  const auto error = hourly["pressure_msl"].get_array().get(pressure_msl);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.pressure_msl' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (pressure_msl.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.pressure_msl does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: pressure_msl)
+  {
+    double value = 0.0;
+    if (elem.get_double().get(value))
+    {
+      std::cerr << "Error: Pressure element is not a floating point value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseCloudCover(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<int64_t>& column)
+{
+  simdjson::ondemand::array clouds;
+  const auto error = hourly["cloudcover"].get_array().get(clouds);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.cloudcover' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (clouds.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.cloudcover does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: clouds)
+  {
+    int64_t value = 0;
+    if (elem.get_int64().get(value))
+    {
+      std::cerr << "Error: Cloud cover element is not an integer value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseWindSpeed(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column)
+{
+  simdjson::ondemand::array windspeed_10m;
+  const auto error = hourly["windspeed_10m"].get_array().get(windspeed_10m);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.windspeed_10m' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (windspeed_10m.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.windspeed_10m does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: windspeed_10m)
+  {
+    double value = 0.0;
+    if (elem.get_double().get(value))
+    {
+      std::cerr << "Error: Wind speed element is not a floating point value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseWindDirection(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<int64_t>& column)
+{
+  simdjson::ondemand::array winddirection_10m;
+  const auto error = hourly["winddirection_10m"].get_array().get(winddirection_10m);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element "
+              << "'hourly.winddirection_10m' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t count = 0;
+  if (winddirection_10m.count_elements().get(count) || count != expected)
+  {
+    std::cerr << "Error: Number of elements in hourly.winddirection_10m does not "
+              << "match the expected value of " << expected << ". It is "
+              << count << " instead." << std::endl;
+    return false;
+  }
+  column.reserve(expected);
+  for (auto elem: winddirection_10m)
+  {
+    int64_t value = 0;
+    if (elem.get_int64().get(value))
+    {
+      std::cerr << "Error: Wind direction element is not an integer value!" << std::endl;
+      return false;
+    }
+    column.push_back(value);
+  }
+
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseForecast(const std::string& json, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  forecast.setJson(json);
+  simdjson::ondemand::object root;
+  if (doc.get_object().get(root))
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON data is not an object!" << std::endl;
+    return false;
+  }
+  return parseForecastElement(root, forecast);
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentAndForecast(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::object root;
+  if (doc.get_object().get(root))
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentAndForecast(): JSON data is not an object!" << std::endl;
+    return false;
+  }
+  // current_weather comes before hourly_units and hourly in the response, so
+  // both parts are found within one pass over the document.
+  if (!parseCurrentWeatherElement(root, weather) || !parseForecastElement(root, forecast))
+    return false;
+  // Both objects get their data from the same response, so they can share it.
+  const auto shared = std::make_shared<const std::string>(json);
+  weather.setJson(shared);
+  forecast.setJson(shared);
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecastBatch(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  forecasts.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  simdjson::ondemand::array locations;
+  if (doc.get_array().get(locations))
+  {
+    Forecast f;
+    f.setJson(json);
+    simdjson::ondemand::object root;
+    if (doc.get_object().get(root) || !parseForecastElement(root, f))
+      return false;
+    forecasts.push_back(f);
+    return true;
+  }
+  for (auto value : locations)
+  {
+    Forecast f;
+    simdjson::ondemand::object elem;
+    if (value.get_object().get(elem) || !parseForecastElement(elem, f))
+      return false;
+    std::string_view raw;
+    if (elem.raw_json().get(raw))
+      return false;
+    f.setJson(SimdJsonParser::minify(raw));
+    forecasts.push_back(f);
+  }
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseCurrentAndForecastBatch(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  forecasts.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  simdjson::ondemand::array locations;
+  if (doc.get_array().get(locations))
+  {
+    Weather w;
+    Forecast f;
+    simdjson::ondemand::object root;
+    if (doc.get_object().get(root) || !parseCurrentWeatherElement(root, w)
+        || !parseForecastElement(root, f))
+      return false;
+    const auto shared = std::make_shared<const std::string>(json);
+    w.setJson(shared);
+    f.setJson(shared);
+    weather.push_back(w);
+    forecasts.push_back(f);
+    return true;
+  }
+  for (auto value : locations)
+  {
+    Weather w;
+    Forecast f;
+    simdjson::ondemand::object elem;
+    if (value.get_object().get(elem) || !parseCurrentWeatherElement(elem, w)
+        || !parseForecastElement(elem, f))
+      return false;
+    std::string_view raw;
+    if (elem.raw_json().get(raw))
+      return false;
+    const auto shared = std::make_shared<const std::string>(SimdJsonParser::minify(raw));
+    w.setJson(shared);
+    f.setJson(shared);
+    weather.push_back(w);
+    forecasts.push_back(f);
+  }
+  return true;
+}
+
+bool SimdJsonOnDemandOpenMeteo::parseForecastElement(simdjson::ondemand::object& doc, Forecast& forecast)
+{
+  bool unixTime = false;
+  const auto optional_error = hourlyUnitCheck(doc, unixTime);
+  if (optional_error.has_value())
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): Unexpected unit values found!"
+              << std::endl << optional_error.value() << std::endl;
+    return false;
+  }
+
+  // Unix timestamps need the offset of the location's time zone to get the
+  // same time points as ISO 8601 times, see unixTimeToTime().
+  int64_t utcOffset = 0;
+  auto error = simdjson::SUCCESS;
+  if (unixTime)
+  {
+    error = doc["utc_offset_seconds"].get_int64().get(utcOffset);
+    if (error)
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+                << " 'utc_offset_seconds' is either missing or not an integer!"
+                << std::endl;
+      return false;
+    }
+  }
+
+  simdjson::ondemand::object hourly;
+  error = doc["hourly"].get_object().get(hourly);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'hourly' is either missing or not an object!" << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::array time;
+  error = hourly["time"].get_array().get(time);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'hourly.time' is either missing or not an array!"
+              << std::endl;
+    return false;
+  }
+  std::size_t element_count = 0;
+  error = time.count_elements().get(element_count);
+  if (error || element_count == 0)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'hourly.time' is an empty array!" << std::endl;
+    return false;
+  }
+  std::vector<Weather> data;
+  data.reserve(element_count);
+  HourlyTimeDecoder decoder;
+  for (auto elem: time)
+  {
+    Weather weather;
+    if (unixTime)
+    {
+      int64_t seconds = 0;
+      if (elem.get_int64().get(seconds))
+      {
+        std::cerr << "Error: Time element is not an integer!" << std::endl;
+        return false;
+      }
+      const auto dt = decoder.decode(seconds, utcOffset);
+      if (!dt.has_value())
+      {
+        return false;
+      }
+      weather.setDataTime(dt.value());
+    }
+    else
+    {
+      std::string_view timeString;
+      if (elem.get_string().get(timeString))
+      {
+        std::cerr << "Error: Time element is not a string!" << std::endl;
+        return false;
+      }
+      const auto dt = decoder.decode(timeString);
+      if (!dt.has_value())
+      {
+        return false;
+      }
+      weather.setDataTime(dt.value());
+    }
+    data.emplace_back(weather);
+  }
+
+  // Read all hourly arrays into columns first, then convert them as a whole.
+  OpenMeteoHourlyColumns columns;
+  if (!parseTemperature(hourly, data.size(), columns.temperature))
+    return false;
+  if (!parseHumidity(hourly, data.size(), columns.humidity))
+    return false;
+  if (!parseRain(hourly, data.size(), columns.rain))
+    return false;
+  if (!parseSnowfall(hourly, data.size(), columns.snowfall))
+    return false;
+  if (!parsePressure(hourly, data.size(), columns.pressure))
+    return false;
+  if (!parseCloudCover(hourly, data.size(), columns.cloudCover))
+    return false;
+  if (!parseWindSpeed(hourly, data.size(), columns.windSpeed))
+    return false;
+  if (!parseWindDirection(hourly, data.size(), columns.windDirection))
+    return false;
+  setHourlyData(columns, data);
+
+  forecast.setData(data);
+  return true;
+}
+
+#ifdef wic_openmeteo_find_location
+bool SimdJsonOnDemandOpenMeteo::parseLocations(const std::string& json, std::vector<Location>& locations)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseLocations(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  locations.clear();
+
+  simdjson::ondemand::value results;
+  error = doc["results"].get(results);
+  if (error)
+  {
+    double generationTime = 0.0;
+    error = doc["generationtime_ms"].get_double().get(generationTime);
+    if (error)
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseLocations(): JSON data "
+                << "is not a geocoding API result." << std::endl;
+      return false;
+    }
+
+    // No results array means no match was found.
+    // This is a valid outcome.
+    return true;
+  }
+  simdjson::ondemand::array resultArray;
+  if (results.get_array().get(resultArray))
+  {
+    std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseLocations(): JSON element"
+              << " 'results' is not an array!" << std::endl;
+    return false;
+  }
+  for (auto value: resultArray)
+  {
+    simdjson::ondemand::object elem;
+    if (value.get_object().get(elem))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseLocations(): Array element"
+              << " of 'results' is not an object!" << std::endl;
+      return false;
+    }
+    Location loc;
+    std::string_view text;
+    error = elem["name"].get_string().get(text);
+    if (error)
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'name' is either missing or not a string!" << std::endl;
+      return false;
+    }
+    loc.setName(text);
+
+    error = elem["country_code"].get_string().get(text);
+    if (error)
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'country_code' is either missing or not a string!" << std::endl;
+      return false;
+    }
+    loc.setCountryCode(text);
+
+    double number = 0.0;
+    error = elem["latitude"].get_double().get(number);
+    if (error)
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'latitude' is either missing or not a number!" << std::endl;
+      return false;
+    }
+    loc.setCoordinates(number, 0.0);
+
+    error = elem["longitude"].get_double().get(number);
+    if (error)
+    {
+      std::cerr << "Error in SimdJsonOnDemandOpenMeteo::parseForecast(): JSON element"
+              << " 'longitude' is either missing or not a number!" << std::endl;
+      return false;
+    }
+    loc.setCoordinates(loc.latitude(), number);
+
+    locations.emplace_back(loc);
+  }
+
+  return true;
+}
+#endif // wic_openmeteo_find_location
+
+} // namespace
@@ -0,0 +1,167 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_SIMDJSONONDEMANDOPENMETEO_HPP
+#define WEATHER_INFORMATION_COLLECTOR_SIMDJSONONDEMANDOPENMETEO_HPP
+
+#include <optional>
+#include <vector>
+#include "../../third-party/simdjson/simdjson.h"
+#include "../data/Forecast.hpp"
+#include "../data/Weather.hpp"
+#ifdef wic_openmeteo_find_location
+#include "../data/Location.hpp"
+#endif // wic_openmeteo_find_location
+
+namespace wic
+{
+
+/** \brief Handles JSON input from the OpenMeteo API with the On-Demand API of
+ *         the simdjson library.
+ */
+class SimdJsonOnDemandOpenMeteo
+{
+  public:
+    /** \brief Parses the current weather information from JSON into the Weather object.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeather(const std::string& json, Weather& weather);
+
+    /** \brief Parses the weather forecast information from JSON into Weather objects.
+     *
+     * \param json     string containing the JSON
+     * \param forecast variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseForecast(const std::string& json, Forecast& forecast);
+
+
+    /** \brief Parses current weather and forecast information from the same
+     * JSON response into a Weather and a Forecast object. The JSON is only
+     * parsed once, and both objects share the same raw JSON data.
+     *
+     * \param json     string containing the JSON
+     * \param weather  variable where the current weather will be stored
+     * \param forecast variable where the forecast will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentAndForecast(const std::string& json, Weather& weather, Forecast& forecast);
+
+
+    /** \brief Parses the current weather information of several locations
+     *         from JSON into Weather objects.
+     *
+     * \param json     string containing the JSON, usually an array with one
+     *                 element per location
+     * \param weather  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather);
+
+
+    /** \brief Parses the weather forecast information of several locations
+     *         from JSON into Forecast objects.
+     *
+     * \param json       string containing the JSON, usually an array with one
+     *                   element per location
+     * \param forecasts  variable where the results will be stored, one per location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts);
+
+
+    /** \brief Parses current weather and forecast information of several
+     *         locations from the same JSON response into Weather and Forecast
+     *         objects. The JSON is only parsed once, and the Weather and the
+     *         Forecast of a location share the same raw JSON data.
+     *
+     * \param json       string containing the JSON, usually an array with one
+     *                   element per location
+     * \param weather    variable where the current weather will be stored, one
+     *                   per location
+     * \param forecasts  variable where the forecasts will be stored, one per
+     *                   location
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts);
+
+    #ifdef wic_openmeteo_find_location
+    /** \brief Parses found locations.
+     *
+     * \param json     string containing the JSON
+     * \param locations  variable where parsed locations will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseLocations(const std::string& json, std::vector<Location>& locations);
+    #endif // wic_openmeteo_find_location
+  private:
+    /** \brief Parses the current weather of a single location.
+     *
+     * \param doc      JSON object of the location
+     * \param weather  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseCurrentWeatherElement(simdjson::ondemand::object& doc, Weather& weather);
+
+
+    /** \brief Parses the weather forecast of a single location.
+     *
+     * \param doc       JSON object of the location
+     * \param forecast  variable where result of the parsing process will be stored
+     * \return Returns true, if the parsing was successful.
+     *         Returns false, if an error occurred.
+     */
+    static bool parseForecastElement(simdjson::ondemand::object& doc, Forecast& forecast);
+
+
+    /** \brief Checks whether the units match the expected values.
+     *
+     * \param doc       JSON object of the location
+     * \param unixTime  variable that receives whether times are Unix timestamps
+     *                  instead of ISO 8601 strings
+     * \return Returns an empty optional, if units are correct.
+     *         Returns an error message otherwise.
+     */
+    static std::optional<std::string> hourlyUnitCheck(simdjson::ondemand::object& doc, bool& unixTime);
+
+    static bool parseTemperature(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseHumidity(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<int64_t>& column);
+    static bool parseRain(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseSnowfall(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parsePressure(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseCloudCover(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<int64_t>& column);
+    static bool parseWindSpeed(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<double>& column);
+    static bool parseWindDirection(simdjson::ondemand::object& hourly, const std::size_t expected, std::vector<int64_t>& column);
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_SIMDJSONONDEMANDOPENMETEO_HPP
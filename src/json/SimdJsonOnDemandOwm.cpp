@@ -0,0 +1,374 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SimdJsonOnDemandOwm.hpp"
+#include <iostream>
+#include "SimdJsonParser.hpp"
+#include "../util/NumericPrecision.hpp"
+
+namespace wic
+{
+
+bool SimdJsonOnDemandOwm::parseSingleWeatherItem(value_type& value, Weather& weather)
+{
+  bool foundValidParts = false;
+  simdjson::ondemand::object obj;
+  double number = 0.0;
+  // The order of the elements differs between current weather data and
+  // forecast items, and some of them are missing in most items. So every
+  // field lookup would have to search through the whole item. One pass over
+  // all fields avoids that. Callers may already have looked up other fields
+  // of the item, so the iteration has to start from the beginning.
+  if (value.reset().error())
+    return false;
+  for (auto field : value)
+  {
+    simdjson::ondemand::raw_json_string key;
+    auto error = field.key().get(key);
+    if (error)
+      return false;
+    if (key == "main")
+    {
+      error = field.value().get_object().get(obj);
+      if (error)
+        continue;
+      error = obj["temp"].get_double().get(number);
+      if (!error)
+      {
+        const double kelvinRaw = number;
+        weather.setTemperatureKelvin(static_cast<float>(kelvinRaw));
+        // Avoid values like 280.9999... K by rounding, if appropriate.
+        const float kelvinRounded = NumericPrecision<float>::enforce(weather.temperatureKelvin());
+        if (kelvinRounded != weather.temperatureKelvin())
+        {
+          weather.setTemperatureKelvin(kelvinRounded);
+        }
+        weather.setTemperatureCelsius(static_cast<float>(kelvinRaw - 273.15));
+        // Avoid values like 6.9999... ° C by rounding, if appropriate.
+        const float celsiusRounded = NumericPrecision<float>::enforce(weather.temperatureCelsius());
+        if (celsiusRounded != weather.temperatureCelsius())
+        {
+          weather.setTemperatureCelsius(celsiusRounded);
+        }
+        weather.setTemperatureFahrenheit(static_cast<float>((kelvinRaw - 273.15) * 1.8 + 32.0));
+        // Avoid values like 6.9999... ° F by rounding, if appropriate.
+        const float fahrenheitRounded = NumericPrecision<float>::enforce(weather.temperatureFahrenheit());
+        if (fahrenheitRounded != weather.temperatureFahrenheit())
+        {
+          weather.setTemperatureFahrenheit(fahrenheitRounded);
+        }
+      }
+      error = obj["pressure"].get_double().get(number);
+      if (!error)
+        weather.setPressure(static_cast<int16_t>(number));
+      uint64_t humidity = 0;
+      error = obj["humidity"].get_uint64().get(humidity);
+      if (!error)
+        weather.setHumidity(static_cast<int8_t>(humidity));
+      foundValidParts = true;
+    } // if main object
+    else if (key == "wind")
+    {
+      error = field.value().get_object().get(obj);
+      if (error)
+        continue;
+      error = obj["speed"].get_double().get(number);
+      if (!error)
+        weather.setWindSpeed(static_cast<float>(number));
+      error = obj["deg"].get_double().get(number);
+      if (!error)
+        weather.setWindDegrees(static_cast<int16_t>(number));
+    } // if wind object
+    else if (key == "clouds")
+    {
+      error = field.value().get_object().get(obj);
+      if (error)
+        continue;
+      int64_t clouds = 0;
+      error = obj["all"].get_int64().get(clouds);
+      if (!error)
+        weather.setCloudiness(static_cast<int8_t>(clouds));
+    } // if clouds object
+    else if (key == "rain")
+    {
+      error = field.value().get_object().get(obj);
+      if (error)
+        continue;
+      error = obj["3h"].get_double().get(number);
+      if (!error)
+      {
+        weather.setRain(static_cast<float>(number));
+      }
+      else if (error == simdjson::NO_SUCH_FIELD)
+      {
+        // Empty rain object means zero rain.
+        weather.setRain(0.0f);
+      }
+    } // if rain object
+    else if (key == "snow")
+    {
+      error = field.value().get_object().get(obj);
+      if (error)
+        continue;
+      error = obj["3h"].get_double().get(number);
+      if (!error)
+      {
+        weather.setSnow(static_cast<float>(number));
+      }
+      else if (error == simdjson::NO_SUCH_FIELD)
+      {
+        // Empty snow object means zero snow.
+        weather.setSnow(0.0f);
+      }
+    } // if snow object
+    else if (key == "dt")
+    {
+      int64_t dt = 0;
+      error = field.value().get_int64().get(dt);
+      if (!error)
+      {
+        weather.setDataTime(std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(dt)));
+      }
+    } // if dt
+  } // for (range-based)
+  return foundValidParts;
+}
+
+bool SimdJsonOnDemandOwm::parseCurrentWeather(const std::string& json, Weather& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeather(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  weather.setJson(json);
+
+  simdjson::ondemand::object root;
+  if (doc.get_object().get(root))
+    return false;
+  return parseSingleWeatherItem(root, weather);
+}
+
+bool SimdJsonOnDemandOwm::parseForecast(const std::string& json, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  forecast.setJson(json);
+
+  simdjson::ondemand::array list;
+  const auto e2 = doc["list"].get_array().get(list);
+  if (e2)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseForecast(): list is either missing or not an array!" << std::endl;
+    return false;
+  }
+  forecast.setData({ });
+  auto data = forecast.data();
+  for (auto val : list)
+  {
+    Weather w;
+    value_type item;
+    if (!val.get_object().get(item) && parseSingleWeatherItem(item, w))
+    {
+      data.push_back(w);
+    }
+    else
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseForecast(): Parsing single item failed!" << std::endl;
+      return false;
+    }
+  } // for (range-based)
+  uint64_t cntValue = 0;
+  const auto e3 = doc["cnt"].get_uint64().get(cntValue);
+  if (e3)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseForecast(): cnt is either missing or not an integer!" << std::endl;
+    return false;
+  }
+  // Number of data items should be the number given in "cnt".
+  if (data.size() != cntValue)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseForecast(): Expected " << cntValue
+              << " items, but " << data.size() << " items were found!" << std::endl;
+    return false;
+  }
+  forecast.setData(data);
+  return true;
+}
+
+bool SimdJsonOnDemandOwm::parseCurrentWeatherGroup(const std::string& json, std::vector<std::pair<uint32_t, Weather> >& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::array list;
+  const auto e2 = doc["list"].get_array().get(list);
+  if (e2)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): list is either missing or not an array!" << std::endl;
+    return false;
+  }
+  weather.clear();
+  for (auto val : list)
+  {
+    value_type item;
+    uint64_t id = 0;
+    if (val.get_object().get(item) || item["id"].get_uint64().get(id))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): id is either missing or not an integer!" << std::endl;
+      return false;
+    }
+    Weather w;
+    if (!parseSingleWeatherItem(item, w))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): Parsing single item failed!" << std::endl;
+      return false;
+    }
+    // Each item has the same structure as the response for a single location.
+    std::string_view raw;
+    if (item.raw_json().get(raw))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): Item is not valid JSON!" << std::endl;
+      return false;
+    }
+    w.setJson(SimdJsonParser::minify(raw));
+    weather.emplace_back(static_cast<uint32_t>(id), w);
+  } // for (range-based)
+  uint64_t cntValue = 0;
+  const auto e3 = doc["cnt"].get_uint64().get(cntValue);
+  if (e3)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): cnt is either missing or not an integer!" << std::endl;
+    return false;
+  }
+  if (weather.size() != cntValue)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseCurrentWeatherGroup(): Expected " << cntValue
+              << " items, but " << weather.size() << " items were found!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+#ifdef wic_owm_find_location
+bool SimdJsonOnDemandOwm::parseLocations(const std::string& json, std::vector<std::pair<Location, Weather> >& locations)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto error = SimdJsonParser::iterate(json, copy).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseLocations(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  int64_t count = 0;
+  const auto e2 = doc["count"].get_int64().get(count);
+  if (e2)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseLocations(): JSON element for count is missing!" << std::endl;
+    return false;
+  }
+  locations.clear();
+  if (count == 0)
+    return true;
+
+  simdjson::ondemand::array list;
+  const auto e3 = doc["list"].get_array().get(list);
+  if (e3)
+  {
+    std::cerr << "Error in SimdJsonOnDemandOwm::parseLocations(): JSON list element is missing!" << std::endl;
+    return false;
+  }
+
+  for (auto val : list)
+  {
+    value_type elem;
+    if (val.get_object().get(elem))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseLocations(): Location data is empty!" << std::endl;
+      return false;
+    }
+    Location loc;
+    uint64_t id = 0;
+    if (!elem["id"].get_uint64().get(id))
+      loc.setOwmId(static_cast<uint32_t>(id));
+    std::string_view text;
+    if (!elem["name"].get_string().get(text))
+      loc.setName(text);
+    simdjson::ondemand::object coord;
+    if (!elem["coord"].get_object().get(coord))
+    {
+      double lat = 0.0;
+      const auto errorLat = coord["lat"].get_double().get(lat);
+      double lon = 0.0;
+      const auto errorLon = coord["lon"].get_double().get(lon);
+      if (!errorLat && !errorLon)
+      {
+        loc.setCoordinates(static_cast<float>(lat), static_cast<float>(lon));
+      }
+    } // coord
+    if (loc.empty())
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseLocations(): Location data is empty!" << std::endl;
+      return false;
+    }
+    simdjson::ondemand::object sys;
+    if (!elem["sys"].get_object().get(sys))
+    {
+      if (!sys["country"].get_string().get(text))
+        loc.setCountryCode(text);
+    }
+    Weather w;
+    if (!SimdJsonOnDemandOwm::parseSingleWeatherItem(elem, w))
+    {
+      std::cerr << "Error in SimdJsonOnDemandOwm::parseLocations(): Weather data for location is missing!" << std::endl;
+      return false;
+    }
+    // add element to result
+    locations.emplace_back(loc, w);
+  } // for
+
+  return true;
+}
+#endif // wic_owm_find_location
+
+} // namespace
@@ -0,0 +1,276 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SimdJsonOnDemandWeatherbit.hpp"
+#include <iostream>
+#include "SimdJsonParser.hpp"
+#include "../util/NumericPrecision.hpp"
+
+namespace wic
+{
+
+bool SimdJsonOnDemandWeatherbit::itemObject(simdjson::simdjson_result<simdjson::ondemand::value> value, value_type& item)
+{
+  if (!value.get_object().get(item))
+    return true;
+  simdjson::ondemand::json_type type;
+  if (value.type().get(type))
+  {
+    std::cerr << "Error: Item is missing or it is not valid JSON!\n";
+    return false;
+  }
+  std::cerr << "Error: Type of item is " << type << ", but it should be object!\n";
+  return false;
+}
+
+bool SimdJsonOnDemandWeatherbit::parseSingleWeatherItem(value_type& value, Weather& weather)
+{
+  double number = 0.0;
+  uint64_t integer = 0;
+  // Items have more than thirty elements, but only a few of them are used
+  // here. One pass over all fields is cheaper than a lookup for each of the
+  // used elements, because every lookup may have to search the whole item.
+  if (value.reset().error())
+    return false;
+  for (auto field : value)
+  {
+    simdjson::ondemand::raw_json_string key;
+    auto error = field.key().get(key);
+    if (error)
+      return false;
+    if (key == "temp")
+    {
+      error = field.value().get_double().get(number);
+      if (!error)
+      {
+        const double celsiusRaw = number;
+        weather.setTemperatureCelsius(static_cast<float>(celsiusRaw));
+        // Avoid values like 5.9999... °C by rounding, if appropriate.
+        const float celsiusRounded = NumericPrecision<float>::enforce(weather.temperatureCelsius());
+        if (celsiusRounded != weather.temperatureCelsius())
+        {
+          weather.setTemperatureCelsius(celsiusRounded);
+        }
+        weather.setTemperatureKelvin(static_cast<float>(celsiusRaw + 273.15));
+        // Avoid values like 280.9999... K by rounding, if appropriate.
+        const float kelvinRounded = NumericPrecision<float>::enforce(weather.temperatureKelvin());
+        if (kelvinRounded != weather.temperatureKelvin())
+        {
+          weather.setTemperatureKelvin(kelvinRounded);
+        }
+        weather.setTemperatureFahrenheit(static_cast<float>(celsiusRaw * 1.8 + 32.0));
+        // Avoid values like 6.9999... ° F by rounding, if appropriate.
+        const float fahrenheitRounded = NumericPrecision<float>::enforce(weather.temperatureFahrenheit());
+        if (fahrenheitRounded != weather.temperatureFahrenheit())
+        {
+          weather.setTemperatureFahrenheit(fahrenheitRounded);
+        }
+      }
+    }
+    else if (key == "rh")
+    {
+      if (!field.value().get_uint64().get(integer))
+        weather.setHumidity(static_cast<int8_t>(integer));
+    }
+    else if (key == "precip")
+    {
+      if (!field.value().get_double().get(number))
+        weather.setRain(static_cast<float>(number));
+    }
+    else if (key == "snow")
+    {
+      if (!field.value().get_double().get(number))
+        weather.setSnow(static_cast<float>(number));
+    }
+    else if (key == "pres")
+    {
+      if (!field.value().get_double().get(number))
+        weather.setPressure(static_cast<int16_t>(number));
+    }
+    else if (key == "wind_spd")
+    {
+      if (!field.value().get_double().get(number))
+        weather.setWindSpeed(static_cast<float>(number));
+    }
+    else if (key == "wind_dir")
+    {
+      if (!field.value().get_uint64().get(integer))
+        weather.setWindDegrees(static_cast<int16_t>(integer));
+    }
+    else if (key == "clouds")
+    {
+      if (!field.value().get_uint64().get(integer))
+        weather.setCloudiness(static_cast<int8_t>(integer));
+    }
+    else if (key == "ts")
+    {
+      if (!field.value().get_double().get(number))
+      {
+        // I'm not sure whether this really works as expected.
+        // Weatherbit's documentation says the timestamp is UTC, but tests show that
+        // this may not be the case.
+        const auto dt = std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(static_cast<int64_t>(number)));
+        weather.setDataTime(dt);
+      }
+    } // if ts
+  } // for (range-based)
+  return weather.hasDataTime();
+}
+
+bool SimdJsonOnDemandWeatherbit::parseCurrentWeather(const std::string& json, Weather& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto parseError = SimdJsonParser::iterate(json, copy).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeather(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::array data;
+  const auto errorData = doc["data"].get_array().get(data);
+  if (errorData)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeather(): JSON "
+              << "does not contain a data element or data element is not an "
+              << "array containing a single element!" << std::endl;
+    return false;
+  }
+  uint64_t count = 0;
+  const auto errorCount = doc["count"].get_uint64().get(count);
+  if (errorCount)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeather(): JSON does not contain a count element or the element is not a valid number!" << std::endl;
+    return false;
+  }
+  if (count != 1)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeather(): Expected count to be 1, but the actual count is "
+              << count << "!" << std::endl;
+    return false;
+  }
+
+  weather.setJson(json);
+
+  // The lookup of count has moved past the data array, so it has to be found
+  // again.
+  value_type item;
+  if (doc["data"].get_array().get(data) || !itemObject(data.at(0), item))
+    return false;
+  return parseSingleWeatherItem(item, weather);
+}
+
+bool SimdJsonOnDemandWeatherbit::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto parseError = SimdJsonParser::iterate(json, copy).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeatherBatch(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  simdjson::ondemand::array data;
+  const auto errorData = doc["data"].get_array().get(data);
+  if (errorData)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeatherBatch(): JSON "
+              << "does not contain a data element or data element is not an "
+              << "array!" << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  for (auto value : data)
+  {
+    Weather w;
+    value_type item;
+    if (!itemObject(value, item) || !parseSingleWeatherItem(item, w))
+      return false;
+    std::string_view raw;
+    if (item.raw_json().get(raw))
+      return false;
+    // Keep the JSON in the same form as the response for a single location.
+    w.setJson("{\"data\":[" + SimdJsonParser::minify(raw) + "],\"count\":1}");
+    weather.push_back(w);
+  }
+  uint64_t count = 0;
+  const auto errorCount = doc["count"].get_uint64().get(count);
+  if (errorCount)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeatherBatch(): JSON does not contain a count element or the element is not a valid number!" << std::endl;
+    return false;
+  }
+  if (weather.size() != count)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseCurrentWeatherBatch(): Expected "
+              << count << " items, but " << weather.size()
+              << " items were found!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool SimdJsonOnDemandWeatherbit::parseForecast(const std::string& json, Forecast& forecast)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto parseError = SimdJsonParser::iterate(json, copy).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseForecast(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  forecast.setJson(json);
+
+  simdjson::ondemand::array dataJson;
+  const auto errorData = doc["data"].get_array().get(dataJson);
+  if (errorData)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseForecast(): data is not an array!" << std::endl;
+    return false;
+  }
+  forecast.setData({ });
+  auto data = forecast.data();
+  for (auto value : dataJson)
+  {
+    Weather w;
+    value_type item;
+    if (itemObject(value, item) && parseSingleWeatherItem(item, w))
+    {
+      data.push_back(w);
+    }
+    else
+    {
+      std::cerr << "Error in SimdJsonOnDemandWeatherbit::parseForecast(): Parsing single item failed!" << std::endl;
+      return false;
+    }
+  } // for (range-based)
+  forecast.setData(data);
+  return !forecast.data().empty();
+}
+
+} // namespace
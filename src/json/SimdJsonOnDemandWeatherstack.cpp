@@ -0,0 +1,163 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SimdJsonOnDemandWeatherstack.hpp"
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "../../third-party/simdjson/simdjson.h"
+#include "SimdJsonParser.hpp"
+#include "WeatherstackFunctions.hpp"
+#include "../util/NumericPrecision.hpp"
+
+namespace wic
+{
+
+std::chrono::time_point<std::chrono::system_clock> parseDateTime(simdjson::ondemand::document& root)
+{
+  // date of data update
+  simdjson::ondemand::object location;
+  const auto errorLoc = root["location"].get_object().get(location);
+  if (!errorLoc)
+  {
+    std::string_view localtime;
+    const auto e1 = location["localtime"].get_string().get(localtime);
+    if (!e1)
+    {
+      // This string streams and C-style function stuff is a mess.
+      // Should probably switch to Howard Hinnant's date.h or (later) C++20 in
+      // the future.
+      const std::string timeString = std::string(localtime);
+      std::istringstream stream(timeString);
+      std::tm t_old = {};
+      stream >> std::get_time(&t_old, "%Y-%m-%d %H:%M");
+      t_old.tm_isdst = -1; // unknown whether we have DST or not
+      const std::time_t tt = std::mktime(&t_old);
+      if (tt == static_cast<std::time_t>(-1))
+        return std::chrono::time_point<std::chrono::system_clock>();
+      return std::chrono::system_clock::from_time_t(tt);
+    }
+    // fall back to localtime_epoch - less precise / may be wrong timezone
+    int64_t epoch = 0;
+    const auto e2 = location["localtime_epoch"].get_int64().get(epoch);
+    if (!e2)
+    {
+      return std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(epoch));
+    }
+    else
+    {
+      std::cerr << "Error in SimdJsonOnDemandWeatherstack::parseCurrentWeather(): location object does not have an integral localtime_epoch entry!" << std::endl;
+      return std::chrono::time_point<std::chrono::system_clock>();
+    }
+  }
+  else
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherstack::parseCurrentWeather(): JSON does not have a location object!" << std::endl;
+    return std::chrono::time_point<std::chrono::system_clock>();
+  }
+}
+
+bool SimdJsonOnDemandWeatherstack::parseCurrentWeather(const std::string& json, Weather& weather)
+{
+  simdjson::padded_string copy;
+  simdjson::ondemand::document doc;
+  const auto parseError = SimdJsonParser::iterate(json, copy).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonOnDemandWeatherstack::parseCurrentWeather(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  weather.setJson(json);
+
+  simdjson::ondemand::object current;
+  auto error = doc["current"].get_object().get(current);
+  if (!error)
+  {
+    double number = 0.0;
+    int64_t integer = 0;
+    // temperature
+    error = current["temperature"].get_double().get(number);
+    if (!error)
+    {
+      weather.setTemperatureCelsius(static_cast<float>(number));
+      // Since there are no other values (Fahrenheit or Kelvin), we can just
+      // calculate them on the fly.
+      weather.setTemperatureFahrenheit(static_cast<float>(weather.temperatureCelsius() * 1.8 + 32.0));
+      // Avoid values like 6.9999... ° F by rounding, if appropriate.
+      const float fahrenheitRounded = NumericPrecision<float>::enforce(weather.temperatureFahrenheit());
+      if (fahrenheitRounded != weather.temperatureFahrenheit())
+      {
+        weather.setTemperatureFahrenheit(fahrenheitRounded);
+      }
+      weather.setTemperatureKelvin(static_cast<float>(weather.temperatureCelsius() + 273.15));
+    }
+    // wind
+    error = current["wind_degree"].get_int64().get(integer);
+    if (!error)
+      weather.setWindDegrees(static_cast<int16_t>(integer));
+    error = current["wind_speed"].get_double().get(number);
+    if (!error)
+      weather.setWindSpeed(static_cast<float>(number / 3.6));
+    // humidity
+    error = current["humidity"].get_int64().get(integer);
+    if (!error)
+      weather.setHumidity(static_cast<int8_t>(integer));
+    // pressure
+    error = current["pressure"].get_double().get(number);
+    if (!error)
+    {
+      weather.setPressure(static_cast<int16_t>(number));
+    }
+    // rain or snow
+    error = current["precip"].get_double().get(number);
+    if (!error)
+    {
+      int64_t weather_code = 0;
+      const auto errorCode = current["weather_code"].get_int64().get(weather_code);
+      const int code = !errorCode ? static_cast<int>(weather_code) : 0;
+      weatherstackPrecipitationDistinction(static_cast<float>(number), weather, code);
+    }
+
+    // cloudiness
+    error = current["cloudcover"].get_int64().get(integer);
+    if (!error)
+      weather.setCloudiness(static_cast<int8_t>(integer));
+    // date of data update
+    const auto dt = parseDateTime(doc);
+    if (dt != std::chrono::time_point<std::chrono::system_clock>())
+    {
+      weather.setDataTime(dt);
+      return true;
+    }
+    else
+    {
+      std::cerr << "Error in SimdJsonOnDemandWeatherstack::parseCurrentWeather(): JSON does not have data time!" << std::endl;
+      return false;
+    }
+  } // if current object
+
+  // No current object - return false to indicate failure.
+  return false;
+}
+
+} // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2022, 2023  Dirk Stolle
+    Copyright (C) 2022, 2023, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,17 +20,18 @@
 
 #include "SimdJsonOpenMeteo.hpp"
 #include <iostream>
+#include <memory>
 #include "OpenMeteoFunctions.hpp"
-#include "../util/NumericPrecision.hpp"
+#include "SimdJsonParser.hpp"
 
 namespace wic
 {
 
 bool SimdJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather& weather)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
-  auto error = parser.parse(json).get(doc);
+  const auto error = parser.parse(json).get(doc);
   if (error)
   {
     std::cerr << "Error in SimdJsonOpenMeteo::parseCurrentWeather(): Unable to parse JSON data!"
@@ -39,8 +40,55 @@ bool SimdJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather& we
     return false;
   }
 
+  if (!parseCurrentWeatherElement(doc, weather))
+    return false;
+
+  // There is no more data in current weather in Open-Meteo.
+  weather.setJson(json);
+  return true;
+}
+
+bool SimdJsonOpenMeteo::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather)
+{
+  simdjson::dom::parser& parser = SimdJsonParser::get();
+  simdjson::dom::element doc;
+  const auto error = parser.parse(json).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOpenMeteo::parseCurrentWeatherBatch(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  if (!doc.is_array())
+  {
+    Weather w;
+    if (!parseCurrentWeatherElement(doc, w))
+      return false;
+    w.setJson(json);
+    weather.push_back(w);
+    return true;
+  }
+  const simdjson::dom::array locations = doc.get_array().value();
+  for (const simdjson::dom::element elem : locations)
+  {
+    Weather w;
+    if (!parseCurrentWeatherElement(elem, w))
+      return false;
+    w.setJson(simdjson::minify(elem));
+    weather.push_back(w);
+  }
+  return true;
+}
+
+bool SimdJsonOpenMeteo::parseCurrentWeatherElement(const simdjson::dom::element& doc, Weather& weather)
+{
   simdjson::dom::element current_weather;
-  error = doc["current_weather"].get(current_weather);
+  auto error = doc["current_weather"].get(current_weather);
   if (error || !current_weather.is_object())
   {
     std::cerr << "Error in SimdJsonOpenMeteo::parseCurrentWeather(): JSON "
@@ -84,26 +132,43 @@ bool SimdJsonOpenMeteo::parseCurrentWeather(const std::string& json, Weather& we
   weather.setWindDegrees(elem.get<double>().value());
 
   error = current_weather["time"].get(elem);
+  // Requests with timeformat=unixtime get a Unix timestamp instead of a string.
+  if (!error && elem.is<int64_t>())
+  {
+    simdjson::dom::element offset;
+    error = doc["utc_offset_seconds"].get(offset);
+    if (error || !offset.is<int64_t>())
+    {
+      std::cerr << "Error in SimdJsonOpenMeteo::parseCurrentWeather(): JSON "
+                << "element 'utc_offset_seconds' is either missing or not an "
+                << "integer!" << std::endl;
+      return false;
+    }
+    const auto dt = unixTimeToTime(elem.get<int64_t>().value(), offset.get<int64_t>().value());
+    if (!dt.has_value())
+    {
+      return false;
+    }
+    weather.setDataTime(dt.value());
+    return true;
+  }
   if (error || !elem.is_string())
   {
     std::cerr << "Error in SimdJsonOpenMeteo::parseCurrentWeather(): JSON "
-              << "element 'time' is either missing or not a string!"
+              << "element 'time' is either missing or neither a string nor an integer!"
               << std::endl;
     return false;
   }
-  const auto dt = isoStringToTime(std::string(elem.get_string().value()));
+  const auto dt = isoStringToTime(elem.get_string().value());
   if (!dt.has_value())
   {
     return false;
   }
   weather.setDataTime(dt.value());
-
-  // There is no more data in current weather in Open-Meteo.
-  weather.setJson(json);
   return true;
 }
 
-std::optional<std::string> SimdJsonOpenMeteo::hourlyUnitCheck(const simdjson::dom::element& doc)
+std::optional<std::string> SimdJsonOpenMeteo::hourlyUnitCheck(const simdjson::dom::element& doc, bool& unixTime)
 {
   simdjson::dom::element hourly_units;
   auto error = doc["hourly_units"].get(hourly_units);
@@ -115,8 +180,10 @@ std::optional<std::string> SimdJsonOpenMeteo::hourlyUnitCheck(const simdjson::do
   // "time" is usually "iso8601", values are something like "2022-10-12T04:00" then.
   // However, "unixtime" uses Unix timestamps instead.
   hourly_units["time"].tie(elem, error);
-  if (error || !elem.is_string() || elem.get_string().value() != "iso8601")
-    return std::optional("Time format is missing or not in ISO 8601 format.");
+  if (error || !elem.is_string()
+      || (elem.get_string().value() != "iso8601" && elem.get_string().value() != "unixtime"))
+    return std::optional("Time format is missing or neither ISO 8601 nor Unix time.");
+  unixTime = elem.get_string().value() == "unixtime";
   // "temperature_2m" should be "°C" for Celsius scale.
   hourly_units["temperature_2m"].tie(elem, error);
   if (error || !elem.is_string() || elem.get_string().value() != "°C")
@@ -162,7 +229,7 @@ std::optional<std::string> SimdJsonOpenMeteo::hourlyUnitCheck(const simdjson::do
   return std::nullopt;
 }
 
-bool SimdJsonOpenMeteo::parseTemperature(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseTemperature(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<double>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["temperature_2m"].get(element);
@@ -174,14 +241,14 @@ bool SimdJsonOpenMeteo::parseTemperature(const simdjson::dom::element& hourly, s
     return false;
   }
   const simdjson::dom::array temperature = element.get_array().value();
-  if (temperature.size() != data.size())
+  if (temperature.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.temperature_2m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << temperature.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: temperature)
   {
     if (!elem.is_double())
@@ -190,28 +257,13 @@ bool SimdJsonOpenMeteo::parseTemperature(const simdjson::dom::element& hourly, s
       return false;
     }
     const double celsius = elem.get_double().value();
-    data[idx].setTemperatureCelsius(celsius);
-    data[idx].setTemperatureFahrenheit(celsius * 1.8 + 32.0);
-    // Avoid values like 6.9999... ° F by rounding, if appropriate.
-    const float fahrenheitRounded = NumericPrecision<float>::enforce(data[idx].temperatureFahrenheit());
-    if (fahrenheitRounded != data[idx].temperatureFahrenheit())
-    {
-      data[idx].setTemperatureFahrenheit(fahrenheitRounded);
-    }
-    data[idx].setTemperatureKelvin(celsius + 273.15);
-    // Avoid values like 296.9999... K by rounding, if appropriate.
-    const float kelvinRounded = NumericPrecision<float>::enforce(data[idx].temperatureKelvin());
-    if (kelvinRounded != data[idx].temperatureKelvin())
-    {
-      data[idx].setTemperatureKelvin(kelvinRounded);
-    }
-    ++idx;
+    column.push_back(celsius);
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parseHumidity(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseHumidity(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<int64_t>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["relativehumidity_2m"].get(element);
@@ -223,14 +275,14 @@ bool SimdJsonOpenMeteo::parseHumidity(const simdjson::dom::element& hourly, std:
     return false;
   }
   const simdjson::dom::array humidity = element.get_array().value();
-  if (humidity.size() != data.size())
+  if (humidity.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.relativehumidity_2m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << humidity.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: humidity)
   {
     if (!elem.is<int64_t>())
@@ -238,14 +290,13 @@ bool SimdJsonOpenMeteo::parseHumidity(const simdjson::dom::element& hourly, std:
       std::cerr << "Error: Humidity element is not an integer value!" << std::endl;
       return false;
     }
-    data[idx].setHumidity(elem.get<int64_t>().value());
-    ++idx;
+    column.push_back(elem.get<int64_t>().value());
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parseRain(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseRain(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<double>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["rain"].get(element);
@@ -257,14 +308,14 @@ bool SimdJsonOpenMeteo::parseRain(const simdjson::dom::element& hourly, std::vec
     return false;
   }
   const simdjson::dom::array rain = element.get_array().value();
-  if (rain.size() != data.size())
+  if (rain.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.rain does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << rain.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: rain)
   {
     if (!elem.is<double>())
@@ -272,14 +323,13 @@ bool SimdJsonOpenMeteo::parseRain(const simdjson::dom::element& hourly, std::vec
       std::cerr << "Error: Rain element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setRain(elem.get<double>().value());
-    ++idx;
+    column.push_back(elem.get<double>().value());
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parseSnowfall(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseSnowfall(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<double>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["snowfall"].get(element);
@@ -291,14 +341,14 @@ bool SimdJsonOpenMeteo::parseSnowfall(const simdjson::dom::element& hourly, std:
     return false;
   }
   const simdjson::dom::array snowfall = element.get_array().value();
-  if (snowfall.size() != data.size())
+  if (snowfall.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.snowfall does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << snowfall.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: snowfall)
   {
     if (!elem.is<double>())
@@ -306,14 +356,13 @@ bool SimdJsonOpenMeteo::parseSnowfall(const simdjson::dom::element& hourly, std:
       std::cerr << "Error: Snowfall element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setSnow(elem.get<double>().value() / 0.7);
-    ++idx;
+    column.push_back(elem.get<double>().value());
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parsePressure(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parsePressure(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<double>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["pressure_msl"].get(element);
@@ -325,14 +374,14 @@ bool SimdJsonOpenMeteo::parsePressure(const simdjson::dom::element& hourly, std:
     return false;
   }
   const simdjson::dom::array pressure_msl = element.get_array().value();
-  if (pressure_msl.size() != data.size())
+  if (pressure_msl.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.pressure_msl does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << pressure_msl.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: pressure_msl)
   {
     if (!elem.is<double>())
@@ -340,14 +389,13 @@ bool SimdJsonOpenMeteo::parsePressure(const simdjson::dom::element& hourly, std:
       std::cerr << "Error: Pressure element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setPressure(elem.get<double>().value());
-    ++idx;
+    column.push_back(elem.get<double>().value());
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parseCloudCover(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseCloudCover(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<int64_t>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["cloudcover"].get(element);
@@ -359,14 +407,14 @@ bool SimdJsonOpenMeteo::parseCloudCover(const simdjson::dom::element& hourly, st
     return false;
   }
   const simdjson::dom::array clouds = element.get_array().value();
-  if (clouds.size() != data.size())
+  if (clouds.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.cloudcover does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << clouds.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: clouds)
   {
     if (!elem.is<int64_t>())
@@ -374,14 +422,13 @@ bool SimdJsonOpenMeteo::parseCloudCover(const simdjson::dom::element& hourly, st
       std::cerr << "Error: Cloud cover element is not an integer value!" << std::endl;
       return false;
     }
-    data[idx].setCloudiness(elem.get<int64_t>().value());
-    ++idx;
+    column.push_back(elem.get<int64_t>().value());
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parseWindSpeed(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseWindSpeed(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<double>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["windspeed_10m"].get(element);
@@ -393,14 +440,14 @@ bool SimdJsonOpenMeteo::parseWindSpeed(const simdjson::dom::element& hourly, std
     return false;
   }
   const simdjson::dom::array windspeed_10m = element.get_array().value();
-  if (windspeed_10m.size() != data.size())
+  if (windspeed_10m.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.windspeed_10m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << windspeed_10m.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: windspeed_10m)
   {
     if (!elem.is<double>())
@@ -408,14 +455,13 @@ bool SimdJsonOpenMeteo::parseWindSpeed(const simdjson::dom::element& hourly, std
       std::cerr << "Error: Wind speed element is not a floating point value!" << std::endl;
       return false;
     }
-    data[idx].setWindSpeed(elem.get<double>().value());
-    ++idx;
+    column.push_back(elem.get<double>().value());
   }
 
   return true;
 }
 
-bool SimdJsonOpenMeteo::parseWindDirection(const simdjson::dom::element& hourly, std::vector<Weather>& data)
+bool SimdJsonOpenMeteo::parseWindDirection(const simdjson::dom::element& hourly, const std::size_t expected, std::vector<int64_t>& column)
 {
   simdjson::dom::element element;
   const auto error = hourly["winddirection_10m"].get(element);
@@ -427,14 +473,14 @@ bool SimdJsonOpenMeteo::parseWindDirection(const simdjson::dom::element& hourly,
     return false;
   }
   const simdjson::dom::array winddirection_10m = element.get_array().value();
-  if (winddirection_10m.size() != data.size())
+  if (winddirection_10m.size() != expected)
   {
     std::cerr << "Error: Number of elements in hourly.winddirection_10m does not "
-              << "match the expected value of " << data.size() << ". It is "
+              << "match the expected value of " << expected << ". It is "
               << winddirection_10m.size() << " instead." << std::endl;
     return false;
   }
-  std::size_t idx = 0;
+  column.reserve(expected);
   for (const auto& elem: winddirection_10m)
   {
     if (!elem.is<int64_t>())
@@ -442,8 +488,7 @@ bool SimdJsonOpenMeteo::parseWindDirection(const simdjson::dom::element& hourly,
       std::cerr << "Error: Wind direction element is not an integer value!" << std::endl;
       return false;
     }
-    data[idx].setWindDegrees(elem.get<int64_t>().value());
-    ++idx;
+    column.push_back(elem.get<int64_t>().value());
   }
 
   return true;
@@ -451,9 +496,9 @@ bool SimdJsonOpenMeteo::parseWindDirection(const simdjson::dom::element& hourly,
 
 bool SimdJsonOpenMeteo::parseForecast(const std::string& json, Forecast& forecast)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
-  auto error = parser.parse(json).get(doc);
+  const auto error = parser.parse(json).get(doc);
   if (error)
   {
     std::cerr << "Error in SimdJsonOpenMeteo::parseForecast(): Unable to parse JSON data!"
@@ -463,8 +508,96 @@ bool SimdJsonOpenMeteo::parseForecast(const std::string& json, Forecast& forecas
   }
 
   forecast.setJson(json);
+  return parseForecastElement(doc, forecast);
+}
+
+bool SimdJsonOpenMeteo::parseForecastBatch(const std::string& json, std::vector<Forecast>& forecasts)
+{
+  simdjson::dom::parser& parser = SimdJsonParser::get();
+  simdjson::dom::element doc;
+  const auto error = parser.parse(json).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOpenMeteo::parseForecastBatch(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
+
+  forecasts.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  if (!doc.is_array())
+  {
+    Forecast f;
+    f.setJson(json);
+    if (!parseForecastElement(doc, f))
+      return false;
+    forecasts.push_back(f);
+    return true;
+  }
+  const simdjson::dom::array locations = doc.get_array().value();
+  for (const simdjson::dom::element elem : locations)
+  {
+    Forecast f;
+    f.setJson(simdjson::minify(elem));
+    if (!parseForecastElement(elem, f))
+      return false;
+    forecasts.push_back(f);
+  }
+  return true;
+}
+
+bool SimdJsonOpenMeteo::parseCurrentAndForecastBatch(const std::string& json, std::vector<Weather>& weather, std::vector<Forecast>& forecasts)
+{
+  simdjson::dom::parser& parser = SimdJsonParser::get();
+  simdjson::dom::element doc;
+  const auto error = parser.parse(json).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOpenMeteo::parseCurrentAndForecastBatch(): Unable to parse JSON data!"
+              << std::endl << "Parser error: " << simdjson::error_message(error)
+              << std::endl;
+    return false;
+  }
 
-  const auto optional_error = hourlyUnitCheck(doc);
+  weather.clear();
+  forecasts.clear();
+  // Requests for more than one location return an array with one element per
+  // location, requests for a single location return just that element.
+  if (!doc.is_array())
+  {
+    Weather w;
+    Forecast f;
+    if (!parseCurrentWeatherElement(doc, w) || !parseForecastElement(doc, f))
+      return false;
+    const auto shared = std::make_shared<const std::string>(json);
+    w.setJson(shared);
+    f.setJson(shared);
+    weather.push_back(w);
+    forecasts.push_back(f);
+    return true;
+  }
+  const simdjson::dom::array locations = doc.get_array().value();
+  for (const simdjson::dom::element elem : locations)
+  {
+    Weather w;
+    Forecast f;
+    if (!parseCurrentWeatherElement(elem, w) || !parseForecastElement(elem, f))
+      return false;
+    const auto shared = std::make_shared<const std::string>(simdjson::minify(elem));
+    w.setJson(shared);
+    f.setJson(shared);
+    weather.push_back(w);
+    forecasts.push_back(f);
+  }
+  return true;
+}
+
+bool SimdJsonOpenMeteo::parseForecastElement(const simdjson::dom::element& doc, Forecast& forecast)
+{
+  bool unixTime = false;
+  const auto optional_error = hourlyUnitCheck(doc, unixTime);
   if (optional_error.has_value())
   {
     std::cerr << "Error in SimdJsonOpenMeteo::parseForecast(): Unexpected unit values found!"
@@ -472,8 +605,24 @@ bool SimdJsonOpenMeteo::parseForecast(const std::string& json, Forecast& forecas
     return false;
   }
 
+  // Unix timestamps need the offset of the location's time zone to get the
+  // same time points as ISO 8601 times, see unixTimeToTime().
+  int64_t utcOffset = 0;
+  if (unixTime)
+  {
+    simdjson::dom::element offset;
+    if (doc["utc_offset_seconds"].get(offset) || !offset.is<int64_t>())
+    {
+      std::cerr << "Error in SimdJsonOpenMeteo::parseForecast(): JSON element"
+                << " 'utc_offset_seconds' is either missing or not an integer!"
+                << std::endl;
+      return false;
+    }
+    utcOffset = offset.get<int64_t>().value();
+  }
+
   simdjson::dom::element hourly;
-  error = doc["hourly"].get(hourly);
+  auto error = doc["hourly"].get(hourly);
   if (error || !hourly.is_object())
   {
     std::cerr << "Error in SimdJsonOpenMeteo::parseForecast(): JSON element"
@@ -499,39 +648,60 @@ bool SimdJsonOpenMeteo::parseForecast(const std::string& json, Forecast& forecas
     return false;
   }
   std::vector<Weather> data;
+  HourlyTimeDecoder decoder;
   for (const auto& elem: time)
   {
-    if (!elem.is_string())
+    Weather weather;
+    if (unixTime)
     {
-      std::cerr << "Error: Time element is not a string!" << std::endl;
-      return false;
+      if (!elem.is<int64_t>())
+      {
+        std::cerr << "Error: Time element is not an integer!" << std::endl;
+        return false;
+      }
+      const auto dt = decoder.decode(elem.get<int64_t>().value(), utcOffset);
+      if (!dt.has_value())
+      {
+        return false;
+      }
+      weather.setDataTime(dt.value());
     }
-    const auto dt = isoStringToTime(std::string(elem.get_string().value()));
-    if (!dt.has_value())
+    else
     {
-      return false;
+      if (!elem.is_string())
+      {
+        std::cerr << "Error: Time element is not a string!" << std::endl;
+        return false;
+      }
+      const auto dt = decoder.decode(elem.get_string().value());
+      if (!dt.has_value())
+      {
+        return false;
+      }
+      weather.setDataTime(dt.value());
     }
-    Weather weather;
-    weather.setDataTime(dt.value());
     data.emplace_back(weather);
   }
 
-  if (!parseTemperature(hourly, data))
+  // Read all hourly arrays into columns first, then convert them as a whole.
+  OpenMeteoHourlyColumns columns;
+  if (!parseTemperature(hourly, data.size(), columns.temperature))
     return false;
-  if (!parseHumidity(hourly, data))
+  if (!parseHumidity(hourly, data.size(), columns.humidity))
     return false;
-  if (!parseRain(hourly, data))
+  if (!parseRain(hourly, data.size(), columns.rain))
     return false;
-  if (!parseSnowfall(hourly, data))
+  if (!parseSnowfall(hourly, data.size(), columns.snowfall))
     return false;
-  if (!parsePressure(hourly, data))
+  if (!parsePressure(hourly, data.size(), columns.pressure))
     return false;
-  if (!parseCloudCover(hourly, data))
+  if (!parseCloudCover(hourly, data.size(), columns.cloudCover))
     return false;
-  if (!parseWindSpeed(hourly, data))
+  if (!parseWindSpeed(hourly, data.size(), columns.windSpeed))
     return false;
-  if (!parseWindDirection(hourly, data))
+  if (!parseWindDirection(hourly, data.size(), columns.windDirection))
     return false;
+  setHourlyData(columns, data);
 
   forecast.setData(data);
   return true;
@@ -540,7 +710,7 @@ bool SimdJsonOpenMeteo::parseForecast(const std::string& json, Forecast& forecas
 #ifdef wic_openmeteo_find_location
 bool SimdJsonOpenMeteo::parseLocations(const std::string& json, std::vector<Location>& locations)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   auto error = parser.parse(json).get(doc);
   if (error)
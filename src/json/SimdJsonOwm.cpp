@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 #include "SimdJsonOwm.hpp"
 #include <iostream>
+#include "SimdJsonParser.hpp"
 #include "../util/NumericPrecision.hpp"
 
 namespace wic
@@ -129,7 +130,7 @@ bool SimdJsonOwm::parseSingleWeatherItem(const value_type& value, Weather& weath
 
 bool SimdJsonOwm::parseCurrentWeather(const std::string& json, Weather& weather)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto error = parser.parse(json).get(doc);
   if (error)
@@ -146,7 +147,7 @@ bool SimdJsonOwm::parseCurrentWeather(const std::string& json, Weather& weather)
 
 bool SimdJsonOwm::parseForecast(const std::string& json, Forecast& forecast)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto error = parser.parse(json).get(doc);
   if (error)
@@ -199,10 +200,66 @@ bool SimdJsonOwm::parseForecast(const std::string& json, Forecast& forecast)
   return true;
 }
 
+bool SimdJsonOwm::parseCurrentWeatherGroup(const std::string& json, std::vector<std::pair<uint32_t, Weather> >& weather)
+{
+  simdjson::dom::parser& parser = SimdJsonParser::get();
+  simdjson::dom::element doc;
+  const auto error = parser.parse(json).get(doc);
+  if (error)
+  {
+    std::cerr << "Error in SimdJsonOwm::parseCurrentWeatherGroup(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(error) << std::endl;
+    return false;
+  }
+
+  simdjson::dom::element list;
+  const auto e2 = doc["list"].get(list);
+  if (e2 || list.type() != simdjson::dom::element_type::ARRAY)
+  {
+    std::cerr << "Error in SimdJsonOwm::parseCurrentWeatherGroup(): list is either missing or not an array!" << std::endl;
+    return false;
+  }
+  weather.clear();
+  for (const value_type val : list)
+  {
+    simdjson::dom::element id;
+    const auto errorId = val["id"].get(id);
+    if (errorId || !id.is<uint64_t>())
+    {
+      std::cerr << "Error in SimdJsonOwm::parseCurrentWeatherGroup(): id is either missing or not an integer!" << std::endl;
+      return false;
+    }
+    Weather w;
+    if (!parseSingleWeatherItem(val, w))
+    {
+      std::cerr << "Error in SimdJsonOwm::parseCurrentWeatherGroup(): Parsing single item failed!" << std::endl;
+      return false;
+    }
+    // Each item has the same structure as the response for a single location.
+    w.setJson(simdjson::minify(val));
+    weather.emplace_back(static_cast<uint32_t>(id.get<uint64_t>().value()), w);
+  } // for (range-based)
+  simdjson::dom::element cnt;
+  const auto e3 = doc["cnt"].get(cnt);
+  if (e3 || !cnt.is<uint64_t>())
+  {
+    std::cerr << "Error in SimdJsonOwm::parseCurrentWeatherGroup(): cnt is either missing or not an integer!" << std::endl;
+    return false;
+  }
+  const decltype(weather.size()) cntValue = cnt.get<uint64_t>();
+  if (weather.size() != cntValue)
+  {
+    std::cerr << "Error in SimdJsonOwm::parseCurrentWeatherGroup(): Expected " << cntValue
+              << " items, but " << weather.size() << " items were found!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 #ifdef wic_owm_find_location
 bool SimdJsonOwm::parseLocations(const std::string& json, std::vector<std::pair<Location, Weather> >& locations)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto error = parser.parse(json).get(doc);
   if (error)
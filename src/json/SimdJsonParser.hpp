@@ -0,0 +1,164 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_SIMDJSONPARSER_HPP
+#define WEATHER_INFORMATION_COLLECTOR_SIMDJSONPARSER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "../../third-party/simdjson/simdjson.h"
+#include "../net/Curly.hpp"
+
+namespace wic
+{
+
+// Responses of the collector are only used in place by iterate(), if Curly
+// keeps at least the padding that simdjson needs after them.
+static_assert(responsePadding >= simdjson::SIMDJSON_PADDING,
+              "responsePadding must not be less than the padding of simdjson.");
+
+/** \brief Provides simdjson parsers per thread that are reused for all
+ *         documents parsed on that thread.
+ *
+ * A new simdjson::dom::parser has to allocate its buffers for every document,
+ * which takes longer than parsing small documents like current weather data.
+ * A reused parser only allocates when a document is larger than all documents
+ * before it. The same holds for simdjson::ondemand::parser, which is used by
+ * the SimdJsonOnDemand* classes.
+ */
+class SimdJsonParser
+{
+  public:
+    /** \brief maximum capacity in bytes that a parser keeps for the next
+     *         document, parsers with larger buffers are replaced
+     */
+    static constexpr std::size_t retainedCapacity = 1024 * 1024;
+
+
+    /** \brief Gets the parser of the current thread.
+     *
+     * \return Returns the parser of the current thread.
+     * \remarks Parsing another document with the returned parser invalidates
+     *          all elements of the previous document parsed on that thread, so
+     *          elements must not be kept after the parse function returns.
+     */
+    static simdjson::dom::parser& get()
+    {
+      simdjson::dom::parser& parser = instance();
+      // Do not keep the buffers of an unusually large document forever.
+      if (parser.capacity() > retainedCapacity)
+      {
+        parser = simdjson::dom::parser();
+      }
+      return parser;
+    }
+
+
+    /** \brief Gets the On-Demand parser of the current thread.
+     *
+     * \return Returns the On-Demand parser of the current thread.
+     * \remarks Iterating over another document with the returned parser
+     *          invalidates the previous document of that thread.
+     */
+    static simdjson::ondemand::parser& onDemand()
+    {
+      simdjson::ondemand::parser& parser = onDemandInstance();
+      // Do not keep the buffers of an unusually large document forever.
+      if (parser.capacity() > retainedCapacity)
+      {
+        parser = simdjson::ondemand::parser();
+      }
+      return parser;
+    }
+
+
+    /** \brief Starts the iteration over a JSON document with the On-Demand
+     *         parser of the current thread.
+     *
+     * \param json  the JSON document
+     * \param copy  storage for a padded copy of the document, which is only
+     *              used when the capacity of json does not provide the padding
+     *              that simdjson needs after the data
+     * \return Returns the document or the error that occurred.
+     * \remarks json (or copy) must outlive the returned document.
+     */
+    static simdjson::simdjson_result<simdjson::ondemand::document> iterate(const std::string& json, simdjson::padded_string& copy)
+    {
+      // Responses of the collector already have the padding, so they can be
+      // used in place.
+      if (json.capacity() - json.size() >= simdjson::SIMDJSON_PADDING)
+      {
+        return onDemand().iterate(simdjson::padded_string_view(json));
+      }
+      copy = simdjson::padded_string(json);
+      return onDemand().iterate(copy);
+    }
+
+
+    /** \brief Removes the whitespace from a part of a JSON document.
+     *
+     * \param json  the JSON text, e.g. the raw JSON of an On-Demand value
+     * \return Returns the JSON text without whitespace outside of strings.
+     */
+    static std::string minify(const std::string_view json)
+    {
+      std::string result(json.size(), '\0');
+      std::size_t length = 0;
+      if (simdjson::minify(json.data(), json.size(), result.data(), length) != simdjson::SUCCESS)
+        return std::string(json);
+      result.resize(length);
+      return result;
+    }
+
+
+    /** \brief Frees the buffers of the parsers of the current thread.
+     */
+    static void release()
+    {
+      instance() = simdjson::dom::parser();
+      onDemandInstance() = simdjson::ondemand::parser();
+    }
+  private:
+    /** \brief Gets the parser instance of the current thread.
+     *
+     * \return Returns the parser instance of the current thread.
+     */
+    static simdjson::dom::parser& instance()
+    {
+      thread_local simdjson::dom::parser parser;
+      return parser;
+    }
+
+
+    /** \brief Gets the On-Demand parser instance of the current thread.
+     *
+     * \return Returns the On-Demand parser instance of the current thread.
+     */
+    static simdjson::ondemand::parser& onDemandInstance()
+    {
+      thread_local simdjson::ondemand::parser parser;
+      return parser;
+    }
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_SIMDJSONPARSER_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2020, 2021  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 #include "SimdJsonWeatherbit.hpp"
 #include <iostream>
+#include "SimdJsonParser.hpp"
 #include "../util/NumericPrecision.hpp"
 
 namespace wic
@@ -95,7 +96,7 @@ bool SimdJsonWeatherbit::parseSingleWeatherItem(const value_type& value, Weather
 
 bool SimdJsonWeatherbit::parseCurrentWeather(const std::string& json, Weather& weather)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto parseError = parser.parse(json).get(doc);
   if (parseError)
@@ -133,9 +134,58 @@ bool SimdJsonWeatherbit::parseCurrentWeather(const std::string& json, Weather& w
   return parseSingleWeatherItem(data.at(0), weather);
 }
 
+bool SimdJsonWeatherbit::parseCurrentWeatherBatch(const std::string& json, std::vector<Weather>& weather)
+{
+  simdjson::dom::parser& parser = SimdJsonParser::get();
+  simdjson::dom::element doc;
+  const auto parseError = parser.parse(json).get(doc);
+  if (parseError)
+  {
+    std::cerr << "Error in SimdJsonWeatherbit::parseCurrentWeatherBatch(): Unable to parse JSON data!" << std::endl
+              << "Parser error: " << simdjson::error_message(parseError) << std::endl;
+    return false;
+  }
+
+  simdjson::dom::element data;
+  const auto errorData = doc["data"].get(data);
+  if (errorData || data.type() != simdjson::dom::element_type::ARRAY)
+  {
+    std::cerr << "Error in SimdJsonWeatherbit::parseCurrentWeatherBatch(): JSON "
+              << "does not contain a data element or data element is not an "
+              << "array!" << std::endl;
+    return false;
+  }
+  simdjson::dom::element count;
+  const auto errorCount = doc["count"].get(count);
+  if (errorCount || !count.is<uint64_t>())
+  {
+    std::cerr << "Error in SimdJsonWeatherbit::parseCurrentWeatherBatch(): JSON does not contain a count element or the element is not a valid number!" << std::endl;
+    return false;
+  }
+
+  weather.clear();
+  for (const value_type item : data)
+  {
+    Weather w;
+    if (!parseSingleWeatherItem(item, w))
+      return false;
+    // Keep the JSON in the same form as the response for a single location.
+    w.setJson("{\"data\":[" + simdjson::minify(item) + "],\"count\":1}");
+    weather.push_back(w);
+  }
+  if (weather.size() != count.get<uint64_t>().value())
+  {
+    std::cerr << "Error in SimdJsonWeatherbit::parseCurrentWeatherBatch(): Expected "
+              << count.get<uint64_t>().value() << " items, but " << weather.size()
+              << " items were found!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 bool SimdJsonWeatherbit::parseForecast(const std::string& json, Forecast& forecast)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto parseError = parser.parse(json).get(doc);
   if (parseError)
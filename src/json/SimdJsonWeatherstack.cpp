@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2019, 2020, 2021  Dirk Stolle
+    Copyright (C) 2019, 2020, 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -24,6 +24,7 @@
 #include <iostream>
 #include <sstream>
 #include "../../third-party/simdjson/simdjson.h"
+#include "SimdJsonParser.hpp"
 #include "WeatherstackFunctions.hpp"
 #include "../util/NumericPrecision.hpp"
 
@@ -76,7 +77,7 @@ std::chrono::time_point<std::chrono::system_clock> parseDateTime(const simdjson:
 
 bool SimdJsonWeatherstack::parseCurrentWeather(const std::string& json, Weather& weather)
 {
-  simdjson::dom::parser parser;
+  simdjson::dom::parser& parser = SimdJsonParser::get();
   simdjson::dom::element doc;
   const auto parseError = parser.parse(json).get(doc);
   if (parseError)
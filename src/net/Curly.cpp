@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of scan-tool.
-    Copyright (C) 2015, 2016, 2017, 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2015, 2016, 2017, 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,10 +20,12 @@
 
 #include "Curly.hpp"
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <curl/curl.h>
 
@@ -41,6 +43,42 @@ size_t writeCallbackString(char *ptr, size_t size, size_t nmemb, void *userdata)
   return actualSize;
 }
 
+size_t writeCallbackPadded(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+  const size_t actualSize = size * nmemb;
+  if (userdata == nullptr)
+  {
+    std::cerr << "Error: write callback received null pointer!" << std::endl;
+    return 0;
+  }
+
+  ResponseBuffer * buffer = reinterpret_cast<ResponseBuffer*>(userdata);
+  std::string& data = *buffer->data;
+  if (data.empty() && (buffer->handle != nullptr))
+  {
+    // Allocate the whole response at once, if the server tells its size. Very
+    // large values are ignored, because the header could be wrong.
+    #if CURL_AT_LEAST_VERSION(7, 55, 0)
+    curl_off_t length = -1;
+    const CURLcode code = curl_easy_getinfo(buffer->handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+    #else
+    double length = -1.0;
+    const CURLcode code = curl_easy_getinfo(buffer->handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &length);
+    #endif
+    if ((code == CURLE_OK) && (length > 0) && (length <= 64 * 1024 * 1024))
+      data.reserve(static_cast<std::size_t>(length) + responsePadding);
+  }
+  const std::size_t needed = data.size() + actualSize + responsePadding;
+  if (needed > data.capacity())
+  {
+    // Compressed responses are larger than their Content-Length, so grow
+    // geometrically to avoid many reallocations.
+    data.reserve(std::max(needed, 2 * data.capacity()));
+  }
+  data.append(ptr, actualSize);
+  return actualSize;
+}
+
 #ifdef CURLY_READ_CALLBACK_STRING
 struct StringData
 {
@@ -85,6 +123,255 @@ size_t readCallbackString(char *buffer, size_t size, size_t nitems, void *instre
 }
 #endif // CURLY_READ_CALLBACK_STRING
 
+namespace
+{
+
+/** \brief Holds the cURL share for DNS cache and TLS sessions of all reused
+ *         handles.
+ */
+class SharedData
+{
+  public:
+    /** \brief Constructor. Creates the share. */
+    SharedData()
+    : share(curl_share_init()),
+      mutexes()
+    {
+      if (share == nullptr)
+        return;
+      if ((curl_share_setopt(share, CURLSHOPT_LOCKFUNC, SharedData::lock) != CURLSHE_OK)
+          || (curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, SharedData::unlock) != CURLSHE_OK)
+          || (curl_share_setopt(share, CURLSHOPT_USERDATA, this) != CURLSHE_OK)
+          || (curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS) != CURLSHE_OK)
+          || (curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) != CURLSHE_OK))
+      {
+        std::cerr << "cURL error: Could not set up shared DNS cache and TLS sessions!" << std::endl;
+        curl_share_cleanup(share);
+        share = nullptr;
+      }
+    }
+
+    SharedData(const SharedData& other) = delete;
+    SharedData& operator=(const SharedData& other) = delete;
+
+    /** \brief Destructor. */
+    ~SharedData()
+    {
+      if (share != nullptr)
+        curl_share_cleanup(share);
+    }
+
+    /** \brief Gets the share.
+     *
+     * \return Returns the share. Returns null, if it could not be created.
+     */
+    CURLSH* get() const
+    {
+      return share;
+    }
+  private:
+    static void lock(CURL* /* handle */, curl_lock_data data, curl_lock_access /* access */, void* userptr)
+    {
+      reinterpret_cast<SharedData*>(userptr)->mutexes[data].lock();
+    }
+
+    static void unlock(CURL* /* handle */, curl_lock_data data, void* userptr)
+    {
+      reinterpret_cast<SharedData*>(userptr)->mutexes[data].unlock();
+    }
+
+    CURLSH* share; /**< the cURL share */
+    std::mutex mutexes[CURL_LOCK_DATA_LAST]; /**< one mutex per kind of shared data */
+}; // class
+
+/** \brief Gets a point in time of the latest transfer of a handle.
+ *
+ * \param handle  the cURL easy handle
+ * \param info    the requested point in time, e. g. CURLINFO_CONNECT_TIME_T
+ * \return Returns the time since the start of the transfer.
+ *         Returns zero, if the information is not available.
+ */
+std::chrono::microseconds elapsedTime(CURL* handle, const CURLINFO info)
+{
+  #if CURL_AT_LEAST_VERSION(7, 61, 0)
+  curl_off_t micros = 0;
+  if (curl_easy_getinfo(handle, info, &micros) != CURLE_OK)
+    return std::chrono::microseconds::zero();
+  return std::chrono::microseconds(micros);
+  #else
+  double seconds = 0.0;
+  if (curl_easy_getinfo(handle, info, &seconds) != CURLE_OK)
+    return std::chrono::microseconds::zero();
+  return std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(seconds * 1000000.0));
+  #endif
+}
+
+/** \brief Gets the duration between two points in time of a transfer.
+ *
+ * \param from  the earlier point in time
+ * \param to    the later point in time
+ * \return Returns the duration. Returns zero, if @arg to is not after @arg from.
+ */
+std::chrono::microseconds between(const std::chrono::microseconds& from, const std::chrono::microseconds& to)
+{
+  return to > from ? to - from : std::chrono::microseconds::zero();
+}
+
+std::mutex defaultTimeoutsMutex;
+Timeouts defaultLimits{ std::chrono::seconds(10), std::chrono::seconds(60), std::chrono::seconds(30) };
+std::atomic<bool> defaultUseHttp2{ true };
+
+/** \brief Gets the HTTP version that requests shall use.
+ *
+ * \param http2  whether HTTP/2 is preferred
+ * \return Returns CURL_HTTP_VERSION_2TLS, if HTTP/2 is preferred and the cURL
+ *         library supports it. Returns CURL_HTTP_VERSION_1_1 otherwise.
+ */
+long httpVersionOption(const bool http2)
+{
+  #if CURL_AT_LEAST_VERSION(7, 47, 0)
+  const curl_version_info_data* info = curl_version_info(CURLVERSION_NOW);
+  if (http2 && ((info->features & CURL_VERSION_HTTP2) != 0))
+    return CURL_HTTP_VERSION_2TLS;
+  #else
+  // HTTP/2 is not available in older cURL versions.
+  (void) http2;
+  #endif
+  return CURL_HTTP_VERSION_1_1;
+}
+
+/** \brief Owns the reused cURL handle of a thread. */
+struct ThreadHandle
+{
+  /** \brief Constructor. */
+  ThreadHandle()
+  : handle(nullptr)
+  {
+  }
+
+  ThreadHandle(const ThreadHandle& other) = delete;
+  ThreadHandle& operator=(const ThreadHandle& other) = delete;
+
+  /** \brief Destructor. Closes all connections of the handle. */
+  ~ThreadHandle()
+  {
+    if (handle != nullptr)
+      curl_easy_cleanup(handle);
+  }
+
+  CURL* handle; /**< the handle, null if not created yet */
+}; // struct
+
+thread_local ThreadHandle threadHandle;
+
+/** \brief Gets the DNS cache and TLS sessions that all reused handles share.
+ *
+ * \return Returns the shared data.
+ */
+SharedData& sharedData()
+{
+  static SharedData shared;
+  return shared;
+}
+
+/** \brief Gets a cURL handle for a request.
+ *
+ * \param reuse  whether to use the reused handle of the current thread
+ * \return Returns the handle. Returns null, if the handle cannot be created.
+ */
+CURL* acquireHandle(const bool reuse)
+{
+  if (!reuse)
+    return curl_easy_init();
+
+  if (threadHandle.handle != nullptr)
+  {
+    // Resetting the handle keeps open connections, DNS and TLS data alive,
+    // but clears all options of the previous request.
+    curl_easy_reset(threadHandle.handle);
+  }
+  else
+  {
+    threadHandle.handle = curl_easy_init();
+    if (threadHandle.handle == nullptr)
+      return nullptr;
+  }
+  useSharedData(threadHandle.handle);
+  return threadHandle.handle;
+}
+
+/** \brief Releases a handle that was returned by acquireHandle().
+ *
+ * \param handle  the handle
+ */
+void releaseHandle(CURL* handle)
+{
+  // The handle of the thread stays alive for the next request.
+  if (handle != threadHandle.handle)
+    curl_easy_cleanup(handle);
+}
+
+} // namespace
+
+void useSharedData(void* handle)
+{
+  if (sharedData().get() == nullptr)
+    return;
+  const CURLcode retCode = curl_easy_setopt(handle, CURLOPT_SHARE, sharedData().get());
+  if (retCode != CURLE_OK)
+  {
+    std::cerr << "cURL error: setting share failed!" << std::endl;
+    std::cerr << curl_easy_strerror(retCode) << std::endl;
+  }
+}
+
+bool setTimeoutOptions(void* handle, const Timeouts& timeouts)
+{
+  if (handle == nullptr)
+    return false;
+  // Signals are not thread-safe, so cURL must not use them to abort DNS
+  // lookups that take too long.
+  // The low speed limit of one byte per second only aborts transfers that have
+  // (nearly) stopped, slow but steady transfers are not affected.
+  return (curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L) == CURLE_OK)
+      && (curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(timeouts.connect.count())) == CURLE_OK)
+      && (curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, static_cast<long>(timeouts.total.count())) == CURLE_OK)
+      && (curl_easy_setopt(handle, CURLOPT_LOW_SPEED_LIMIT, timeouts.stall.count() > 0 ? 1L : 0L) == CURLE_OK)
+      && (curl_easy_setopt(handle, CURLOPT_LOW_SPEED_TIME, static_cast<long>(timeouts.stall.count())) == CURLE_OK);
+}
+
+RequestTiming timingOfTransfer(void* handle)
+{
+  RequestTiming timing = RequestTiming();
+  if (handle == nullptr)
+    return timing;
+  #if CURL_AT_LEAST_VERSION(7, 61, 0)
+  const auto nameLookup = elapsedTime(handle, CURLINFO_NAMELOOKUP_TIME_T);
+  const auto connect = elapsedTime(handle, CURLINFO_CONNECT_TIME_T);
+  const auto appConnect = elapsedTime(handle, CURLINFO_APPCONNECT_TIME_T);
+  const auto preTransfer = elapsedTime(handle, CURLINFO_PRETRANSFER_TIME_T);
+  const auto startTransfer = elapsedTime(handle, CURLINFO_STARTTRANSFER_TIME_T);
+  const auto total = elapsedTime(handle, CURLINFO_TOTAL_TIME_T);
+  #else
+  const auto nameLookup = elapsedTime(handle, CURLINFO_NAMELOOKUP_TIME);
+  const auto connect = elapsedTime(handle, CURLINFO_CONNECT_TIME);
+  const auto appConnect = elapsedTime(handle, CURLINFO_APPCONNECT_TIME);
+  const auto preTransfer = elapsedTime(handle, CURLINFO_PRETRANSFER_TIME);
+  const auto startTransfer = elapsedTime(handle, CURLINFO_STARTTRANSFER_TIME);
+  const auto total = elapsedTime(handle, CURLINFO_TOTAL_TIME);
+  #endif
+  // All values are points in time since the start of the transfer, so the
+  // durations of the phases are the differences between them.
+  timing.nameLookup = nameLookup;
+  timing.connect = between(nameLookup, connect);
+  // The TLS handshake time is zero for plain HTTP.
+  if (appConnect > std::chrono::microseconds::zero())
+    timing.tls = between(connect, appConnect);
+  timing.firstByte = between(preTransfer, startTransfer);
+  timing.total = total;
+  return timing;
+}
+
 Curly::Curly()
 : m_URL(""),
   m_PostFields(std::unordered_map<std::string, std::string>()),
@@ -95,6 +382,13 @@ Curly::Curly()
   m_LastContentType(""),
   m_followRedirects(false),
   m_maxRedirects(-1),
+  m_reuseConnections(true),
+  m_acceptCompression(true),
+  m_http2(defaultHttp2()),
+  m_timeouts(defaultTimeouts()),
+  m_LastWireBytes(0),
+  m_LastDecodedBytes(0),
+  m_LastTiming(RequestTiming()),
   m_ResponseHeaders(std::vector<std::string>())
 {
 }
@@ -208,6 +502,68 @@ void Curly::setMaximumRedirects(const long int maxRedirect)
     m_maxRedirects = -1; //map all negative values to -1
 }
 
+bool Curly::reusesConnections() const
+{
+  return m_reuseConnections;
+}
+
+void Curly::reuseConnections(const bool reuse)
+{
+  m_reuseConnections = reuse;
+}
+
+bool Curly::acceptsCompression() const
+{
+  return m_acceptCompression;
+}
+
+void Curly::acceptCompression(const bool accept)
+{
+  m_acceptCompression = accept;
+}
+
+bool Curly::usesHttp2() const
+{
+  return m_http2;
+}
+
+void Curly::useHttp2(const bool use)
+{
+  m_http2 = use;
+}
+
+bool Curly::defaultHttp2()
+{
+  return defaultUseHttp2.load();
+}
+
+void Curly::setDefaultHttp2(const bool use)
+{
+  defaultUseHttp2.store(use);
+}
+
+const Timeouts& Curly::timeouts() const
+{
+  return m_timeouts;
+}
+
+void Curly::setTimeouts(const Timeouts& limits)
+{
+  m_timeouts = limits;
+}
+
+Timeouts Curly::defaultTimeouts()
+{
+  std::lock_guard<std::mutex> lock(defaultTimeoutsMutex);
+  return defaultLimits;
+}
+
+void Curly::setDefaultTimeouts(const Timeouts& limits)
+{
+  std::lock_guard<std::mutex> lock(defaultTimeoutsMutex);
+  defaultLimits = limits;
+}
+
 bool Curly::perform(std::string& response)
 {
   //"minimum" URL should be something like "http://a.bc"
@@ -218,7 +574,7 @@ bool Curly::perform(std::string& response)
   #ifdef DEBUG_MODE
   std::clog << "curl_easy_init()..." << std::endl;
   #endif
-  CURL * handle = curl_easy_init();
+  CURL * handle = acquireHandle(m_reuseConnections);
   if (nullptr == handle)
   {
     //cURL error
@@ -235,7 +591,7 @@ bool Curly::perform(std::string& response)
   {
     std::cerr << "cURL error: setting URL failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
 
@@ -248,7 +604,7 @@ bool Curly::perform(std::string& response)
   {
     std::cerr << "cURL error: setting header function failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
   //set header data
@@ -257,7 +613,7 @@ bool Curly::perform(std::string& response)
   {
     std::cerr << "cURL error: setting header data pointer failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
 
@@ -270,11 +626,44 @@ bool Curly::perform(std::string& response)
   {
     std::cerr << "cURL error: setting minimum TLS version failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
   #endif
 
+  // Prefer HTTP/2 for HTTPS, because reused connections can then be shared
+  // with other transfers. cURL falls back to HTTP/1.1, if the server does not
+  // support HTTP/2. Libraries without HTTP/2 reject that option, so they get
+  // HTTP/1.1 right away, as do all requests when HTTP/2 is switched off.
+  // Handles of the thread are reused, so the version has to be set each time.
+  retCode = curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, httpVersionOption(m_http2));
+  if (retCode != CURLE_OK)
+  {
+    std::cerr << "cURL error: setting HTTP version failed!" << std::endl;
+    std::cerr << curl_easy_strerror(retCode) << std::endl;
+    releaseHandle(handle);
+    return false;
+  }
+
+  // An empty string lets cURL offer all encodings it supports. cURL then
+  // decodes the response before it reaches the write callback.
+  retCode = curl_easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, m_acceptCompression ? "" : nullptr);
+  if (retCode != CURLE_OK)
+  {
+    std::cerr << "cURL error: setting accepted encodings failed!" << std::endl;
+    std::cerr << curl_easy_strerror(retCode) << std::endl;
+    releaseHandle(handle);
+    return false;
+  }
+
+  // Without timeouts a stalled connection could block the request forever.
+  if (!setTimeoutOptions(handle, m_timeouts))
+  {
+    std::cerr << "cURL error: setting timeouts failed!" << std::endl;
+    releaseHandle(handle);
+    return false;
+  }
+
   //set redirection parameters
   if (followsRedirects())
   {
@@ -284,7 +673,7 @@ bool Curly::perform(std::string& response)
     {
       std::cerr << "cURL error: setting redirection mode failed!" << std::endl;
       std::cerr << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       return false;
     }
     //set limit - but only if we are not "limited" to infinite redirects
@@ -295,7 +684,7 @@ bool Curly::perform(std::string& response)
       {
         std::cerr << "cURL error: setting redirection limit failed!" << std::endl;
         std::cerr << curl_easy_strerror(retCode) << std::endl;
-        curl_easy_cleanup(handle);
+        releaseHandle(handle);
         return false;
       } //if cURL error
     } //if redirect limit is given
@@ -315,7 +704,7 @@ bool Curly::perform(std::string& response)
       {
         std::cerr << "cURL error: creation of header list failed!" << std::endl;
         std::cerr << curl_easy_strerror(retCode) << std::endl;
-        curl_easy_cleanup(handle);
+        releaseHandle(handle);
         return false;
       }
     } //for
@@ -330,7 +719,7 @@ bool Curly::perform(std::string& response)
       std::cerr << curl_easy_strerror(retCode) << std::endl;
       curl_slist_free_all(header_list);
       header_list = nullptr;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       return false;
     }
   } //if custom headers are given
@@ -349,7 +738,7 @@ bool Curly::perform(std::string& response)
     {
       //escaping failed!
       std::cerr << "cURL error: escaping of post values failed!" << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       curl_slist_free_all(header_list);
       header_list = nullptr;
       return false;
@@ -365,7 +754,7 @@ bool Curly::perform(std::string& response)
     {
       //escaping failed!
       std::cerr << "cURL error: escaping of post values failed!" << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       curl_slist_free_all(header_list);
       header_list = nullptr;
       return false;
@@ -384,7 +773,7 @@ bool Curly::perform(std::string& response)
     {
       std::cerr << "cURL error: setting POST fields for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       curl_slist_free_all(header_list);
       header_list = nullptr;
       return false;
@@ -399,7 +788,7 @@ bool Curly::perform(std::string& response)
     {
       std::cerr << "cURL error: setting POST mode for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       curl_slist_free_all(header_list);
       header_list = nullptr;
       return false;
@@ -409,7 +798,7 @@ bool Curly::perform(std::string& response)
     {
       std::cerr << "cURL error: setting size of POST body for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       curl_slist_free_all(header_list);
       header_list = nullptr;
       return false;
@@ -419,7 +808,7 @@ bool Curly::perform(std::string& response)
     {
       std::cerr << "cURL error: setting POST body for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseHandle(handle);
       curl_slist_free_all(header_list);
       header_list = nullptr;
       return false;
@@ -427,26 +816,27 @@ bool Curly::perform(std::string& response)
   } //if post body
 
   //set write callback
-  retCode = curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, writeCallbackString);
+  retCode = curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, writeCallbackPadded);
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_setopt() of Curly::perform could not set write function! Error: "
               << curl_easy_strerror(retCode) << std::endl;
     curl_slist_free_all(header_list);
     header_list = nullptr;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
-  //provide string stream for the data
-  std::string string_data("");
-  retCode = curl_easy_setopt(handle, CURLOPT_WRITEDATA, (void *)&string_data);
+  //write directly into the response, clear() keeps its allocated memory
+  response.clear();
+  ResponseBuffer buffer{ &response, handle };
+  retCode = curl_easy_setopt(handle, CURLOPT_WRITEDATA, (void *)&buffer);
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_setopt() of Curly::perform could not set write data! Error: "
               << curl_easy_strerror(retCode) << std::endl;
     curl_slist_free_all(header_list);
     header_list = nullptr;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
 
@@ -455,13 +845,14 @@ bool Curly::perform(std::string& response)
   std::clog << "calling cURL easy perform..." << std::endl;
   #endif
   retCode = curl_easy_perform(handle);
+  m_LastTiming = timingOfTransfer(handle);
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_perform() of Curly::perform failed! Error: "
               << curl_easy_strerror(retCode) << std::endl;
     curl_slist_free_all(header_list);
     header_list = nullptr;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     return false;
   }
   #ifdef DEBUG_MODE
@@ -481,7 +872,7 @@ bool Curly::perform(std::string& response)
   {
     std::cerr << "curl_easy_getinfo() of Curly::perform failed! Error: "
               << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     m_LastResponseCode = 0;
     return false;
   }
@@ -492,17 +883,27 @@ bool Curly::perform(std::string& response)
   {
     std::cerr << "curl_easy_getinfo() of Curly::perform failed! Error: "
               << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseHandle(handle);
     m_LastContentType.erase();
     return false;
   }
   if (contType == nullptr)
     m_LastContentType.erase();
   else
-    m_LastContentType = std::string(m_LastContentType);
+    m_LastContentType = std::string(contType);
+
+  //get transferred body size, which is the compressed size, if any
+  #if CURL_AT_LEAST_VERSION(7, 55, 0)
+  curl_off_t wireBytes = 0;
+  retCode = curl_easy_getinfo(handle, CURLINFO_SIZE_DOWNLOAD_T, &wireBytes);
+  #else
+  double wireBytes = 0.0;
+  retCode = curl_easy_getinfo(handle, CURLINFO_SIZE_DOWNLOAD, &wireBytes);
+  #endif
+  m_LastWireBytes = (retCode == CURLE_OK) ? static_cast<uint_least64_t>(wireBytes) : 0;
+  m_LastDecodedBytes = response.size();
 
-  curl_easy_cleanup(handle);
-  response = std::move(string_data);
+  releaseHandle(handle);
   return true;
 }
 
@@ -516,6 +917,21 @@ const std::string& Curly::getContentType() const
   return m_LastContentType;
 }
 
+uint_least64_t Curly::getWireBytes() const
+{
+  return m_LastWireBytes;
+}
+
+uint_least64_t Curly::getDecodedBytes() const
+{
+  return m_LastDecodedBytes;
+}
+
+const RequestTiming& Curly::getTiming() const
+{
+  return m_LastTiming;
+}
+
 Curly::VersionData::VersionData()
 : cURL(""),
   ssl(""),
@@ -570,6 +986,18 @@ Curly::VersionData Curly::curlVersion()
   return vd;
 }
 
+bool Curly::globalInit()
+{
+  const CURLcode retCode = curl_global_init(CURL_GLOBAL_DEFAULT);
+  if (retCode != CURLE_OK)
+  {
+    std::cerr << "cURL error: global initialization failed!" << std::endl;
+    std::cerr << curl_easy_strerror(retCode) << std::endl;
+    return false;
+  }
+  return true;
+}
+
 size_t Curly::headerCallback(char* buffer, size_t size, size_t nitems, void* userdata)
 {
   const size_t actualSize = size * nitems;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of scan-tool.
-    Copyright (C) 2015, 2016, 2017  Dirk Stolle
+    Copyright (C) 2015, 2016, 2017, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,9 @@
 #ifndef SCANTOOL_CURLY_HPP
 #define SCANTOOL_CURLY_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -30,8 +33,80 @@ extern "C"
   /** \brief write callback for cURL functions
    */
   size_t writeCallbackString(char *ptr, size_t size, size_t nmemb, void *userdata);
+
+  /** \brief write callback for cURL functions that keeps free space of at
+   *         least responsePadding bytes after the received data
+   *
+   * \remarks userdata has to point to a ResponseBuffer.
+   */
+  size_t writeCallbackPadded(char *ptr, size_t size, size_t nmemb, void *userdata);
 } //extern C
 
+/** \brief number of bytes that are always kept free after the end of a
+ *         response
+ *
+ * This is the padding that simdjson needs (SIMDJSON_PADDING). simdjson parses
+ * a std::string in place, if its capacity provides that padding, and it would
+ * copy the whole response into a padded buffer otherwise. A static assertion
+ * in SimdJsonParser.hpp makes sure that the value is large enough for
+ * simdjson.
+ */
+constexpr std::size_t responsePadding = 64;
+
+/** \brief destination of the data for writeCallbackPadded() */
+struct ResponseBuffer
+{
+  std::string* data; /**< string that receives the response */
+  void* handle; /**< the cURL easy handle of the transfer */
+}; // struct
+
+/** \brief limits for the duration of a request */
+struct Timeouts
+{
+  std::chrono::milliseconds connect; /**< maximum time to set up the connection, zero means the default of cURL (300 seconds) */
+  std::chrono::milliseconds total; /**< maximum time of the whole request, zero means no limit */
+  std::chrono::seconds stall; /**< the request is aborted, if it receives less than one byte per second during that time, zero means no limit */
+}; // struct
+
+/** \brief durations of the phases of a request
+ *
+ * The phases follow each other, so their sum is roughly the total time. Phases
+ * that did not happen, e. g. the TLS handshake of a plain HTTP request or the
+ * connection setup of a reused connection, have a duration of zero.
+ */
+struct RequestTiming
+{
+  std::chrono::microseconds nameLookup; /**< DNS lookup of the host */
+  std::chrono::microseconds connect; /**< TCP handshake */
+  std::chrono::microseconds tls; /**< TLS handshake */
+  std::chrono::microseconds firstByte; /**< time after the request was sent until the first byte of the response arrived */
+  std::chrono::microseconds total; /**< duration of the whole request */
+}; // struct
+
+/** \brief Applies timeouts to a cURL easy handle.
+ *
+ * \param handle    the cURL easy handle
+ * \param timeouts  the timeouts
+ * \return Returns true, if the timeouts were set.
+ */
+bool setTimeoutOptions(void* handle, const Timeouts& timeouts);
+
+/** \brief Lets a cURL easy handle use the DNS cache and the TLS sessions that
+ *         the reused handles of Curly share.
+ *
+ * \param handle  the cURL easy handle
+ * \remarks The share is an option of the handle, so it has to be set again
+ *          after the handle has been reset.
+ */
+void useSharedData(void* handle);
+
+/** \brief Gets the timing of the latest transfer of a cURL easy handle.
+ *
+ * \param handle  the cURL easy handle
+ * \return Returns the durations of the phases of the transfer.
+ */
+RequestTiming timingOfTransfer(void* handle);
+
 class Curly
 {
   public:
@@ -170,6 +245,119 @@ class Curly
     void setMaximumRedirects(const long int maxRedirect);
 
 
+    /** \brief checks whether Curly reuses connections of previous requests
+     *
+     * \return Returns true, if perform() uses the cURL handle of the current
+     *         thread, which keeps connections open for later requests.
+     *         Returns false, if each request uses a new handle.
+     * \remarks Default behaviour is to reuse connections.
+     */
+    bool reusesConnections() const;
+
+
+    /** \brief changes whether Curly::perform() reuses connections of previous
+     *         requests
+     *
+     * \param reuse  Set this to true (default), if Curly shall use the cURL
+     *               handle of the current thread. Such a handle keeps its
+     *               connections open after the request, and all of those
+     *               handles share the DNS cache and TLS sessions. False means
+     *               that each request gets a new connection.
+     */
+    void reuseConnections(const bool reuse);
+
+
+    /** \brief checks whether Curly asks for compressed responses
+     *
+     * \return Returns true, if perform() sends an Accept-Encoding header with
+     *         all encodings that the cURL library can decode.
+     * \remarks Default behaviour is to accept compressed responses.
+     */
+    bool acceptsCompression() const;
+
+
+    /** \brief changes whether Curly::perform() asks for compressed responses
+     *
+     * \param accept  Set this to true (default), if the server may compress
+     *                the response with gzip, deflate or brotli. The response
+     *                is decompressed while it is received, so the result of
+     *                perform() is always the decoded response.
+     */
+    void acceptCompression(const bool accept);
+
+
+    /** \brief checks whether Curly prefers HTTP/2
+     *
+     * \return Returns true, if perform() prefers HTTP/2 for HTTPS URLs.
+     *         Returns false, if it uses HTTP/1.1.
+     * \remarks New instances get the value of defaultHttp2().
+     */
+    bool usesHttp2() const;
+
+
+    /** \brief changes whether Curly::perform() prefers HTTP/2
+     *
+     * \param use  Set this to true, if Curly shall prefer HTTP/2 for HTTPS
+     *             URLs, or to false, if it shall use HTTP/1.1. HTTP/1.1 is
+     *             used in any case, if the cURL library does not support
+     *             HTTP/2.
+     */
+    void useHttp2(const bool use);
+
+
+    /** \brief checks whether new instances prefer HTTP/2
+     *
+     * \return Returns true, if new instances prefer HTTP/2. Unless it is
+     *         changed with setDefaultHttp2(), this is true.
+     */
+    static bool defaultHttp2();
+
+
+    /** \brief changes whether new instances prefer HTTP/2
+     *
+     * \param use  true to prefer HTTP/2, false to use HTTP/1.1
+     * \remarks This is thread-safe, but it should be called before any other
+     *          threads are started that use Curly, so that all requests use
+     *          the same HTTP version.
+     */
+    static void setDefaultHttp2(const bool use);
+
+
+    /** \brief gets the timeouts of the requests
+     *
+     * \return Returns the timeouts that perform() uses.
+     */
+    const Timeouts& timeouts() const;
+
+
+    /** \brief changes the timeouts of the requests
+     *
+     * \param limits  the new timeouts
+     * \remarks New instances get the timeouts of defaultTimeouts().
+     */
+    void setTimeouts(const Timeouts& limits);
+
+
+    /** \brief gets the timeouts that new instances use
+     *
+     * \return Returns the default timeouts. Unless they are changed with
+     *         setDefaultTimeouts(), the connection setup may take ten seconds,
+     *         the whole request may take 60 seconds, and requests that stall
+     *         for 30 seconds are aborted.
+     */
+    static Timeouts defaultTimeouts();
+
+
+    /** \brief changes the timeouts that new instances use
+     *
+     * \param limits  the new default timeouts
+     * \remarks This is thread-safe, but it should be called before any other
+     *          threads are started that use Curly, so that all requests use
+     *          the same timeouts.
+     */
+    static void setDefaultTimeouts(const Timeouts& limits);
+
+
     /** \brief performs the (POST) request
      *
      * \param response  reference to a string that will be filled with the
@@ -178,6 +366,9 @@ class Curly
      *         Returns false, if the request was not performed properly.
      *         Note that the value of @arg response is undefined, if the
      *         request failed.
+     * \remarks The memory of @arg response is reused, so passing the same
+     *          string to several requests avoids reallocations. Its capacity
+     *          always leaves responsePadding free bytes after the response.
      */
     bool perform(std::string& response);
 
@@ -201,6 +392,29 @@ class Curly
     const std::string& getContentType() const;
 
 
+    /** \brief returns the size of the response body of the last request as it
+     *         was transferred over the network, i. e. before decompression
+     *
+     * \return Returns the number of received body bytes of the last request.
+     */
+    uint_least64_t getWireBytes() const;
+
+
+    /** \brief returns the size of the decoded response body of the last request
+     *
+     * \return Returns the number of body bytes after decompression.
+     */
+    uint_least64_t getDecodedBytes() const;
+
+
+    /** \brief returns the durations of the phases of the last request
+     *
+     * \return Returns the timing of the last request. The timing is also set,
+     *         if the request failed, e. g. because of a timeout.
+     */
+    const RequestTiming& getTiming() const;
+
+
     /** \brief structure to hold version information about the underlying cURL
      *         library
      */
@@ -227,6 +441,17 @@ class Curly
     static VersionData curlVersion();
 
 
+    /** \brief performs the global initialization of the cURL library
+     *
+     * \return Returns true, if the initialization was successful.
+     *         Returns false otherwise.
+     * \remarks This should be called once, before any other threads are
+     *          started that use Curly, because older versions of cURL do not
+     *          perform the global initialization in a thread-safe manner.
+     */
+    static bool globalInit();
+
+
     /** \brief gets the list of header lines that were returned by the request
      *
      * \return Returns a vector of strings, one string for each header line.
@@ -264,6 +489,13 @@ class Curly
     std::string m_LastContentType; /**< string that holds the last content type */
     bool m_followRedirects; /**< whether to follow redirects */
     long int m_maxRedirects; /**< maximum number of redirects that Curly will follow */
+    bool m_reuseConnections; /**< whether to use the handle of the current thread */
+    bool m_acceptCompression; /**< whether to accept compressed responses */
+    bool m_http2; /**< whether to prefer HTTP/2 for HTTPS */
+    Timeouts m_timeouts; /**< timeouts of the requests */
+    uint_least64_t m_LastWireBytes; /**< received body bytes of the last request */
+    uint_least64_t m_LastDecodedBytes; /**< decoded body bytes of the last request */
+    RequestTiming m_LastTiming; /**< timing of the last request */
     std::vector<std::string> m_ResponseHeaders; /**< response headers returned by the last request */
 }; //class Curly
 
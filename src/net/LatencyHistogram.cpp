@@ -0,0 +1,77 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "LatencyHistogram.hpp"
+
+const std::array<unsigned int, 8> LatencyHistogram::bounds = { 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+LatencyHistogram::LatencyHistogram()
+: counts(std::array<uint_least64_t, bucketCount>()),
+  total(0),
+  sum(std::chrono::microseconds::zero())
+{
+  counts.fill(0);
+}
+
+void LatencyHistogram::add(const std::chrono::microseconds& latency)
+{
+  const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(latency).count();
+  std::size_t bucket = 0;
+  while ((bucket < bounds.size()) && (millis >= static_cast<std::chrono::milliseconds::rep>(bounds[bucket])))
+  {
+    ++bucket;
+  }
+  ++counts[bucket];
+  ++total;
+  sum += latency;
+}
+
+uint_least64_t LatencyHistogram::count() const
+{
+  return total;
+}
+
+const std::array<uint_least64_t, LatencyHistogram::bucketCount>& LatencyHistogram::buckets() const
+{
+  return counts;
+}
+
+std::chrono::microseconds LatencyHistogram::average() const
+{
+  if (total == 0)
+    return std::chrono::microseconds::zero();
+  return sum / static_cast<std::chrono::microseconds::rep>(total);
+}
+
+std::string LatencyHistogram::toString() const
+{
+  std::string result = std::to_string(total) + " request(s), average "
+                     + std::to_string(average().count() / 1000) + " ms";
+  for (std::size_t i = 0; i < bucketCount; ++i)
+  {
+    if (counts[i] == 0)
+      continue;
+    const std::string range = (i < bounds.size())
+        ? "< " + std::to_string(bounds[i]) + " ms"
+        : ">= " + std::to_string(bounds.back()) + " ms";
+    result += ", " + range + ": " + std::to_string(counts[i]);
+  }
+  return result;
+}
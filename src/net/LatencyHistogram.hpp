@@ -0,0 +1,93 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_NET_LATENCYHISTOGRAM_HPP
+#define WEATHER_INFORMATION_COLLECTOR_NET_LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** \brief Counts request latencies in buckets of increasing width.
+ *
+ * \remarks The class is not thread-safe.
+ */
+class LatencyHistogram
+{
+  public:
+    /** \brief upper bounds of the buckets in milliseconds, the last bucket
+     *         gets all latencies above the last bound
+     */
+    static const std::array<unsigned int, 8> bounds;
+
+
+    /** \brief number of buckets */
+    static constexpr std::size_t bucketCount = 9;
+
+
+    /** \brief Constructor. Creates an empty histogram. */
+    LatencyHistogram();
+
+
+    /** \brief Adds a latency to the histogram.
+     *
+     * \param latency  the latency of a request
+     */
+    void add(const std::chrono::microseconds& latency);
+
+
+    /** \brief Gets the number of latencies in the histogram.
+     *
+     * \return Returns the number of added latencies.
+     */
+    uint_least64_t count() const;
+
+
+    /** \brief Gets the number of latencies in each bucket.
+     *
+     * \return Returns the counts of the buckets. Bucket i contains the
+     *         latencies below bounds[i] (and at least bounds[i-1]), the last
+     *         bucket contains all latencies of at least the last bound.
+     */
+    const std::array<uint_least64_t, bucketCount>& buckets() const;
+
+
+    /** \brief Gets the average latency.
+     *
+     * \return Returns the average of all latencies.
+     *         Returns zero, if the histogram is empty.
+     */
+    std::chrono::microseconds average() const;
+
+
+    /** \brief Gets a single line representation of the histogram.
+     *
+     * \return Returns the average and the non-empty buckets as string.
+     */
+    std::string toString() const;
+  private:
+    std::array<uint_least64_t, bucketCount> counts; /**< number of latencies per bucket */
+    uint_least64_t total; /**< number of latencies */
+    std::chrono::microseconds sum; /**< sum of all latencies */
+}; // class
+
+#endif // WEATHER_INFORMATION_COLLECTOR_NET_LATENCYHISTOGRAM_HPP
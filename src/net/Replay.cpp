@@ -0,0 +1,181 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Replay.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+
+std::string redirectBase; /**< base URL of the replay server, empty if disabled */
+std::string recordDirectory; /**< fixture directory, empty if recording is disabled */
+std::mutex recordMutex; /**< serializes writes of fixture files */
+
+/** \brief maximum length of the readable part of a fixture file name */
+const std::string::size_type maximumNameLength = 138;
+
+/** \brief Calculates the 64 bit FNV-1a hash of a string.
+ *
+ * \param data  the string
+ * \return Returns the hash value.
+ * \remarks Unlike std::hash the value is the same on every platform, so the
+ *          names of fixture files do not depend on the standard library.
+ */
+uint64_t fnv1a(const std::string& data)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : data)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+} // namespace
+
+std::string Replay::pattern(std::string_view url)
+{
+  const auto scheme = url.find("://");
+  if (scheme != std::string_view::npos)
+    url.remove_prefix(scheme + 3);
+  while (!url.empty() && (url.front() == '/'))
+    url.remove_prefix(1);
+  url = url.substr(0, url.find('#'));
+
+  const auto question = url.find('?');
+  std::string result(url.substr(0, question));
+  if (question == std::string_view::npos)
+    return result;
+
+  std::vector<std::string> parameters;
+  std::string_view query = url.substr(question + 1);
+  while (!query.empty())
+  {
+    const auto ampersand = query.find('&');
+    const std::string_view parameter = query.substr(0, ampersand);
+    query = (ampersand == std::string_view::npos) ? std::string_view() : query.substr(ampersand + 1);
+    if (parameter.empty())
+      continue;
+    const auto equals = parameter.find('=');
+    if (equals == std::string_view::npos)
+    {
+      parameters.emplace_back(parameter);
+      continue;
+    }
+    const std::string_view value = parameter.substr(equals + 1);
+    const auto items = value.empty() ? 0 : std::count(value.begin(), value.end(), ',') + 1;
+    parameters.push_back(std::string(parameter.substr(0, equals)) + "=" + std::to_string(items));
+  }
+  std::sort(parameters.begin(), parameters.end());
+
+  result.push_back('?');
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+  {
+    if (i > 0)
+      result.push_back('&');
+    result.append(parameters[i]);
+  }
+  return result;
+}
+
+std::string Replay::fileName(const std::string& pattern)
+{
+  std::string name(pattern);
+  for (char& c : name)
+  {
+    const bool allowed = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'))
+                      || ((c >= '0') && (c <= '9')) || (c == '.') || (c == '-');
+    if (!allowed)
+      c = '_';
+  }
+  if (name.size() > maximumNameLength)
+  {
+    // Keep the start for readability and make the name unique with a hash.
+    static const char digits[] = "0123456789abcdef";
+    uint64_t hash = fnv1a(pattern);
+    name.resize(maximumNameLength);
+    name.push_back('-');
+    for (int i = 0; i < 16; ++i)
+    {
+      name.push_back(digits[(hash >> 60) & 0xF]);
+      hash <<= 4;
+    }
+  }
+  return name + ".json";
+}
+
+void Replay::setRedirect(const std::string& base)
+{
+  redirectBase = base;
+  while (!redirectBase.empty() && (redirectBase.back() == '/'))
+    redirectBase.pop_back();
+}
+
+std::string Replay::redirect(const std::string& url)
+{
+  if (redirectBase.empty())
+    return url;
+  const auto scheme = url.find("://");
+  return redirectBase + "/" + ((scheme == std::string::npos) ? url : url.substr(scheme + 3));
+}
+
+void Replay::setRecordDirectory(const std::string& directory)
+{
+  recordDirectory = directory;
+}
+
+bool Replay::record(const std::string& url, const std::string& response)
+{
+  // Responses of the replay server itself are not worth recording.
+  if (recordDirectory.empty() || !redirectBase.empty())
+    return true;
+
+  const std::filesystem::path path = std::filesystem::path(recordDirectory) / fileName(pattern(url));
+  std::filesystem::path temporary(path);
+  temporary += ".tmp";
+
+  std::lock_guard<std::mutex> lock(recordMutex);
+  {
+    std::ofstream stream(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(response.data(), response.size());
+    stream.close();
+    if (!stream.good())
+    {
+      std::cerr << "Error: Could not write fixture file " << temporary.string() << "!" << std::endl;
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary, path, error);
+  if (error)
+  {
+    std::cerr << "Error: Could not write fixture file " << path.string() << "! "
+              << error.message() << std::endl;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,99 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_NET_REPLAY_HPP
+#define WEATHER_INFORMATION_COLLECTOR_NET_REPLAY_HPP
+
+#include <string>
+#include <string_view>
+
+/** \brief Records responses of the weather APIs into fixture files and
+ *         redirects requests to a replay server that serves those fixtures.
+ *
+ * Fixtures are stored per URL pattern. The pattern of an URL consists of its
+ * host, its path and the names of its query parameters, but not of the values
+ * of the parameters. Instead of a value the pattern contains the number of
+ * comma-separated items in it, so that requests for a different number of
+ * locations get different fixtures. That way one recorded response can be
+ * replayed for any location, and API keys are never written to a fixture.
+ *
+ * \remarks Redirection and recording have to be set up before any requests
+ *          are made. Afterwards the class is thread-safe.
+ */
+class Replay
+{
+  public:
+    /** \brief Gets the URL pattern of an URL.
+     *
+     * \param url  the URL, e. g. "https://api.example.com/v1/data?lat=1,2&key=abc",
+     *             the scheme and the leading slashes are optional
+     * \return Returns the pattern of the URL, e. g. "api.example.com/v1/data?key=1&lat=2".
+     */
+    static std::string pattern(std::string_view url);
+
+
+    /** \brief Gets the name of the fixture file for an URL pattern.
+     *
+     * \param pattern  the URL pattern, see pattern()
+     * \return Returns a file name that only contains letters, digits, dots,
+     *         hyphens and underscores and is not longer than 160 characters.
+     */
+    static std::string fileName(const std::string& pattern);
+
+
+    /** \brief Sets the base URL of the replay server.
+     *
+     * \param base  base URL of the replay server, e. g. "http://127.0.0.1:8080",
+     *              or an empty string to disable redirection
+     */
+    static void setRedirect(const std::string& base);
+
+
+    /** \brief Redirects an URL to the replay server, if a server is set.
+     *
+     * \param url  the original URL, e. g. "https://api.example.com/v1/data?x=1"
+     * \return Returns the URL on the replay server, e. g.
+     *         "http://127.0.0.1:8080/api.example.com/v1/data?x=1". Returns the
+     *         original URL, if no replay server is set.
+     */
+    static std::string redirect(const std::string& url);
+
+
+    /** \brief Sets the directory where recorded responses are stored.
+     *
+     * \param directory  the fixture directory, or an empty string to disable
+     *                   recording
+     */
+    static void setRecordDirectory(const std::string& directory);
+
+
+    /** \brief Writes a successful response into the fixture file of its URL
+     *         pattern, if recording is enabled. An existing fixture for the
+     *         same pattern is replaced.
+     *
+     * \param url       the URL of the request
+     * \param response  the response body
+     * \return Returns true, if recording is disabled or the fixture was written.
+     *         Returns false, if the fixture could not be written.
+     */
+    static bool record(const std::string& url, const std::string& response);
+}; // class
+
+#endif // WEATHER_INFORMATION_COLLECTOR_NET_REPLAY_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,18 +19,35 @@
 */
 
 #include "Request.hpp"
+#include <atomic>
 #include <iostream>
 #include "Curly.hpp"
+#include "Replay.hpp"
+
+namespace
+{
+
+std::atomic<uint_least64_t> trafficRequests(0);
+std::atomic<uint_least64_t> trafficWireBytes(0);
+std::atomic<uint_least64_t> trafficDecodedBytes(0);
+std::atomic<uint_least64_t> trafficNotModified(0);
+
+// Status code of the latest request of the thread, see Request::lastStatusCode().
+thread_local long latestStatusCode = -1;
+
+} // namespace
 
 std::optional<std::string> Request::get(const std::string& url, const std::string_view fn)
 {
   std::string response;
   Curly curly;
-  curly.setURL(url);
+  curly.setURL(Replay::redirect(url));
   if (!curly.perform(response))
   {
+    latestStatusCode = 0;
     return {};
   }
+  latestStatusCode = curly.getResponseCode();
   if (curly.getResponseCode() != 200)
   {
     std::cerr << "Error in " << fn << "(): Unexpected HTTP status code "
@@ -43,5 +60,49 @@ std::optional<std::string> Request::get(const std::string& url, const std::strin
     }
     return {};
   }
+  countTraffic(curly.getWireBytes(), curly.getDecodedBytes());
+  Replay::record(url, response);
   return response;
 }
+
+long Request::lastStatusCode()
+{
+  return latestStatusCode;
+}
+
+void Request::resetLastStatusCode()
+{
+  latestStatusCode = -1;
+}
+
+void Request::countTraffic(const uint_least64_t wireBytes, const uint_least64_t decodedBytes)
+{
+  trafficRequests += 1;
+  trafficWireBytes += wireBytes;
+  trafficDecodedBytes += decodedBytes;
+}
+
+void Request::countNotModified()
+{
+  trafficNotModified += 1;
+}
+
+TrafficStatistics Request::traffic()
+{
+  return TrafficStatistics{ trafficRequests.load(), trafficWireBytes.load(),
+                            trafficDecodedBytes.load(), trafficNotModified.load() };
+}
+
+void Request::printTraffic()
+{
+  const TrafficStatistics t = traffic();
+  std::cout << "Network statistics: " << t.requests << " successful request(s), "
+            << t.wireBytes << " byte(s) received for " << t.decodedBytes
+            << " byte(s) of response data";
+  if ((t.decodedBytes > 0) && (t.wireBytes < t.decodedBytes))
+  {
+    std::cout << " (" << (100 * (t.decodedBytes - t.wireBytes) / t.decodedBytes)
+              << " % saved by compression)";
+  }
+  std::cout << ", " << t.notModified << " request(s) without changed data" << std::endl;
+}
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,10 +21,20 @@
 #ifndef WEATHER_INFORMATION_COLLECTOR_NET_REQUEST_HPP
 #define WEATHER_INFORMATION_COLLECTOR_NET_REQUEST_HPP
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
 
+/** \brief Totals of the response data of all successful HTTP requests. */
+struct TrafficStatistics
+{
+  uint_least64_t requests; /**< number of successful requests */
+  uint_least64_t wireBytes; /**< body bytes as transferred, i. e. compressed */
+  uint_least64_t decodedBytes; /**< body bytes after decompression */
+  uint_least64_t notModified; /**< number of requests that got no new data (HTTP status code 304) */
+}; // struct
+
 /** Utility class to simplify HTTP requests. */
 class Request
 {
@@ -40,6 +50,52 @@ class Request
      *         request fails (i. e. returns an HTTP status code other than 200).
      */
     static std::optional<std::string> get(const std::string& url, const std::string_view fn);
+
+
+    /** \brief Gets the HTTP status code of the latest request that the calling
+     *         thread performed with get().
+     *
+     * \return Returns the HTTP status code of the latest request. Returns zero,
+     *         if that request got no response at all (e. g. after a timeout).
+     *         Returns -1, if the thread did not perform any request since the
+     *         last call of resetLastStatusCode().
+     */
+    static long lastStatusCode();
+
+
+    /** \brief Resets the status code returned by lastStatusCode() for the
+     *         calling thread to -1.
+     */
+    static void resetLastStatusCode();
+
+
+    /** \brief Adds a successful request to the traffic statistics.
+     *
+     * \param wireBytes     size of the response body as it was transferred
+     * \param decodedBytes  size of the response body after decompression
+     * \remarks This is thread-safe.
+     */
+    static void countTraffic(const uint_least64_t wireBytes, const uint_least64_t decodedBytes);
+
+
+    /** \brief Adds a request that got no new data, because the data did not
+     *         change since the previous request, to the traffic statistics.
+     *
+     * \remarks This is thread-safe.
+     */
+    static void countNotModified();
+
+
+    /** \brief Gets the traffic statistics of all requests so far.
+     *
+     * \return Returns the totals of all successful requests.
+     */
+    static TrafficStatistics traffic();
+
+
+    /** \brief Prints the traffic statistics to the standard output.
+     */
+    static void printTraffic();
 }; // class
 
 #endif // WEATHER_INFORMATION_COLLECTOR_NET_REQUEST_HPP
@@ -0,0 +1,451 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "RequestEngine.hpp"
+#include <iostream>
+#include <utility>
+#include <curl/curl.h>
+#include "Replay.hpp"
+#include "Request.hpp"
+#include "../util/Strings.hpp"
+
+namespace
+{
+
+/** \brief Gets the scheme and host part of an URL.
+ *
+ * \param url  the URL, e. g. "https://api.example.com/v1/data?x=1"
+ * \return Returns the URL of the root of the host, e. g.
+ *         "https://api.example.com/". Returns an empty string, if the URL has
+ *         no scheme.
+ */
+std::string originOf(const std::string& url)
+{
+  const auto scheme = url.find("://");
+  if (scheme == std::string::npos)
+    return std::string();
+  const auto path = url.find('/', scheme + 3);
+  return (path == std::string::npos) ? url + "/" : url.substr(0, path + 1);
+}
+
+/** \brief time after a transfer during which its connection is considered to
+ *         be still open
+ *
+ * cURL closes idle connections after 118 seconds by default, and servers often
+ * close them even earlier.
+ */
+const std::chrono::seconds connectionLifetime(60);
+
+} // namespace
+
+RequestEngine::RequestEngine(const std::size_t connectionsPerHost, const bool useMultiplexing)
+: multi(curl_multi_init()),
+  multiplex(useMultiplexing),
+  timeouts(Curly::defaultTimeouts()),
+  idleHandles(std::vector<void*>()),
+  queue(std::vector<std::unique_ptr<Transfer> >()),
+  unfinished(0),
+  lastUse(std::unordered_map<std::string, std::chrono::steady_clock::time_point>()),
+  cold(LatencyHistogram()),
+  warm(LatencyHistogram()),
+  mutex(),
+  stopped(false),
+  thread(std::thread())
+{
+  if (multi == nullptr)
+  {
+    std::cerr << "cURL error: multi init failed!" << std::endl;
+    return;
+  }
+  const long perHost = connectionsPerHost > 0 ? static_cast<long>(connectionsPerHost) : 1L;
+  CURLMcode code = curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, perHost);
+  if (code == CURLM_OK)
+  {
+    // Keep enough connections in the cache for all hosts, because the
+    // default size is too small when there are several APIs.
+    code = curl_multi_setopt(multi, CURLMOPT_MAXCONNECTS, perHost * 8);
+  }
+  #if CURL_AT_LEAST_VERSION(7, 47, 0)
+  const curl_version_info_data* info = curl_version_info(CURLVERSION_NOW);
+  if (multiplex && ((info->features & CURL_VERSION_HTTP2) == 0))
+  {
+    std::cout << "Info: The cURL library does not support HTTP/2, so every "
+              << "request needs its own connection." << std::endl;
+    multiplex = false;
+  }
+  #else
+  // HTTP/2 is not available in older cURL versions.
+  multiplex = false;
+  #endif
+  #if CURL_AT_LEAST_VERSION(7, 43, 0)
+  if (code == CURLM_OK)
+  {
+    code = curl_multi_setopt(multi, CURLMOPT_PIPELINING,
+                             multiplex ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+  }
+  #endif
+  if (code != CURLM_OK)
+  {
+    std::cerr << "cURL error: setting connection options failed! Error: "
+              << curl_multi_strerror(code) << std::endl;
+    curl_multi_cleanup(multi);
+    multi = nullptr;
+    return;
+  }
+  thread = std::thread(&RequestEngine::run, this);
+}
+
+RequestEngine::~RequestEngine()
+{
+  stop();
+  for (void* handle : idleHandles)
+  {
+    curl_easy_cleanup(handle);
+  }
+  if (multi != nullptr)
+    curl_multi_cleanup(multi);
+}
+
+bool RequestEngine::good() const
+{
+  return multi != nullptr;
+}
+
+bool RequestEngine::multiplexes() const
+{
+  return multiplex;
+}
+
+bool RequestEngine::get(const std::string& url, const std::string_view fn, Callback callback)
+{
+  if (!callback)
+    return false;
+  return enqueue(url, fn, nullptr, [callback = std::move(callback)](const Outcome outcome, std::string&& response, const TransferInfo&)
+  {
+    if (outcome == Outcome::Changed)
+      callback(std::move(response));
+    else
+      callback(std::nullopt);
+  }, false);
+}
+
+bool RequestEngine::getWithInfo(const std::string& url, const std::string_view fn, ConditionalCallback callback)
+{
+  if (!callback)
+    return false;
+  return enqueue(url, fn, nullptr, std::move(callback), false);
+}
+
+bool RequestEngine::getIfChanged(const std::string& url, const std::string_view fn, Validators& validators, ConditionalCallback callback)
+{
+  if (!callback)
+    return false;
+  return enqueue(url, fn, &validators, std::move(callback), false);
+}
+
+void RequestEngine::prewarm(const std::string& url)
+{
+  const std::string origin = originOf(Replay::redirect(url));
+  if (origin.empty())
+    return;
+  enqueue(origin, "RequestEngine::prewarm", nullptr, [](const Outcome, std::string&&, const TransferInfo&) { }, true);
+}
+
+LatencyHistogram RequestEngine::coldLatencies() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return cold;
+}
+
+LatencyHistogram RequestEngine::warmLatencies() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return warm;
+}
+
+bool RequestEngine::enqueue(const std::string& url, const std::string_view fn, Validators* validators,
+                            ConditionalCallback callback, const bool warmup)
+{
+  if (multi == nullptr)
+    return false;
+  // Warm-up requests already get the origin of a redirected URL.
+  std::string target = warmup ? url : Replay::redirect(url);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stopped)
+      return false;
+    queue.push_back(std::make_unique<Transfer>(Transfer{ std::move(target), std::string(fn), std::move(callback),
+        validators, Validators(), std::string(), nullptr, std::string(), ResponseBuffer{ nullptr, nullptr }, warmup }));
+    ++unfinished;
+  }
+  #if CURL_AT_LEAST_VERSION(7, 68, 0)
+  curl_multi_wakeup(multi);
+  #endif
+  return true;
+}
+
+std::future<std::optional<std::string>> RequestEngine::get(const std::string& url, const std::string_view fn)
+{
+  auto promise = std::make_shared<std::promise<std::optional<std::string>>>();
+  std::future<std::optional<std::string>> result = promise->get_future();
+  const bool started = get(url, fn, [promise](std::optional<std::string>&& response)
+  {
+    promise->set_value(std::move(response));
+  });
+  if (!started)
+    promise->set_value(std::nullopt);
+  return result;
+}
+
+std::size_t RequestEngine::pending() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return unfinished;
+}
+
+void RequestEngine::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+  }
+  #if CURL_AT_LEAST_VERSION(7, 68, 0)
+  if (multi != nullptr)
+    curl_multi_wakeup(multi);
+  #endif
+  if (thread.joinable())
+    thread.join();
+}
+
+void RequestEngine::startQueued()
+{
+  std::vector<std::unique_ptr<Transfer> > transfers;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    transfers.swap(queue);
+  }
+  for (std::unique_ptr<Transfer>& transfer : transfers)
+  {
+    if (transfer->warmup)
+    {
+      const auto iter = lastUse.find(transfer->url);
+      if ((iter != lastUse.end()) && (std::chrono::steady_clock::now() - iter->second < connectionLifetime))
+      {
+        // The connection is probably still open, nothing to do.
+        std::lock_guard<std::mutex> lock(mutex);
+        --unfinished;
+        continue;
+      }
+    }
+    CURL* handle = nullptr;
+    if (!idleHandles.empty())
+    {
+      handle = idleHandles.back();
+      idleHandles.pop_back();
+      curl_easy_reset(handle);
+    }
+    else
+    {
+      handle = curl_easy_init();
+    }
+    // The DNS cache and the TLS sessions are shared with the handles of the
+    // workers, so those benefit from the connections of the engine, too.
+    if (handle != nullptr)
+      useSharedData(handle);
+    transfer->buffer = ResponseBuffer{ &transfer->response, handle };
+    curl_slist* headers = nullptr;
+    if ((transfer->validators != nullptr) && !transfer->validators->etag.empty())
+      headers = curl_slist_append(headers, ("If-None-Match: " + transfer->validators->etag).c_str());
+    if ((transfer->validators != nullptr) && !transfer->validators->lastModified.empty())
+      headers = curl_slist_append(headers, ("If-Modified-Since: " + transfer->validators->lastModified).c_str());
+    transfer->headers = headers;
+    if ((handle == nullptr)
+        || (curl_easy_setopt(handle, CURLOPT_URL, transfer->url.c_str()) != CURLE_OK)
+        #if CURL_AT_LEAST_VERSION(7, 54, 0)
+        || (curl_easy_setopt(handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2) != CURLE_OK)
+        #endif
+        #if CURL_AT_LEAST_VERSION(7, 47, 0)
+        || (multiplex && (curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS) != CURLE_OK))
+        // Wait for a connection that is being set up instead of opening
+        // another one, because the new request can probably use it, too.
+        || (multiplex && (curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L) != CURLE_OK))
+        || (!multiplex && (curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1) != CURLE_OK))
+        #endif
+        // Accept all encodings that cURL can decode while receiving.
+        || (curl_easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, "") != CURLE_OK)
+        || (curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, writeCallbackPadded) != CURLE_OK)
+        || (curl_easy_setopt(handle, CURLOPT_WRITEDATA, &transfer->buffer) != CURLE_OK)
+        || (curl_easy_setopt(handle, CURLOPT_PRIVATE, transfer.get()) != CURLE_OK)
+        || !setTimeoutOptions(handle, timeouts)
+        || (transfer->warmup && (curl_easy_setopt(handle, CURLOPT_NOBODY, 1L) != CURLE_OK))
+        || ((headers != nullptr) && (curl_easy_setopt(handle, CURLOPT_HTTPHEADER, headers) != CURLE_OK))
+        || (curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, headerCallback) != CURLE_OK)
+        || (curl_easy_setopt(handle, CURLOPT_HEADERDATA, transfer.get()) != CURLE_OK)
+        || (curl_multi_add_handle(multi, handle) != CURLM_OK))
+    {
+      std::cerr << "Error in " << transfer->fn << "(): Request to "
+                << transfer->url << " could not be started!" << std::endl;
+      if (handle != nullptr)
+        curl_easy_cleanup(handle);
+      curl_slist_free_all(headers);
+      transfer->callback(Outcome::Failed, std::string(), TransferInfo{ 0, std::string(), RequestTiming() });
+      std::lock_guard<std::mutex> lock(mutex);
+      --unfinished;
+      continue;
+    }
+    // The transfer is owned by the handle from now on, see finishCompleted().
+    transfer.release();
+  } // for
+}
+
+void RequestEngine::finishCompleted()
+{
+  int messagesLeft = 0;
+  CURLMsg* message = nullptr;
+  while ((message = curl_multi_info_read(multi, &messagesLeft)) != nullptr)
+  {
+    if (message->msg != CURLMSG_DONE)
+      continue;
+    CURL* handle = message->easy_handle;
+    const CURLcode result = message->data.result;
+    char* data = nullptr;
+    curl_easy_getinfo(handle, CURLINFO_PRIVATE, &data);
+    std::unique_ptr<Transfer> transfer(reinterpret_cast<Transfer*>(data));
+    long responseCode = 0;
+    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &responseCode);
+    #if CURL_AT_LEAST_VERSION(7, 55, 0)
+    curl_off_t wireBytes = 0;
+    curl_easy_getinfo(handle, CURLINFO_SIZE_DOWNLOAD_T, &wireBytes);
+    #else
+    double wireBytes = 0.0;
+    curl_easy_getinfo(handle, CURLINFO_SIZE_DOWNLOAD, &wireBytes);
+    #endif
+    long connects = 0;
+    curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &connects);
+    const TransferInfo info{ result == CURLE_OK ? responseCode : 0, std::move(transfer->retryAfter),
+                             timingOfTransfer(handle) };
+    curl_multi_remove_handle(multi, handle);
+    idleHandles.push_back(handle);
+    curl_slist_free_all(reinterpret_cast<curl_slist*>(transfer->headers));
+    if (result == CURLE_OK)
+    {
+      lastUse[transfer->warmup ? transfer->url : originOf(transfer->url)] = std::chrono::steady_clock::now();
+      if (!transfer->warmup)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (connects > 0)
+          cold.add(info.timing.total);
+        else
+          warm.add(info.timing.total);
+      }
+    }
+
+    if (transfer->warmup)
+    {
+      // Only the connection matters, so any status code is fine.
+      transfer->callback(result == CURLE_OK ? Outcome::Changed : Outcome::Failed, std::string(), info);
+    }
+    else if (result != CURLE_OK)
+    {
+      std::cerr << "Error in " << transfer->fn << "(): Request failed! Error: "
+                << curl_easy_strerror(result) << std::endl;
+      transfer->callback(Outcome::Failed, std::string(), info);
+    }
+    else if ((responseCode == 304) && (transfer->validators != nullptr))
+    {
+      Request::countNotModified();
+      transfer->callback(Outcome::Unchanged, std::string(), info);
+    }
+    else if (responseCode != 200)
+    {
+      std::cerr << "Error in " << transfer->fn << "(): Unexpected HTTP status code "
+                << responseCode << "!" << std::endl;
+      transfer->callback(Outcome::Failed, std::string(), info);
+    }
+    else
+    {
+      if (transfer->validators != nullptr)
+        *transfer->validators = std::move(transfer->received);
+      Request::countTraffic(static_cast<uint_least64_t>(wireBytes), transfer->response.size());
+      Replay::record(transfer->url, transfer->response);
+      transfer->callback(Outcome::Changed, std::move(transfer->response), info);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    --unfinished;
+  } // while
+}
+
+size_t RequestEngine::headerCallback(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+  const size_t actualSize = size * nitems;
+  if (userdata == nullptr)
+    return actualSize;
+  Transfer* transfer = reinterpret_cast<Transfer*>(userdata);
+  const std::string_view line(buffer, actualSize);
+  const auto colon = line.find(':');
+  if (colon == std::string_view::npos)
+    return actualSize;
+  const std::string name = wic::toLowerString(std::string(line.substr(0, colon)));
+  if ((name != "etag") && (name != "last-modified") && (name != "retry-after"))
+    return actualSize;
+  std::string value(line.substr(colon + 1));
+  while (!value.empty() && ((value.back() == '\r') || (value.back() == '\n')))
+  {
+    value.pop_back();
+  }
+  wic::trim(value);
+  if (name == "etag")
+    transfer->received.etag = value;
+  else if (name == "last-modified")
+    transfer->received.lastModified = value;
+  else
+    transfer->retryAfter = value;
+  return actualSize;
+}
+
+void RequestEngine::run()
+{
+  while (true)
+  {
+    startQueued();
+    int stillRunning = 0;
+    const CURLMcode code = curl_multi_perform(multi, &stillRunning);
+    if (code != CURLM_OK)
+    {
+      std::cerr << "cURL error: multi perform failed! Error: "
+                << curl_multi_strerror(code) << std::endl;
+    }
+    finishCompleted();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (stopped && (unfinished == 0))
+        return;
+      if (!queue.empty())
+        continue;
+    }
+    #if CURL_AT_LEAST_VERSION(7, 68, 0)
+    curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+    #else
+    // Without a way to wake up the wait, keep the timeout short to notice
+    // new requests quickly.
+    curl_multi_wait(multi, nullptr, 0, 50, nullptr);
+    #endif
+  } // while
+}
@@ -0,0 +1,306 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_NET_REQUESTENGINE_HPP
+#define WEATHER_INFORMATION_COLLECTOR_NET_REQUESTENGINE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Curly.hpp"
+#include "LatencyHistogram.hpp"
+
+/** \brief Performs HTTP GET requests asynchronously.
+ *
+ * A single thread drives all transfers with the multi interface of cURL, so
+ * hundreds of requests can be in flight at the same time without a thread for
+ * each of them. Transfers share the connections, so requests to the same host
+ * reuse open connections. The number of connections per host is limited, and
+ * further requests to that host wait until a connection is available again.
+ *
+ * If multiplexing is enabled, the engine prefers HTTP/2 for HTTPS URLs, and
+ * simultaneous requests to the same host share a single connection instead of
+ * opening a connection for each request.
+ */
+class RequestEngine
+{
+  public:
+    /** \brief Function that is called when a request is finished. It gets the
+     *         response, if the request was successful (i. e. HTTP status code
+     *         200), or an empty optional, if the request failed.
+     *
+     * \remarks The function is called on the thread of the engine, so it
+     *          should return quickly. Longer work like JSON parsing should be
+     *          handed over to another thread.
+     */
+    typedef std::function<void(std::optional<std::string>&&)> Callback;
+
+
+    /** \brief Result of a conditional request. */
+    enum class Outcome
+    {
+      Changed,   /**< the request was successful and delivered new data */
+      Unchanged, /**< the data did not change since the previous request (HTTP status code 304) */
+      Failed     /**< the request failed */
+    }; // enum
+
+
+    /** \brief Details of a finished request besides its response. */
+    struct TransferInfo
+    {
+      long statusCode; /**< HTTP status code, zero if there was no response */
+      std::string retryAfter; /**< value of the Retry-After header, may be empty */
+      RequestTiming timing; /**< durations of the phases of the request */
+    }; // struct
+
+
+    /** \brief Function that is called when a conditional request is finished.
+     *         It gets the outcome, the response, which is only set for
+     *         Outcome::Changed, and the details of the request.
+     *
+     * \remarks Like Callback, the function is called on the thread of the
+     *          engine.
+     */
+    typedef std::function<void(const Outcome, std::string&&, const TransferInfo&)> ConditionalCallback;
+
+
+    /** \brief Values of the ETag and Last-Modified headers of the latest
+     *         successful response to a conditional request.
+     */
+    struct Validators
+    {
+      std::string etag; /**< value of the ETag header, may be empty */
+      std::string lastModified; /**< value of the Last-Modified header, may be empty */
+    }; // struct
+
+
+    /** \brief Constructor. Starts the thread of the engine.
+     *
+     * \param connectionsPerHost  maximum number of simultaneous connections
+     *                            to a single host
+     * \param useMultiplexing     whether to use HTTP/2 and several requests
+     *                            per connection
+     * \remarks Curly::globalInit() has to be called before the constructor.
+     *          The requests use the timeouts of Curly::defaultTimeouts() at
+     *          the time of construction.
+     */
+    RequestEngine(const std::size_t connectionsPerHost, const bool useMultiplexing);
+
+
+    RequestEngine(const RequestEngine& other) = delete;
+    RequestEngine(RequestEngine&& other) = delete;
+    RequestEngine& operator=(const RequestEngine& other) = delete;
+    RequestEngine& operator=(RequestEngine&& other) = delete;
+
+
+    /** \brief Destructor. Stops the engine after all requests are finished.
+     */
+    ~RequestEngine();
+
+
+    /** \brief Checks whether the engine could be set up properly.
+     *
+     * \return Returns true, if the engine can perform requests.
+     */
+    bool good() const;
+
+
+    /** \brief Checks whether requests to the same host can share a connection.
+     *
+     * \return Returns true, if the engine uses HTTP/2 multiplexing.
+     */
+    bool multiplexes() const;
+
+
+    /** \brief Starts an HTTP GET request.
+     *
+     * \param url       the URL to get
+     * \param fn        name of the calling function (only used in error case)
+     * \param callback  function that is called with the result
+     * \return Returns true, if the request was started. In that case the
+     *         callback is called exactly once.
+     *         Returns false, if the engine has been stopped or is not good().
+     */
+    bool get(const std::string& url, const std::string_view fn, Callback callback);
+
+
+    /** \brief Starts an HTTP GET request.
+     *
+     * \param url   the URL to get
+     * \param fn    name of the calling function (only used in error case)
+     * \return Returns a future that gets the response, if the request was
+     *         successful, or an empty optional, if the request failed.
+     */
+    std::future<std::optional<std::string>> get(const std::string& url, const std::string_view fn);
+
+
+    /** \brief Starts an HTTP GET request whose callback also gets the details
+     *         of the request, e. g. the HTTP status code of a failed request.
+     *
+     * \param url       the URL to get
+     * \param fn        name of the calling function (only used in error case)
+     * \param callback  function that is called with the result; the outcome
+     *                  is either Outcome::Changed or Outcome::Failed
+     * \return Returns true, if the request was started. In that case the
+     *         callback is called exactly once.
+     *         Returns false, if the engine has been stopped or is not good().
+     */
+    bool getWithInfo(const std::string& url, const std::string_view fn, ConditionalCallback callback);
+
+
+    /** \brief Starts a conditional HTTP GET request. If the validators of a
+     *         previous response are known, the request asks the server to
+     *         send the data only if it has changed since then.
+     *
+     * \param url         the URL to get
+     * \param fn          name of the calling function (only used in error case)
+     * \param validators  validators of the previous response; they are updated
+     *                    when a new response arrives
+     * \param callback    function that is called with the result
+     * \return Returns true, if the request was started. In that case the
+     *         callback is called exactly once.
+     *         Returns false, if the engine has been stopped or is not good().
+     * \remarks The engine uses @arg validators until the callback is called,
+     *          so they have to stay alive and must not be accessed by other
+     *          threads in the meantime.
+     */
+    bool getIfChanged(const std::string& url, const std::string_view fn, Validators& validators, ConditionalCallback callback);
+
+
+    /** \brief Sets up a connection to the host of an URL, so that a later
+     *         request to that host does not have to wait for DNS lookup, TCP
+     *         and TLS handshakes.
+     *
+     * \param url  an URL on the host
+     * \remarks Nothing happens, if there was a request to that host recently,
+     *          because its connection is probably still open.
+     */
+    void prewarm(const std::string& url);
+
+
+    /** \brief Gets the latencies of the requests that had to set up a new
+     *         connection.
+     *
+     * \return Returns the histogram of the latencies of those requests.
+     */
+    LatencyHistogram coldLatencies() const;
+
+
+    /** \brief Gets the latencies of the requests that used an existing
+     *         connection, e. g. a pre-warmed one.
+     *
+     * \return Returns the histogram of the latencies of those requests.
+     */
+    LatencyHistogram warmLatencies() const;
+
+
+    /** \brief Gets the number of requests that are not finished yet.
+     *
+     * \return Returns the number of started, but unfinished requests.
+     */
+    std::size_t pending() const;
+
+
+    /** \brief Waits until all started requests are finished and stops the
+     *         thread of the engine.
+     *
+     * \remarks Further calls to get() will fail after this call.
+     */
+    void stop();
+  private:
+    /** \brief Data of a single request. */
+    struct Transfer
+    {
+      std::string url; /**< URL of the request */
+      std::string fn; /**< name of the calling function */
+      ConditionalCallback callback; /**< function that gets the result */
+      Validators* validators; /**< validators of a conditional request, null for other requests */
+      Validators received; /**< validators of the response */
+      std::string retryAfter; /**< value of the Retry-After header of the response */
+      void* headers; /**< list of additional request headers, may be null */
+      std::string response; /**< received data */
+      ResponseBuffer buffer; /**< destination of the write callback */
+      bool warmup; /**< whether the transfer only sets up a connection */
+    }; // struct
+
+
+    /** \brief Adds a request to the queue.
+     *
+     * \param url         the URL to get
+     * \param fn          name of the calling function
+     * \param validators  validators for conditional requests, may be null
+     * \param callback    function that is called with the result
+     * \param warmup      whether the request only sets up a connection
+     * \return Returns true, if the request was queued.
+     */
+    bool enqueue(const std::string& url, const std::string_view fn, Validators* validators,
+                 ConditionalCallback callback, const bool warmup);
+
+
+    /** \brief Callback for response headers that collects the validators
+     *         and the Retry-After header.
+     *
+     * \param buffer   data of header (might not be NUL-terminated)
+     * \param size     size of an item
+     * \param nitems   number of items
+     * \param userdata pointer to the transfer
+     * \return Returns the size of the read data.
+     */
+    static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* userdata);
+
+
+    /** \brief Starts the transfers that were added since the last call.
+     */
+    void startQueued();
+
+
+    /** \brief Finishes all completed transfers and calls their callbacks.
+     */
+    void finishCompleted();
+
+
+    /** \brief Main loop of the thread of the engine. */
+    void run();
+
+
+    void* multi; /**< the multi handle of cURL */
+    bool multiplex; /**< whether HTTP/2 multiplexing is used */
+    Timeouts timeouts; /**< timeouts of the requests */
+    std::vector<void*> idleHandles; /**< easy handles that can be used again */
+    std::vector<std::unique_ptr<Transfer> > queue; /**< requests that are not started yet */
+    std::size_t unfinished; /**< number of requests that are not finished yet */
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> lastUse; /**< time of the latest transfer per host, only used by the thread of the engine */
+    LatencyHistogram cold; /**< latencies of requests with a new connection */
+    LatencyHistogram warm; /**< latencies of requests with an existing connection */
+    mutable std::mutex mutex; /**< guards queue, unfinished, stopped and the histograms */
+    bool stopped; /**< whether the engine was stopped */
+    std::thread thread; /**< the thread of the engine */
+}; // class
+
+#endif // WEATHER_INFORMATION_COLLECTOR_NET_REQUESTENGINE_HPP
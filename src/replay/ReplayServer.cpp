@@ -0,0 +1,283 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector replay server.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "ReplayServer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../net/Replay.hpp"
+#include "../util/Strings.hpp"
+
+namespace wic
+{
+
+namespace
+{
+
+/** \brief maximum size of the header of a request */
+const std::string::size_type maximumHeaderSize = 64 * 1024;
+
+/** \brief Gets the status line and headers of a response.
+ *
+ * \param status         status code and reason, e. g. "200 OK"
+ * \param contentLength  length of the body
+ * \param close          whether the connection is closed after the response
+ * \return Returns the header of the response.
+ */
+std::string responseHeader(const std::string_view status, const std::size_t contentLength, const bool close)
+{
+  std::string header = "HTTP/1.1 ";
+  header.append(status);
+  header.append("\r\nContent-Type: application/json\r\nContent-Length: ");
+  header.append(std::to_string(contentLength));
+  if (close)
+    header.append("\r\nConnection: close");
+  header.append("\r\n\r\n");
+  return header;
+}
+
+} // namespace
+
+ReplayServer::ReplayServer(const std::string& fixtureDirectory, const ReplaySettings& replaySettings)
+: directory(fixtureDirectory),
+  settings(replaySettings),
+  listener(-1),
+  mutex(),
+  fixtures(std::map<std::string, std::optional<std::string> >()),
+  random(std::mt19937(std::random_device()())),
+  requests(0)
+{
+}
+
+ReplayServer::~ReplayServer()
+{
+  if (listener >= 0)
+    ::close(listener);
+}
+
+bool ReplayServer::listen()
+{
+  listener = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (listener < 0)
+  {
+    std::cerr << "Error: Could not create socket!" << std::endl;
+    return false;
+  }
+  const int reuse = 1;
+  ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(settings.port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if ((::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+      || (::listen(listener, SOMAXCONN) != 0))
+  {
+    std::cerr << "Error: Could not listen on port " << settings.port << "!" << std::endl;
+    ::close(listener);
+    listener = -1;
+    return false;
+  }
+  std::cout << "Replay server listens on http://127.0.0.1:" << settings.port
+            << " and serves fixtures from " << directory << "." << std::endl;
+  return true;
+}
+
+void ReplayServer::run()
+{
+  while (listener >= 0)
+  {
+    const int client = ::accept(listener, nullptr, nullptr);
+    if (client < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      std::cerr << "Error: Could not accept connection!" << std::endl;
+      return;
+    }
+    std::thread(&ReplayServer::serve, this, client).detach();
+  }
+}
+
+void ReplayServer::serve(const int client)
+{
+  std::string buffer;
+  char chunk[4096];
+  bool open = true;
+  while (open)
+  {
+    const auto end = buffer.find("\r\n\r\n");
+    if (end == std::string::npos)
+    {
+      if (buffer.size() > maximumHeaderSize)
+        break;
+      const auto received = ::recv(client, chunk, sizeof(chunk), 0);
+      if (received <= 0)
+        break;
+      buffer.append(chunk, static_cast<std::size_t>(received));
+      continue;
+    }
+
+    // Requests of the collector have no body, so the header is everything.
+    std::istringstream header(buffer.substr(0, end));
+    buffer.erase(0, end + 4);
+    std::string method;
+    std::string target;
+    std::string version;
+    header >> method >> target >> version;
+    bool close = (version != "HTTP/1.1");
+    std::string line;
+    while (std::getline(header, line))
+    {
+      line = toLowerString(line);
+      if ((line.find("connection:") == 0) && (line.find("close") != std::string::npos))
+        close = true;
+    }
+
+    if ((method != "GET") && (method != "HEAD"))
+    {
+      const std::string body = "{\"error\": \"method not allowed\"}";
+      send(client, responseHeader("405 Method Not Allowed", body.size(), true) + body, false);
+      break;
+    }
+    open = respond(client, method, target) && !close;
+  } // while
+  ::close(client);
+}
+
+bool ReplayServer::respond(const int client, const std::string& method, const std::string& target)
+{
+  const auto served = ++requests;
+  if (served % 10000 == 0)
+  {
+    std::cout << "Info: " << served << " requests served." << std::endl;
+  }
+
+  bool fail = false;
+  const auto delay = nextResponse(fail);
+  if (delay.count() > 0)
+    std::this_thread::sleep_for(delay);
+
+  std::string status = "200 OK";
+  std::string body;
+  if (fail)
+  {
+    status = "503 Service Unavailable";
+    body = "{\"error\": \"failure caused by the configured error rate\"}";
+  }
+  else
+  {
+    const auto data = fixture(Replay::pattern(target));
+    if (data.has_value())
+    {
+      body = data.value();
+    }
+    else
+    {
+      status = "404 Not Found";
+      body = "{\"error\": \"no fixture for that URL pattern\"}";
+    }
+  }
+
+  if (!send(client, responseHeader(status, body.size(), false), false))
+    return false;
+  if (method == "HEAD")
+    return true;
+  return send(client, body, true);
+}
+
+std::optional<std::string> ReplayServer::fixture(const std::string& pattern)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto iter = fixtures.find(pattern);
+  if (iter != fixtures.end())
+    return iter->second;
+
+  const std::string path = directory + "/" + Replay::fileName(pattern);
+  std::ifstream stream(path, std::ios::in | std::ios::binary);
+  if (!stream.is_open())
+  {
+    std::cout << "Warning: There is no fixture for the URL pattern " << pattern
+              << ". Expected file: " << path << std::endl;
+    fixtures[pattern] = std::nullopt;
+    return std::nullopt;
+  }
+  std::ostringstream content;
+  content << stream.rdbuf();
+  fixtures[pattern] = content.str();
+  return content.str();
+}
+
+std::chrono::milliseconds ReplayServer::nextResponse(bool& fail)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (settings.errorRate > 0)
+  {
+    std::uniform_int_distribution<unsigned int> percent(0, 99);
+    fail = percent(random) < settings.errorRate;
+  }
+  else
+  {
+    fail = false;
+  }
+  if (settings.jitter.count() == 0)
+    return settings.latency;
+  std::uniform_int_distribution<std::chrono::milliseconds::rep> deviation(-settings.jitter.count(), settings.jitter.count());
+  return std::max(std::chrono::milliseconds(0), settings.latency + std::chrono::milliseconds(deviation(random)));
+}
+
+bool ReplayServer::send(const int client, std::string_view data, const bool limit) const
+{
+  const bool throttled = limit && (settings.throughput > 0);
+  // Throttled data is sent in chunks of 1/20 of the throughput.
+  const std::size_t chunkSize = throttled
+      ? static_cast<std::size_t>(std::max<uint_least64_t>(1, settings.throughput / 20))
+      : data.size();
+  const auto start = std::chrono::steady_clock::now();
+  std::size_t sent = 0;
+  while (sent < data.size())
+  {
+    const auto chunk = data.substr(sent, chunkSize);
+    std::size_t chunkSent = 0;
+    while (chunkSent < chunk.size())
+    {
+      const auto result = ::send(client, chunk.data() + chunkSent, chunk.size() - chunkSent, MSG_NOSIGNAL);
+      if (result <= 0)
+        return false;
+      chunkSent += static_cast<std::size_t>(result);
+    }
+    sent += chunkSent;
+    if (throttled && (sent < data.size()))
+    {
+      const auto due = start + std::chrono::microseconds(sent * 1000000 / settings.throughput);
+      std::this_thread::sleep_until(due);
+    }
+  }
+  return true;
+}
+
+} // namespace
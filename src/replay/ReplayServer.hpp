@@ -0,0 +1,142 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector replay server.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_REPLAY_REPLAYSERVER_HPP
+#define WEATHER_INFORMATION_COLLECTOR_REPLAY_REPLAYSERVER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace wic
+{
+
+/** \brief Settings that control how the replay server answers requests. */
+struct ReplaySettings
+{
+  uint16_t port; /**< TCP port on the loopback interface */
+  std::chrono::milliseconds latency; /**< delay before each response */
+  std::chrono::milliseconds jitter; /**< maximum random deviation from the latency */
+  unsigned int errorRate; /**< percentage of requests that fail with status 503 */
+  uint_least64_t throughput; /**< maximum bytes per second per response, zero means unlimited */
+}; // struct
+
+/** \brief Small HTTP server that answers requests of the collector with
+ *         recorded responses.
+ *
+ * The server expects requests that were redirected by the Replay class, i. e.
+ * the first path segment is the host of the original URL. It answers with the
+ * fixture of the URL pattern of the request, see Replay::pattern(), or with
+ * status 404, if there is no fixture for that pattern.
+ */
+class ReplayServer
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param fixtureDirectory  directory that contains the fixture files
+     * \param settings          latency, error rate and throughput of responses
+     */
+    ReplayServer(const std::string& fixtureDirectory, const ReplaySettings& settings);
+
+
+    ReplayServer(const ReplayServer& other) = delete;
+    ReplayServer& operator=(const ReplayServer& other) = delete;
+
+
+    /** \brief Destructor, closes the listening socket.
+     */
+    ~ReplayServer();
+
+
+    /** \brief Opens the listening socket.
+     *
+     * \return Returns true, if the server is ready to accept connections.
+     */
+    bool listen();
+
+
+    /** \brief Accepts connections and serves each of them on its own thread.
+     *         This only returns when accepting connections fails.
+     */
+    void run();
+  private:
+    /** \brief Handles all requests of a connection until it is closed.
+     *
+     * \param client  socket of the connection
+     */
+    void serve(const int client);
+
+
+    /** \brief Sends the response for a single request.
+     *
+     * \param client  socket of the connection
+     * \param method  HTTP method of the request, e. g. "GET"
+     * \param target  request target, e. g. "/api.example.com/v1/data?x=1"
+     * \return Returns true, if the response was sent completely.
+     */
+    bool respond(const int client, const std::string& method, const std::string& target);
+
+
+    /** \brief Gets the fixture for an URL pattern. Fixtures are read from the
+     *         fixture directory on first use and cached afterwards.
+     *
+     * \param pattern  the URL pattern
+     * \return Returns the fixture, if there is one for the pattern.
+     */
+    std::optional<std::string> fixture(const std::string& pattern);
+
+
+    /** \brief Determines the delay and the status of the next response.
+     *
+     * \param fail  will be set to true, if the response shall be an error
+     * \return Returns the delay before the response.
+     */
+    std::chrono::milliseconds nextResponse(bool& fail);
+
+
+    /** \brief Sends data to the client, limited to the configured throughput.
+     *
+     * \param client  socket of the connection
+     * \param data    the data to send
+     * \param limit   whether the throughput limit applies
+     * \return Returns true, if all data was sent.
+     */
+    bool send(const int client, std::string_view data, const bool limit) const;
+
+
+    std::string directory; /**< directory of the fixture files */
+    ReplaySettings settings; /**< latency, error rate and throughput */
+    int listener; /**< listening socket, -1 if not open */
+    std::mutex mutex; /**< protects fixtures and random */
+    std::map<std::string, std::optional<std::string> > fixtures; /**< cached fixtures by URL pattern */
+    std::mt19937 random; /**< random number generator for jitter and errors */
+    std::atomic<uint_least64_t> requests; /**< number of served requests */
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_REPLAY_REPLAYSERVER_HPP
@@ -0,0 +1,188 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector replay server.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include "../net/Replay.hpp"
+#include "../util/Strings.hpp"
+#include "../ReturnCodes.hpp"
+#include "../Version.hpp"
+#include "ReplayServer.hpp"
+
+void showHelp()
+{
+  std::cout << "weather-information-collector-replay [OPTIONS]\n"
+            << "\n"
+            << "Serves recorded API responses to weather-information-collector for\n"
+            << "load tests without access to the weather APIs.\n"
+            << "\n"
+            << "options:\n"
+            << "  -? | --help            - Shows this help message.\n"
+            << "  -v | --version         - Shows version information.\n"
+            << "  --fixtures DIR         - Sets the directory that contains the fixtures which\n"
+            << "                           were recorded with weather-information-collector\n"
+            << "                           --record DIR. This option is required.\n"
+            << "  --port N               - Sets the TCP port on 127.0.0.1 where the server\n"
+            << "                           listens. Defaults to 8080.\n"
+            << "  --latency MS           - Delays every response by MS milliseconds.\n"
+            << "                           Defaults to zero.\n"
+            << "  --jitter MS            - Varies the delay of each response randomly by up\n"
+            << "                           to MS milliseconds. Defaults to zero.\n"
+            << "  --error-rate PERCENT   - Lets PERCENT percent of the requests fail with HTTP\n"
+            << "                           status code 503. Defaults to zero.\n"
+            << "  --throughput BYTES     - Limits the transfer of each response body to BYTES\n"
+            << "                           bytes per second. Defaults to zero, which means\n"
+            << "                           no limit.\n";
+}
+
+/** \brief Parses the numeric value of a parameter.
+ *
+ * \param argc     number of command line arguments
+ * \param argv     command line arguments
+ * \param i        index of the parameter, will be advanced to the value
+ * \param minimum  minimum allowed value
+ * \param maximum  maximum allowed value
+ * \param value    will be set to the value of the parameter
+ * \return Returns true, if a valid value was given.
+ */
+bool parseNumber(const int argc, char** argv, int& i, const int minimum, const int maximum, int& value)
+{
+  const std::string param(argv[i]);
+  if ((i+1 >= argc) || (argv[i+1] == nullptr))
+  {
+    std::cerr << "Error: You have to enter a number after \"" << param << "\".\n";
+    return false;
+  }
+  ++i;
+  if (!wic::stringToInt(argv[i], value) || (value < minimum) || (value > maximum))
+  {
+    std::cerr << "Error: The value after \"" << param << "\" has to be a number"
+              << " between " << minimum << " and " << maximum << ".\n";
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  std::string fixtureDirectory; /**< directory that contains the fixtures */
+  int port = -1;
+  int latency = -1;
+  int jitter = -1;
+  int errorRate = -1;
+  int throughput = -1;
+
+  if ((argc > 1) && (argv != nullptr))
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      if (argv[i] == nullptr)
+      {
+        std::cerr << "Error: Parameter at index " << i << " is null pointer!\n";
+        return wic::rcInvalidParameter;
+      }
+      const std::string param(argv[i]);
+      if ((param == "-v") || (param == "--version"))
+      {
+        wic::showVersion("weather-information-collector-replay");
+        wic::showLicenseInformation();
+        return 0;
+      } // if version
+      else if ((param == "-?") || (param == "/?") || (param == "--help"))
+      {
+        showHelp();
+        return 0;
+      } // if help
+      else if (param == "--fixtures")
+      {
+        if (!fixtureDirectory.empty())
+        {
+          std::cerr << "Error: Fixture directory was already set to "
+                    << fixtureDirectory << "!\n";
+          return wic::rcInvalidParameter;
+        }
+        // enough parameters?
+        if ((i+1 < argc) && (argv[i+1] != nullptr) && (argv[i+1][0] != '\0'))
+        {
+          fixtureDirectory = std::string(argv[i+1]);
+          // Skip next parameter, because it's already used as directory.
+          ++i;
+        }
+        else
+        {
+          std::cerr << "Error: You have to enter a directory after \""
+                    << param << "\".\n";
+          return wic::rcInvalidParameter;
+        }
+      } // if fixture directory
+      else if ((param == "--port") || (param == "--latency") || (param == "--jitter")
+               || (param == "--error-rate") || (param == "--throughput"))
+      {
+        int& value = (param == "--port") ? port
+                   : (param == "--latency") ? latency
+                   : (param == "--jitter") ? jitter
+                   : (param == "--error-rate") ? errorRate : throughput;
+        if (value >= 0)
+        {
+          std::cerr << "Error: Parameter " << param << " was already specified!\n";
+          return wic::rcInvalidParameter;
+        }
+        const int maximum = (param == "--port") ? 65535
+                          : (param == "--error-rate") ? 100
+                          : (param == "--throughput") ? 1000000000 : 600000;
+        if (!parseNumber(argc, argv, i, (param == "--port") ? 1 : 0, maximum, value))
+          return wic::rcInvalidParameter;
+      } // if numeric setting
+      else
+      {
+        std::cerr << "Error: Unknown parameter " << param << "!\n"
+                  << "Use --help to show available parameters.\n";
+        return wic::rcInvalidParameter;
+      }
+    } // for i
+  } // if arguments are there
+
+  if (fixtureDirectory.empty())
+  {
+    std::cerr << "Error: No fixture directory was given. Use --fixtures DIR to set it.\n";
+    return wic::rcInvalidParameter;
+  }
+  std::error_code error;
+  if (!std::filesystem::is_directory(fixtureDirectory, error))
+  {
+    std::cerr << "Error: The fixture directory " << fixtureDirectory
+              << " does not exist!\n";
+    return wic::rcInputOutputError;
+  }
+
+  const wic::ReplaySettings settings{
+      static_cast<uint16_t>(port >= 0 ? port : 8080),
+      std::chrono::milliseconds(std::max(latency, 0)),
+      std::chrono::milliseconds(std::max(jitter, 0)),
+      static_cast<unsigned int>(std::max(errorRate, 0)),
+      static_cast<uint_least64_t>(std::max(throughput, 0))
+  };
+  wic::ReplayServer server(fixtureDirectory, settings);
+  if (!server.listen())
+    return wic::rcInputOutputError;
+  server.run();
+  return wic::rcInputOutputError;
+}
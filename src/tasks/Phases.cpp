@@ -0,0 +1,170 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Phases.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <tuple>
+
+namespace wic
+{
+
+const std::chrono::seconds Phases::minimumReportSpan = std::chrono::seconds(3600);
+
+uint_least64_t Phases::hash(const Task& task)
+{
+  // FNV-1a, because std::hash is not guaranteed to give the same result on
+  // different platforms or in different runs.
+  const std::string key = toString(task.api()) + "|" + toString(task.data())
+                        + "|" + task.location().toString();
+  uint_least64_t h = 14695981039346656037ULL;
+  for (const char c : key)
+  {
+    h ^= static_cast<unsigned char>(c);
+    h = (h * 1099511628211ULL) & 0xFFFFFFFFFFFFFFFFULL;
+  }
+  return h;
+}
+
+std::vector<std::chrono::seconds> Phases::offsets(const std::vector<Task>& tasks)
+{
+  std::vector<std::chrono::seconds> result(tasks.size(), std::chrono::seconds::zero());
+
+  // group tasks by interval and API
+  std::map<std::chrono::seconds, std::map<ApiType, std::vector<std::size_t>>> groups;
+  for (std::size_t i = 0; i < tasks.size(); ++i)
+  {
+    if (tasks[i].interval() > std::chrono::seconds::zero())
+      groups[tasks[i].interval()][tasks[i].api()].push_back(i);
+  }
+
+  const int_least64_t groupCount = static_cast<int_least64_t>(groups.size());
+  int_least64_t groupIndex = 0;
+  for (const auto& [interval, apis] : groups)
+  {
+    // Each task gets a position in [0;1) within the interval. The tasks of an
+    // API are spread evenly, and tasks with the same position are ordered by
+    // their hash.
+    std::vector<std::tuple<double, uint_least64_t, std::size_t>> positions;
+    for (const auto& [api, indices] : apis)
+    {
+      std::vector<std::pair<uint_least64_t, std::size_t>> ordered;
+      for (const std::size_t idx : indices)
+      {
+        ordered.emplace_back(hash(tasks[idx]), idx);
+      }
+      std::sort(ordered.begin(), ordered.end());
+      const double count = static_cast<double>(ordered.size());
+      for (std::size_t j = 0; j < ordered.size(); ++j)
+      {
+        positions.emplace_back((j + 0.5) / count, ordered[j].first, ordered[j].second);
+      }
+    } // for APIs
+    std::sort(positions.begin(), positions.end());
+
+    // Slots are evenly spaced within the interval, and each group is shifted
+    // by a fraction of a slot to avoid collisions with other groups.
+    const int_least64_t n = static_cast<int_least64_t>(positions.size());
+    for (int_least64_t k = 0; k < n; ++k)
+    {
+      const int_least64_t offset = ((k * groupCount + groupIndex) * interval.count()) / (n * groupCount);
+      result[std::get<2>(positions[k])] = std::chrono::seconds(offset);
+    }
+    ++groupIndex;
+  } // for groups
+
+  return result;
+}
+
+std::vector<RequestRate> Phases::rates(const std::vector<Task>& tasks, const std::vector<std::chrono::seconds>& offsets)
+{
+  // Simulate at least one full interval of every task.
+  std::chrono::seconds span = minimumReportSpan;
+  for (const Task& t : tasks)
+  {
+    span = std::max(span, t.interval());
+  }
+  const auto length = static_cast<std::size_t>(span.count());
+
+  std::map<ApiType, RequestRate> data;
+  std::map<ApiType, std::vector<uint_least32_t>> staggered;
+  std::map<ApiType, std::vector<uint_least32_t>> unstaggered;
+  for (std::size_t i = 0; i < tasks.size(); ++i)
+  {
+    const Task& t = tasks[i];
+    auto [iter, inserted] = data.try_emplace(t.api(), RequestRate{ t.api(), 0, 0.0, 0, 0 });
+    if (inserted)
+    {
+      staggered[t.api()].assign(length, 0);
+      unstaggered[t.api()].assign(length, 0);
+    }
+    ++iter->second.tasks;
+    if (t.interval() <= std::chrono::seconds::zero())
+      continue;
+    iter->second.average += 1.0 / t.interval().count();
+
+    const auto step = static_cast<std::size_t>(t.interval().count());
+    const auto offset = (i < offsets.size()) ? static_cast<std::size_t>(offsets[i].count()) : 0;
+    auto& counts = staggered[t.api()];
+    for (std::size_t second = offset; second < length; second += step)
+    {
+      ++counts[second];
+    }
+    auto& countsUnstaggered = unstaggered[t.api()];
+    for (std::size_t second = 0; second < length; second += step)
+    {
+      ++countsUnstaggered[second];
+    }
+  } // for i
+
+  std::vector<RequestRate> result;
+  for (auto& [api, rate] : data)
+  {
+    rate.peak = *std::max_element(staggered[api].begin(), staggered[api].end());
+    rate.unstaggeredPeak = *std::max_element(unstaggered[api].begin(), unstaggered[api].end());
+    result.push_back(rate);
+  }
+  return result;
+}
+
+void Phases::showRates(const std::vector<RequestRate>& rates)
+{
+  if (rates.empty())
+    return;
+
+  std::cout << "Info: Request rates of the configured tasks per API:\n";
+  const auto flags = std::cout.flags();
+  const auto precision = std::cout.precision();
+  std::cout << std::fixed << std::setprecision(3);
+  for (const auto& rate : rates)
+  {
+    std::cout << "    " << toString(rate.api) << ": " << rate.tasks
+              << " task(s), " << rate.average << " requests per second on "
+              << "average, at most " << rate.peak << " request(s) within one "
+              << "second (" << rate.unstaggeredPeak << " without staggered "
+              << "start)\n";
+  }
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+}
+
+} // namespace
@@ -0,0 +1,99 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef WEATHER_INFORMATION_COLLECTOR_PHASES_HPP
+#define WEATHER_INFORMATION_COLLECTOR_PHASES_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "Task.hpp"
+
+namespace wic
+{
+
+/** \brief Resulting request rate of the tasks of a single API. */
+struct RequestRate
+{
+  ApiType api; /**< the API */
+  std::size_t tasks; /**< number of tasks for the API */
+  double average; /**< average number of requests per second */
+  uint_least32_t peak; /**< highest number of requests within one second */
+  uint_least32_t unstaggeredPeak; /**< highest number of requests within one second, if all tasks start at once */
+}; // struct
+
+/**
+ * Assigns start phases to tasks, so that their requests are spread over time
+ * instead of all happening at the same instant.
+ *
+ * Tasks with the same interval form a group, and the tasks of a group get
+ * offsets that are evenly spaced within the interval. The tasks of each API
+ * are spread evenly over the interval, too, so that no API gets a burst of
+ * requests. The order of tasks within an API is determined by a hash of the
+ * task's location, API and data type, so the assignment is deterministic and
+ * does not change when tasks are reordered in the configuration. Different
+ * groups are shifted against each other, so that their first slots do not
+ * coincide either.
+ */
+class Phases
+{
+  public:
+    /** \brief The minimum time span that is simulated for the request rate
+     *         report.
+     */
+    static const std::chrono::seconds minimumReportSpan;
+
+
+    /** \brief Gets the start offsets for a list of tasks.
+     *
+     * \param tasks  the tasks
+     * \return Returns a vector with one offset per task, in the same order as
+     *         the tasks. Each offset is less than the interval of its task.
+     */
+    static std::vector<std::chrono::seconds> offsets(const std::vector<Task>& tasks);
+
+
+    /** \brief Calculates the request rates per API for the given offsets.
+     *
+     * \param tasks    the tasks
+     * \param offsets  start offsets of the tasks, as returned by offsets()
+     * \return Returns the request rates, ordered by API.
+     */
+    static std::vector<RequestRate> rates(const std::vector<Task>& tasks,
+                                          const std::vector<std::chrono::seconds>& offsets);
+
+
+    /** \brief Shows request rates on the standard output.
+     *
+     * \param rates  the request rates, as returned by rates()
+     */
+    static void showRates(const std::vector<RequestRate>& rates);
+  private:
+    /** \brief Calculates a hash of the task's location, API and data type.
+     *
+     * \param task  the task
+     * \return Returns the hash value.
+     */
+    static uint_least64_t hash(const Task& task);
+}; // class
+
+} // namespace
+
+#endif // WEATHER_INFORMATION_COLLECTOR_PHASES_HPP
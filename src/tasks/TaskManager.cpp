@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022, 2023  Dirk Stolle
+    Copyright (C) 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -24,6 +24,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <tuple>
 #include "../api/Factory.hpp"
 #include "../api/Limits.hpp"
 #include "../util/Strings.hpp"
@@ -434,6 +435,67 @@ bool TaskManager::hasDuplicates(const std::vector<Task>& tasks, const bool silen
   return false;
 }
 
+std::size_t TaskManager::coalesce(std::vector<Task>& tasks, const PlanWeatherbit planWb, const PlanWeatherstack planWs)
+{
+  // Current weather tasks are grouped by API, interval and location, so that
+  // the search for a matching forecast task does not need to look at all
+  // other tasks.
+  std::map<std::tuple<ApiType, std::chrono::seconds, std::string>, std::vector<std::size_t>> current;
+  std::map<ApiType, bool> canCombine;
+  for (std::size_t i = 0; i < tasks.size(); ++i)
+  {
+    const Task& t = tasks[i];
+    if (t.data() != DataType::Current)
+      continue;
+    auto iter = canCombine.find(t.api());
+    if (iter == canCombine.end())
+    {
+      const auto api = Factory::create(t.api(), planWb, planWs);
+      iter = canCombine.emplace(t.api(), api && api->combinedDataInOneRequest()).first;
+    }
+    if (iter->second)
+      current[std::make_tuple(t.api(), t.interval(), t.location().toString())].push_back(i);
+  } // for i
+
+  std::vector<bool> merged(tasks.size(), false);
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < tasks.size(); ++i)
+  {
+    const Task& t = tasks[i];
+    if (t.data() != DataType::Forecast)
+      continue;
+    const auto iter = current.find(std::make_tuple(t.api(), t.interval(), t.location().toString()));
+    if (iter == current.end())
+      continue;
+    for (const std::size_t idx : iter->second)
+    {
+      if (!merged[idx] && (tasks[idx].location() == t.location()))
+      {
+        tasks[idx].setData(DataType::CurrentAndForecast);
+        merged[idx] = true;
+        merged[i] = true;
+        ++count;
+        break;
+      }
+    } // for idx
+  } // for i
+
+  if (count == 0)
+    return 0;
+  // Remove the forecast tasks that are now part of a merged task.
+  std::size_t next = 0;
+  for (std::size_t i = 0; i < tasks.size(); ++i)
+  {
+    if (merged[i] && (tasks[i].data() == DataType::Forecast))
+      continue;
+    if (next != i)
+      tasks[next] = tasks[i];
+    ++next;
+  }
+  tasks.resize(next);
+  return count;
+}
+
 bool TaskManager::withinLimits(const std::vector<Task>& tasks, const PlanOwm planOwm, const PlanWeatherbit planWb,
                                const PlanWeatherstack planWs, const bool silent)
 {
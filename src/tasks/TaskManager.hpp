@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector.
-    Copyright (C) 2017, 2018, 2020  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -77,6 +77,24 @@ class TaskManager
     static bool hasDuplicates(const std::vector<Task>& tasks, const bool silent);
 
 
+    /** \brief Merges pairs of tasks for current weather and forecast data into
+     *         a single task that requests both at once.
+     *
+     * Two tasks are merged, if they use the same API and location, if one of
+     * them requests the current weather and the other one the forecast, if
+     * both have the same interval, and if the API returns both kinds of data
+     * with a single request (see API::combinedDataInOneRequest()). The merged
+     * task takes the place of the task for the current weather, the forecast
+     * task is removed.
+     *
+     * \param tasks   vector of tasks, will be modified
+     * \param planWb  the pricing plan for Weatherbit
+     * \param planWs  the pricing plan for Weatherstack
+     * \return Returns the number of merged pairs of tasks.
+     */
+    static std::size_t coalesce(std::vector<Task>& tasks, const PlanWeatherbit planWb, const PlanWeatherstack planWs);
+
+
     /** \brief Checks whether the tasks can be executed within API request limits.
      *
      * \param tasks   vector of tasks
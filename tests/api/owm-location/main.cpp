@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the weather information collector test suite.
-    Copyright (C) 2019, 2020  Dirk Stolle
+    Copyright (C) 2019, 2020, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,7 +23,7 @@
 #include "location.hpp"
 #include "../../../src/json/NLohmannJsonOwm.hpp"
 #ifdef __SIZEOF_INT128__
-#include "../../../src/json/SimdJsonOwm.hpp"
+#include "../../../src/json/SimdJsonOnDemandOwm.hpp"
 #endif
 
 int main(int argc, char** argv)
@@ -57,7 +57,7 @@ int main(int argc, char** argv)
 
   #ifdef __SIZEOF_INT128__
   std::cout << "Parsing with simdjson ..." << std::endl;
-  int ret = parseLocations<SimdJsonOwm>(json);
+  int ret = parseLocations<SimdJsonOnDemandOwm>(json);
   if (ret != 0)
     return ret;
   #else
@@ -1,6 +1,6 @@
 :: Script to test executable when parameters are used in the wrong way.
 ::
-::  Copyright (C) 2022  Dirk Stolle
+::  Copyright (C) 2022, 2025  Dirk Stolle
 ::
 ::  This program is free software: you can redistribute it and/or modify
 ::  it under the terms of the GNU Lesser General Public License as published by
@@ -53,6 +53,41 @@ if %ERRORLEVEL% NEQ 1 (
   exit /B 1
 )
 
+:: no directory after parameter --record
+"%EXECUTABLE%" --record
+if %ERRORLEVEL% NEQ 1 (
+  echo Executable did not exit with code 1 when --record had no directory.
+  exit /B 1
+)
+
+:: fixture directory does not exist
+"%EXECUTABLE%" --record this-directory-is-missing
+if %ERRORLEVEL% NEQ 1 (
+  echo Executable did not exit with code 1 when --record got a missing directory.
+  exit /B 1
+)
+
+:: no URL after parameter --redirect
+"%EXECUTABLE%" --redirect
+if %ERRORLEVEL% NEQ 1 (
+  echo Executable did not exit with code 1 when --redirect had no URL.
+  exit /B 1
+)
+
+:: URL of replay server is not an HTTP URL
+"%EXECUTABLE%" --redirect 127.0.0.1:8080
+if %ERRORLEVEL% NEQ 1 (
+  echo Executable did not exit with code 1 when --redirect got no HTTP URL.
+  exit /B 1
+)
+
+:: --record and --redirect are combined
+"%EXECUTABLE%" --record . --redirect http://127.0.0.1:8080
+if %ERRORLEVEL% NEQ 1 (
+  echo Executable did not exit with code 1 when --record and --redirect were combined.
+  exit /B 1
+)
+
 :: unknown parameter
 "%EXECUTABLE%" --this-is-not-supported
 if %ERRORLEVEL% NEQ 1 (
@@ -2,7 +2,7 @@
 
 # Script to test executable when parameters are used in the wrong way.
 #
-#  Copyright (C) 2022  Dirk Stolle
+#  Copyright (C) 2022, 2025  Dirk Stolle
 #
 #  This program is free software: you can redistribute it and/or modify
 #  it under the terms of the GNU Lesser General Public License as published by
@@ -58,6 +58,46 @@ then
   exit 1
 fi
 
+# no directory after parameter --record
+"$EXECUTABLE" --record
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --record had no directory."
+  exit 1
+fi
+
+# fixture directory does not exist
+"$EXECUTABLE" --record this-directory-is-missing
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --record got a missing directory."
+  exit 1
+fi
+
+# no URL after parameter --redirect
+"$EXECUTABLE" --redirect
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --redirect had no URL."
+  exit 1
+fi
+
+# URL of replay server is not an HTTP URL
+"$EXECUTABLE" --redirect 127.0.0.1:8080
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --redirect got no HTTP URL."
+  exit 1
+fi
+
+# --record and --redirect are combined
+"$EXECUTABLE" --record . --redirect http://127.0.0.1:8080
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --record and --redirect were combined."
+  exit 1
+fi
+
 # unknown parameter
 "$EXECUTABLE" --this-is-not-supported
 if [ $? -ne 1 ]
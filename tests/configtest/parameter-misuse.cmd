@@ -1,6 +1,6 @@
 :: Script to test executable when parameters are used in the wrong way.
 ::
-::  Copyright (C) 2022  Dirk Stolle
+::  Copyright (C) 2022, 2025  Dirk Stolle
 ::
 ::  This program is free software: you can redistribute it and/or modify
 ::  it under the terms of the GNU Lesser General Public License as published by
@@ -46,6 +46,13 @@ if %ERRORLEVEL% NEQ 1 (
   exit /B 1
 )
 
+:: --request-rates is given twice
+"%EXECUTABLE%" --request-rates --request-rates
+if %ERRORLEVEL% NEQ 1 (
+  echo Executable did not exit with code 1 when --request-rates was given twice.
+  exit /B 1
+)
+
 :: unknown parameter
 "%EXECUTABLE%" --this-is-not-supported
 if %ERRORLEVEL% NEQ 1 (
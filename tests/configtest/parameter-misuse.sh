@@ -2,7 +2,7 @@
 
 # Script to test executable when parameters are used in the wrong way.
 #
-#  Copyright (C) 2022  Dirk Stolle
+#  Copyright (C) 2022, 2025  Dirk Stolle
 #
 #  This program is free software: you can redistribute it and/or modify
 #  it under the terms of the GNU Lesser General Public License as published by
@@ -50,6 +50,14 @@ then
   exit 1
 fi
 
+# --request-rates is given twice
+"$EXECUTABLE" --request-rates --request-rates
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --request-rates was given twice."
+  exit 1
+fi
+
 # unknown parameter
 "$EXECUTABLE" --this-is-not-supported
 if [ $? -ne 1 ]
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2020, 2021, 2022  Dirk Stolle
+    Copyright (C) 2020, 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -94,6 +94,44 @@ TEST_CASE("StoreMariaDBBatch tests")
       REQUIRE( source.getCurrentWeather(ApiType::OpenWeatherMap, Staplehurst, weather) );
       REQUIRE( weather.size() == beforeInsert + count - 1 );
     }
+
+    SECTION("storing forecast data in a transaction")
+    {
+      const auto Tiksi = CiData::getTiksi();
+      const auto forecast = CiData::sampleForecastDresden();
+
+      SourceMariaDB source(connInfo);
+      std::vector<Forecast> forecasts;
+      REQUIRE( source.getForecasts(ApiType::OpenWeatherMap, Tiksi, forecasts) );
+      const auto beforeInsert = forecasts.size();
+
+      {
+        StoreMariaDBBatch store(connInfo, 5);
+        const auto apiId = store.apiId(ApiType::OpenWeatherMap);
+        REQUIRE( apiId > 0 );
+        const auto tiksiId = store.locationId(Tiksi);
+        REQUIRE( tiksiId > 0 );
+        // Ids are cached.
+        REQUIRE( store.locationId(Tiksi) == tiksiId );
+
+        // Rolled back data does not show up.
+        REQUIRE( store.beginTransaction() );
+        REQUIRE( store.saveForecast(apiId, tiksiId, forecast) );
+        store.rollback();
+        REQUIRE( source.getForecasts(ApiType::OpenWeatherMap, Tiksi, forecasts) );
+        REQUIRE( forecasts.size() == beforeInsert );
+
+        // Committed data does.
+        REQUIRE( store.beginTransaction() );
+        REQUIRE( store.saveForecast(apiId, store.locationId(Tiksi), forecast) );
+        REQUIRE( store.saveForecast(apiId, store.locationId(Tiksi), forecast) );
+        REQUIRE( store.commit() );
+      }
+
+      REQUIRE( source.getForecasts(ApiType::OpenWeatherMap, Tiksi, forecasts) );
+      REQUIRE( forecasts.size() == beforeInsert + 2 );
+      REQUIRE( forecasts.back().data().size() == forecast.data().size() );
+    }
   }
   else
   {
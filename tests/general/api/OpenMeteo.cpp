@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -100,4 +100,80 @@ TEST_CASE("OpenMeteo - non-network tests")
       REQUIRE( OpenMeteo::toRequestString(location) == "latitude=12.34&longitude=56.78" );
     }
   }
+
+  SECTION("toRequestString with several locations")
+  {
+    std::vector<Location> locations;
+
+    SECTION("no locations")
+    {
+      REQUIRE( OpenMeteo::toRequestString(locations).empty() );
+    }
+
+    SECTION("one location without coordinates")
+    {
+      Location first;
+      first.setCoordinates(12.34f, 56.78f);
+      Location second;
+      second.setName("Some City");
+      locations.push_back(first);
+      locations.push_back(second);
+      REQUIRE( OpenMeteo::toRequestString(locations).empty() );
+    }
+
+    SECTION("several locations")
+    {
+      Location first;
+      first.setCoordinates(12.34f, 56.78f);
+      Location second;
+      second.setCoordinates(-1.5f, 2.25f);
+      Location third;
+      third.setCoordinates(50.0f, -7.75f);
+      locations = { first, second, third };
+      REQUIRE( OpenMeteo::toRequestString(locations) == "latitude=12.34,-1.5,50&longitude=56.78,2.25,-7.75" );
+    }
+  }
+
+  SECTION("singleRequestUrl")
+  {
+    Location location;
+    location.setCoordinates(12.34f, 56.78f);
+    std::string url;
+
+    REQUIRE( api.singleRequestUrl(DataType::Current, location, url) );
+    REQUIRE( url == "https://api.open-meteo.com/v1/forecast?latitude=12.34&longitude=56.78&current_weather=true&windspeed_unit=ms&timezone=auto" );
+    REQUIRE( api.singleRequestUrl(DataType::Forecast, location, url) );
+    REQUIRE( url == "https://api.open-meteo.com/v1/forecast?latitude=12.34&longitude=56.78&hourly=temperature_2m,relativehumidity_2m,precipitation,rain,showers,snowfall,pressure_msl,surface_pressure,cloudcover,windspeed_10m,winddirection_10m&windspeed_unit=ms&timezone=auto" );
+    REQUIRE( api.singleRequestUrl(DataType::CurrentAndForecast, location, url) );
+    REQUIRE( url == "https://api.open-meteo.com/v1/forecast?latitude=12.34&longitude=56.78&current_weather=true&hourly=temperature_2m,relativehumidity_2m,precipitation,rain,showers,snowfall,pressure_msl,surface_pressure,cloudcover,windspeed_10m,winddirection_10m&windspeed_unit=ms&timezone=auto" );
+    REQUIRE_FALSE( api.singleRequestUrl(DataType::none, location, url) );
+  }
+
+  SECTION("setUnixTime")
+  {
+    Location location;
+    location.setCoordinates(12.34f, 56.78f);
+    std::string url;
+
+    REQUIRE( api.singleRequestUrl(DataType::Forecast, location, url) );
+    REQUIRE( url.find("timeformat") == std::string::npos );
+
+    api.setUnixTime(true);
+    REQUIRE( api.singleRequestUrl(DataType::Forecast, location, url) );
+    REQUIRE( url.find("&timeformat=unixtime") != std::string::npos );
+    REQUIRE( api.singleRequestUrl(DataType::CurrentAndForecast, location, url) );
+    REQUIRE( url.find("&timeformat=unixtime") != std::string::npos );
+
+    api.setUnixTime(false);
+    REQUIRE( api.singleRequestUrl(DataType::Forecast, location, url) );
+    REQUIRE( url.find("timeformat") == std::string::npos );
+  }
+
+  SECTION("maximumBatchSize")
+  {
+    REQUIRE( api.maximumBatchSize(DataType::Current) == OpenMeteo::maximumLocationsPerRequest );
+    REQUIRE( api.maximumBatchSize(DataType::Forecast) == OpenMeteo::maximumLocationsPerRequest );
+    REQUIRE( api.maximumBatchSize(DataType::CurrentAndForecast) == OpenMeteo::maximumLocationsPerRequest );
+    REQUIRE( OpenMeteo::maximumLocationsPerRequest > 1 );
+  }
 }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "../../find_catch.hpp"
+#include <vector>
 #include "../../../src/api/OpenWeatherMap.hpp"
 
 TEST_CASE("OpenWeatherMap - non-network tests")
@@ -159,4 +160,67 @@ TEST_CASE("OpenWeatherMap - non-network tests")
       REQUIRE_FALSE( api.currentAndForecastWeather(location, w, fc) );
     }
   }
+
+  SECTION("toRequestString with several locations")
+  {
+    std::vector<Location> locations;
+
+    SECTION("no locations")
+    {
+      REQUIRE( OpenWeatherMap::toRequestString(locations).empty() );
+    }
+
+    SECTION("one location without OpenWeatherMap id")
+    {
+      Location first;
+      first.setOwmId(2935022);
+      Location second;
+      second.setCoordinates(12.34f, 56.78f);
+      locations = { first, second };
+      REQUIRE( OpenWeatherMap::toRequestString(locations).empty() );
+    }
+
+    SECTION("several locations")
+    {
+      Location first;
+      first.setOwmId(2935022);
+      Location second;
+      second.setOwmId(2950159);
+      Location third;
+      third.setOwmId(12345);
+      locations = { first, second, third };
+      REQUIRE( OpenWeatherMap::toRequestString(locations) == "id=2935022,2950159,12345" );
+    }
+  }
+
+  SECTION("maximumBatchSize")
+  {
+    REQUIRE( api.maximumBatchSize(DataType::Current) == OpenWeatherMap::maximumLocationsPerRequest );
+    REQUIRE( api.maximumBatchSize(DataType::Forecast) == 1 );
+    REQUIRE( OpenWeatherMap::maximumLocationsPerRequest == 20 );
+  }
+
+  SECTION("validBatchLocation")
+  {
+    Location location;
+    location.setCoordinates(12.34f, 56.78f);
+    REQUIRE_FALSE( api.validBatchLocation(location) );
+    location.setOwmId(2935022);
+    REQUIRE( api.validBatchLocation(location) );
+  }
+
+  SECTION("currentWeatherBatch")
+  {
+    Location location;
+    location.setOwmId(2935022);
+    std::vector<Location> locations = { location, location };
+
+    SECTION("request with empty API key fails")
+    {
+      api.setApiKey("");
+      std::vector<Weather> weather;
+      REQUIRE_FALSE( api.currentWeatherBatch(locations, weather) );
+      REQUIRE( weather.empty() );
+    }
+  }
 }
@@ -0,0 +1,105 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <deque>
+#include "../../../src/api/RateLimiter.hpp"
+
+TEST_CASE("RateLimiter")
+{
+  using namespace wic;
+  using namespace std::chrono_literals;
+  const auto start = std::chrono::steady_clock::now();
+
+  SECTION("requests within limit are granted")
+  {
+    // free plan of OpenWeatherMap: 60 requests per minute
+    RateLimiter limiter(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    std::chrono::steady_clock::time_point availableAt;
+    for (int i = 0; i < 60; ++i)
+    {
+      REQUIRE( limiter.tryAcquire(ApiType::OpenWeatherMap, start, availableAt) );
+    }
+    REQUIRE_FALSE( limiter.tryAcquire(ApiType::OpenWeatherMap, start, availableAt) );
+    REQUIRE( availableAt > start );
+    REQUIRE( availableAt <= start + 61s );
+    // Other APIs are not affected.
+    REQUIRE( limiter.tryAcquire(ApiType::OpenMeteo, start, availableAt) );
+  }
+
+  SECTION("requests are possible again at availableAt")
+  {
+    // free plan of Weatherbit: 50 requests per day
+    RateLimiter limiter(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    std::chrono::steady_clock::time_point availableAt;
+    for (int i = 0; i < 50; ++i)
+    {
+      REQUIRE( limiter.tryAcquire(ApiType::Weatherbit, start + i * 1min, availableAt) );
+    }
+    REQUIRE_FALSE( limiter.tryAcquire(ApiType::Weatherbit, start + 2h, availableAt) );
+    const auto firstAvailable = availableAt;
+    REQUIRE( firstAvailable >= start + 24h );
+    REQUIRE( firstAvailable <= start + 24h + 3min );
+    REQUIRE_FALSE( limiter.tryAcquire(ApiType::Weatherbit, firstAvailable - 1s, availableAt) );
+    REQUIRE( limiter.tryAcquire(ApiType::Weatherbit, firstAvailable, availableAt) );
+  }
+
+  SECTION("limit is never exceeded within the time span")
+  {
+    RateLimiter limiter(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    std::deque<std::chrono::steady_clock::time_point> granted;
+    std::chrono::steady_clock::time_point availableAt;
+    auto now = start;
+    for (int i = 0; i < 5000; ++i)
+    {
+      if (limiter.tryAcquire(ApiType::OpenWeatherMap, now, availableAt))
+      {
+        granted.push_back(now);
+        while (granted.front() <= now - 60s)
+        {
+          granted.pop_front();
+        }
+        REQUIRE( granted.size() <= 60 );
+      }
+      now += 250ms;
+    }
+    // Roughly 60 requests per minute should have been granted.
+    REQUIRE( granted.size() >= 55 );
+  }
+
+  SECTION("API without known limit is not limited")
+  {
+    RateLimiter limiter(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    std::chrono::steady_clock::time_point availableAt;
+    for (int i = 0; i < 10000; ++i)
+    {
+      REQUIRE( limiter.tryAcquire(ApiType::none, start, availableAt) );
+    }
+  }
+
+  SECTION("several requests at once")
+  {
+    RateLimiter limiter(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    std::chrono::steady_clock::time_point availableAt;
+    REQUIRE( limiter.tryAcquire(ApiType::OpenWeatherMap, start, availableAt, 50) );
+    REQUIRE_FALSE( limiter.tryAcquire(ApiType::OpenWeatherMap, start, availableAt, 11) );
+    REQUIRE( limiter.tryAcquire(ApiType::OpenWeatherMap, start, availableAt, 10) );
+  }
+}
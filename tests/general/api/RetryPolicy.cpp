@@ -0,0 +1,150 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include "../../../src/api/RetryPolicy.hpp"
+
+TEST_CASE("RetryPolicy")
+{
+  using namespace wic;
+  using namespace std::chrono_literals;
+  const auto start = std::chrono::steady_clock::now();
+
+  SECTION("isRetryable")
+  {
+    REQUIRE( RetryPolicy::isRetryable(0) );
+    REQUIRE( RetryPolicy::isRetryable(429) );
+    REQUIRE( RetryPolicy::isRetryable(500) );
+    REQUIRE( RetryPolicy::isRetryable(503) );
+
+    REQUIRE_FALSE( RetryPolicy::isRetryable(200) );
+    REQUIRE_FALSE( RetryPolicy::isRetryable(401) );
+    REQUIRE_FALSE( RetryPolicy::isRetryable(404) );
+  }
+
+  SECTION("parseRetryAfter")
+  {
+    // Wed, 21 Oct 2015 07:28:00 GMT
+    const std::chrono::system_clock::time_point date(std::chrono::seconds(1445412480));
+
+    SECTION("delay in seconds")
+    {
+      REQUIRE( RetryPolicy::parseRetryAfter("120", date) == 120s );
+      REQUIRE( RetryPolicy::parseRetryAfter(" 5 ", date) == 5s );
+      REQUIRE( RetryPolicy::parseRetryAfter("0", date) == 0s );
+    }
+
+    SECTION("HTTP date")
+    {
+      REQUIRE( RetryPolicy::parseRetryAfter("Wed, 21 Oct 2015 07:28:00 GMT", date - 90s) == 90s );
+      REQUIRE( RetryPolicy::parseRetryAfter("Wed, 21 Oct 2015 07:28:00 GMT", date + 1s) == 0s );
+    }
+
+    SECTION("invalid values")
+    {
+      REQUIRE( RetryPolicy::parseRetryAfter("", date) == 0s );
+      REQUIRE( RetryPolicy::parseRetryAfter("soon", date) == 0s );
+      REQUIRE( RetryPolicy::parseRetryAfter("-5", date) == 0s );
+      REQUIRE( RetryPolicy::parseRetryAfter("99999999999999999999", date) == 0s );
+    }
+  }
+
+  SECTION("backoff grows exponentially up to the maximum")
+  {
+    RetryPolicy policy(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    for (unsigned int retry = 0; retry < 40; ++retry)
+    {
+      const auto delay = policy.backoff(retry, 0s);
+      const auto full = retry < 5 ? RetryPolicy::baseDelay * (1 << retry) : RetryPolicy::maxDelay;
+      REQUIRE( delay >= std::min(full, RetryPolicy::maxDelay) / 2 );
+      REQUIRE( delay <= std::min(full, RetryPolicy::maxDelay) );
+    }
+  }
+
+  SECTION("backoff respects Retry-After")
+  {
+    RetryPolicy policy(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    REQUIRE( policy.backoff(0, 120s) == 120s );
+  }
+
+  SECTION("retry budget is a tenth of the request limit")
+  {
+    // free plan of OpenWeatherMap: 60 requests per minute
+    RetryPolicy policy(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    for (int i = 0; i < 6; ++i)
+    {
+      REQUIRE( policy.tryRetry(ApiType::OpenWeatherMap, start) );
+    }
+    REQUIRE_FALSE( policy.tryRetry(ApiType::OpenWeatherMap, start + 30s) );
+    // Other APIs have their own budget.
+    REQUIRE( policy.tryRetry(ApiType::OpenMeteo, start + 30s) );
+    // The budget is renewed after the time span of the limit.
+    REQUIRE( policy.tryRetry(ApiType::OpenWeatherMap, start + 60s) );
+  }
+
+  SECTION("circuit breaker opens after several failures")
+  {
+    RetryPolicy policy(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    for (unsigned int i = 1; i < RetryPolicy::failureThreshold; ++i)
+    {
+      REQUIRE_FALSE( policy.recordFailure(ApiType::OpenMeteo, start, 0s) );
+      REQUIRE( policy.allowRequest(ApiType::OpenMeteo, start) );
+    }
+    REQUIRE( policy.recordFailure(ApiType::OpenMeteo, start, 0s) );
+    REQUIRE_FALSE( policy.isAvailable(ApiType::OpenMeteo, start) );
+    REQUIRE_FALSE( policy.allowRequest(ApiType::OpenMeteo, start) );
+    REQUIRE_FALSE( policy.allowRequest(ApiType::OpenMeteo, start + RetryPolicy::initialCooldown - 1s) );
+    // other APIs are not affected
+    REQUIRE( policy.isAvailable(ApiType::OpenWeatherMap, start) );
+    REQUIRE( policy.allowRequest(ApiType::OpenWeatherMap, start) );
+
+    // After the cooldown only a single trial request passes. Checking the
+    // availability does not use up that trial.
+    const auto trial = start + RetryPolicy::initialCooldown;
+    REQUIRE( policy.isAvailable(ApiType::OpenMeteo, trial) );
+    REQUIRE( policy.isAvailable(ApiType::OpenMeteo, trial) );
+    REQUIRE( policy.allowRequest(ApiType::OpenMeteo, trial) );
+    REQUIRE_FALSE( policy.isAvailable(ApiType::OpenMeteo, trial) );
+    REQUIRE_FALSE( policy.allowRequest(ApiType::OpenMeteo, trial) );
+
+    SECTION("successful trial closes the breaker")
+    {
+      policy.recordSuccess(ApiType::OpenMeteo);
+      REQUIRE( policy.allowRequest(ApiType::OpenMeteo, trial) );
+      REQUIRE( policy.allowRequest(ApiType::OpenMeteo, trial) );
+    }
+
+    SECTION("failed trial opens the breaker for a longer time")
+    {
+      REQUIRE( policy.recordFailure(ApiType::OpenMeteo, trial, 0s) );
+      REQUIRE_FALSE( policy.allowRequest(ApiType::OpenMeteo, trial + RetryPolicy::initialCooldown) );
+      REQUIRE( policy.allowRequest(ApiType::OpenMeteo, trial + 2 * RetryPolicy::initialCooldown) );
+    }
+  }
+
+  SECTION("Retry-After pauses all requests to the API")
+  {
+    RetryPolicy policy(PlanOwm::Free, PlanWeatherbit::Free, PlanWeatherstack::Free);
+    REQUIRE( policy.recordFailure(ApiType::OpenWeatherMap, start, 30s) );
+    REQUIRE_FALSE( policy.allowRequest(ApiType::OpenWeatherMap, start + 29s) );
+    REQUIRE( policy.allowRequest(ApiType::OpenWeatherMap, start + 30s) );
+    REQUIRE( policy.allowRequest(ApiType::OpenWeatherMap, start + 30s) );
+  }
+}
@@ -19,6 +19,7 @@
 */
 
 #include "../../find_catch.hpp"
+#include <vector>
 #include "../../../src/api/Weatherbit.hpp"
 
 TEST_CASE("Weatherbit - non-network tests")
@@ -169,4 +170,69 @@ TEST_CASE("Weatherbit - non-network tests")
       REQUIRE_FALSE( api.currentAndForecastWeather(location, w, fc) );
     }
   }
+
+  SECTION("toRequestString with several locations")
+  {
+    std::vector<Location> locations;
+
+    SECTION("no locations")
+    {
+      REQUIRE( Weatherbit::toRequestString(locations).empty() );
+    }
+
+    SECTION("one location without coordinates")
+    {
+      Location first;
+      first.setCoordinates(12.34f, 56.78f);
+      Location second;
+      second.setName("Some City");
+      second.setCountryCode("DE");
+      locations = { first, second };
+      REQUIRE( Weatherbit::toRequestString(locations).empty() );
+    }
+
+    SECTION("several locations")
+    {
+      Location first;
+      first.setCoordinates(12.34f, 56.78f);
+      Location second;
+      second.setCoordinates(-1.5f, 2.25f);
+      locations = { first, second };
+      REQUIRE( Weatherbit::toRequestString(locations) == "points=(12.34,56.78),(-1.5,2.25)" );
+    }
+  }
+
+  SECTION("maximumBatchSize")
+  {
+    REQUIRE( api.maximumBatchSize(DataType::Current) == Weatherbit::maximumLocationsPerRequest );
+    REQUIRE( api.maximumBatchSize(DataType::Forecast) == 1 );
+    // The free plan cannot request several locations at once.
+    Weatherbit free(PlanWeatherbit::Free, "not a valid key");
+    REQUIRE( free.maximumBatchSize(DataType::Current) == 1 );
+  }
+
+  SECTION("validBatchLocation")
+  {
+    Location location;
+    location.setName("Some City");
+    location.setCountryCode("DE");
+    REQUIRE_FALSE( api.validBatchLocation(location) );
+    location.setCoordinates(12.34f, 56.78f);
+    REQUIRE( api.validBatchLocation(location) );
+  }
+
+  SECTION("currentWeatherBatch")
+  {
+    Location location;
+    location.setCoordinates(12.34f, 56.78f);
+    std::vector<Location> locations = { location, location };
+
+    SECTION("request with empty API key fails")
+    {
+      api.setApiKey("");
+      std::vector<Weather> weather;
+      REQUIRE_FALSE( api.currentWeatherBatch(locations, weather) );
+      REQUIRE( weather.empty() );
+    }
+  }
 }
@@ -0,0 +1,130 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <random>
+#include <vector>
+#include "../../../src/collector/Scheduler.hpp"
+
+TEST_CASE("Scheduler")
+{
+  using namespace wic;
+  using namespace std::chrono_literals;
+  const auto now = std::chrono::steady_clock::now();
+
+  SECTION("constructor creates empty scheduler")
+  {
+    Scheduler scheduler;
+    REQUIRE( scheduler.empty() );
+    REQUIRE( scheduler.size() == 0 );
+  }
+
+  SECTION("next returns earliest task")
+  {
+    Scheduler scheduler;
+    scheduler.schedule(0, now + 30s);
+    scheduler.schedule(1, now + 10s);
+    scheduler.schedule(2, now + 20s);
+
+    REQUIRE( scheduler.size() == 3 );
+    REQUIRE( scheduler.next().index == 1 );
+    REQUIRE( scheduler.next().due == now + 10s );
+  }
+
+  SECTION("tasks with same due time are ordered by index")
+  {
+    Scheduler scheduler;
+    scheduler.schedule(5, now);
+    scheduler.schedule(2, now);
+    scheduler.schedule(7, now);
+
+    REQUIRE( scheduler.pop().index == 2 );
+    REQUIRE( scheduler.pop().index == 5 );
+    REQUIRE( scheduler.pop().index == 7 );
+    REQUIRE( scheduler.empty() );
+  }
+
+  SECTION("rescheduleNext moves task behind later tasks")
+  {
+    Scheduler scheduler;
+    scheduler.schedule(0, now);
+    scheduler.schedule(1, now + 5s);
+
+    scheduler.rescheduleNext(now + 10s);
+    REQUIRE( scheduler.next().index == 1 );
+    scheduler.rescheduleNext(now + 15s);
+    REQUIRE( scheduler.next().index == 0 );
+    REQUIRE( scheduler.next().due == now + 10s );
+    REQUIRE( scheduler.size() == 2 );
+  }
+
+  SECTION("rescheduleNext with earlier due time keeps task in front")
+  {
+    Scheduler scheduler;
+    scheduler.schedule(0, now + 10s);
+    scheduler.schedule(1, now + 20s);
+    scheduler.schedule(2, now + 30s);
+
+    scheduler.rescheduleNext(now + 5s);
+    REQUIRE( scheduler.next().index == 0 );
+    REQUIRE( scheduler.next().due == now + 5s );
+    REQUIRE( scheduler.pop().index == 0 );
+    REQUIRE( scheduler.pop().index == 1 );
+    REQUIRE( scheduler.pop().index == 2 );
+  }
+
+  SECTION("order matches linear scan")
+  {
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<int> distribution(1, 500);
+    std::vector<std::chrono::steady_clock::time_point> due;
+    std::vector<std::chrono::seconds> intervals;
+    Scheduler scheduler;
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+      due.push_back(now + std::chrono::seconds(distribution(generator)));
+      intervals.emplace_back(distribution(generator));
+      scheduler.schedule(i, due[i]);
+    }
+
+    for (int step = 0; step < 5000; ++step)
+    {
+      std::size_t minIndex = 0;
+      for (std::size_t i = 1; i < due.size(); ++i)
+      {
+        if (due[i] < due[minIndex])
+          minIndex = i;
+      }
+      REQUIRE( scheduler.next().index == minIndex );
+      due[minIndex] += intervals[minIndex];
+      scheduler.rescheduleNext(due[minIndex]);
+    }
+  }
+
+  SECTION("clear")
+  {
+    Scheduler scheduler;
+    scheduler.schedule(0, now);
+    scheduler.schedule(1, now);
+    scheduler.clear();
+
+    REQUIRE( scheduler.empty() );
+  }
+}
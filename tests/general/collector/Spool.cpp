@@ -0,0 +1,216 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <filesystem>
+#include <fstream>
+#include "../../../src/collector/Spool.hpp"
+
+// guard to ensure spool file deletion when it goes out of scope
+class SpoolFileGuard
+{
+  private:
+    std::filesystem::path path;
+  public:
+    SpoolFileGuard(const std::filesystem::path& filePath)
+    : path(filePath)
+    { }
+
+    SpoolFileGuard(const SpoolFileGuard& op) = delete;
+    SpoolFileGuard(SpoolFileGuard&& op) = delete;
+
+    ~SpoolFileGuard()
+    {
+      std::filesystem::remove(path);
+    }
+};
+
+wic::StorageRecord sampleWeatherRecord()
+{
+  using namespace wic;
+  Location loc;
+  loc.setOwmId(2935022);
+  loc.setName("Dresden");
+  loc.setCountryCode("DE");
+  loc.setCoordinates(51.05f, 13.74f);
+
+  Weather weather;
+  weather.setDataTime(std::chrono::system_clock::from_time_t(1737800000));
+  weather.setRequestTime(std::chrono::system_clock::from_time_t(1737800123));
+  weather.setTemperatureKelvin(275.15f);
+  weather.setTemperatureCelsius(2.0f);
+  weather.setHumidity(87);
+  weather.setRain(0.25f);
+  weather.setPressure(1013);
+  weather.setWindSpeed(3.5f);
+  weather.setWindDegrees(270);
+  weather.setCloudiness(100);
+  weather.setJson("{\"current\":{\"temperature_2m\":2.0}}");
+
+  return StorageRecord{ ApiType::OpenMeteo, loc, DataType::Current, weather, Forecast() };
+}
+
+wic::StorageRecord sampleForecastRecord()
+{
+  using namespace wic;
+  Location loc;
+  loc.setName("Tiksi");
+  loc.setPostcode("678400");
+
+  Forecast forecast;
+  forecast.setRequestTime(std::chrono::system_clock::from_time_t(1737800456));
+  forecast.setJson("{\"hourly\":{}}");
+  std::vector<Weather> data;
+  for (int i = 0; i < 3; ++i)
+  {
+    Weather w;
+    w.setDataTime(std::chrono::system_clock::from_time_t(1737800000 + i * 3600));
+    w.setTemperatureCelsius(-30.5f + i);
+    w.setSnow(1.5f);
+    data.push_back(w);
+  }
+  forecast.setData(data);
+
+  return StorageRecord{ ApiType::OpenWeatherMap, loc, DataType::Forecast, Weather(), forecast };
+}
+
+TEST_CASE("Spool")
+{
+  using namespace wic;
+
+  SECTION("encode and decode current weather")
+  {
+    const auto record = sampleWeatherRecord();
+    StorageRecord decoded;
+    REQUIRE( Spool::decode(Spool::encode(record), decoded) );
+    REQUIRE( decoded.api == record.api );
+    REQUIRE( decoded.type == DataType::Current );
+    REQUIRE( decoded.location == record.location );
+    REQUIRE( decoded.weather == record.weather );
+    REQUIRE( decoded.weather.json() == record.weather.json() );
+  }
+
+  SECTION("encode and decode forecast")
+  {
+    const auto record = sampleForecastRecord();
+    StorageRecord decoded;
+    REQUIRE( Spool::decode(Spool::encode(record), decoded) );
+    REQUIRE( decoded.api == record.api );
+    REQUIRE( decoded.type == DataType::Forecast );
+    REQUIRE( decoded.location == record.location );
+    REQUIRE( decoded.forecast == record.forecast );
+    REQUIRE( decoded.forecast.json() == record.forecast.json() );
+  }
+
+  SECTION("decode fails for truncated data")
+  {
+    const std::string data = Spool::encode(sampleForecastRecord());
+    StorageRecord decoded;
+    REQUIRE_FALSE( Spool::decode(data.substr(0, data.size() - 1), decoded) );
+    REQUIRE_FALSE( Spool::decode(data + "x", decoded) );
+    REQUIRE_FALSE( Spool::decode("", decoded) );
+  }
+
+  SECTION("append, peek and consume")
+  {
+    const std::filesystem::path path{"spool-append.bin"};
+    SpoolFileGuard guard{path};
+    Spool spool(path.string());
+    REQUIRE( spool.good() );
+    REQUIRE( spool.pending() == 0 );
+
+    REQUIRE( spool.append({ sampleWeatherRecord(), sampleForecastRecord() }) );
+    REQUIRE( spool.append({ sampleWeatherRecord() }) );
+    REQUIRE( spool.pending() == 3 );
+
+    std::vector<StorageRecord> records;
+    REQUIRE( spool.peek(2, records) );
+    REQUIRE( records.size() == 2 );
+    REQUIRE( records[0].type == DataType::Current );
+    REQUIRE( records[1].type == DataType::Forecast );
+    // Records stay in the spool until they are consumed.
+    REQUIRE( spool.pending() == 3 );
+    spool.consume();
+    REQUIRE( spool.pending() == 1 );
+
+    REQUIRE( spool.peek(100, records) );
+    REQUIRE( records.size() == 1 );
+    REQUIRE( records[0].weather == sampleWeatherRecord().weather );
+    spool.consume();
+    REQUIRE( spool.pending() == 0 );
+    // File gets truncated when everything is consumed.
+    REQUIRE( std::filesystem::file_size(path) == Spool::header.size() );
+  }
+
+  SECTION("existing file is read again")
+  {
+    const std::filesystem::path path{"spool-reopen.bin"};
+    SpoolFileGuard guard{path};
+    {
+      Spool spool(path.string());
+      REQUIRE( spool.append({ sampleWeatherRecord(), sampleForecastRecord() }) );
+    }
+
+    Spool spool(path.string());
+    REQUIRE( spool.good() );
+    REQUIRE( spool.pending() == 2 );
+    std::vector<StorageRecord> records;
+    REQUIRE( spool.peek(10, records) );
+    REQUIRE( records.size() == 2 );
+    REQUIRE( records[1].forecast == sampleForecastRecord().forecast );
+  }
+
+  SECTION("incomplete record at the end is discarded")
+  {
+    const std::filesystem::path path{"spool-incomplete.bin"};
+    SpoolFileGuard guard{path};
+    {
+      Spool spool(path.string());
+      REQUIRE( spool.append({ sampleWeatherRecord(), sampleForecastRecord() }) );
+    }
+    // Cut off the last byte, as if the program crashed during the write.
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 1);
+
+    Spool spool(path.string());
+    REQUIRE( spool.good() );
+    REQUIRE( spool.pending() == 1 );
+    REQUIRE( spool.append({ sampleWeatherRecord() }) );
+    std::vector<StorageRecord> records;
+    REQUIRE( spool.peek(10, records) );
+    REQUIRE( records.size() == 2 );
+    REQUIRE( records[0].type == DataType::Current );
+    REQUIRE( records[1].type == DataType::Current );
+  }
+
+  SECTION("other files are not used as spool")
+  {
+    const std::filesystem::path path{"spool-no-spool.txt"};
+    SpoolFileGuard guard{path};
+    {
+      std::ofstream stream(path);
+      stream << "This is not a spool file.\n";
+    }
+
+    Spool spool(path.string());
+    REQUIRE_FALSE( spool.good() );
+    REQUIRE_FALSE( spool.append({ sampleWeatherRecord() }) );
+  }
+}
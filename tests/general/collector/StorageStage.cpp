@@ -0,0 +1,228 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../../../src/collector/Spool.hpp"
+#include "../../../src/collector/StorageStage.hpp"
+
+TEST_CASE("StorageStage")
+{
+  using namespace wic;
+  using namespace std::chrono_literals;
+
+  SECTION("flush size triggers flush before interval")
+  {
+    std::mutex mutex;
+    std::vector<std::size_t> batchSizes;
+    StorageStage stage([&](const std::vector<StorageRecord>& batch, const bool)
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          batchSizes.push_back(batch.size());
+          return true;
+        }, 1h, 3, 100);
+
+    for (int i = 0; i < 3; ++i)
+    {
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    }
+    // The interval is one hour, so only the flush size can trigger the write.
+    for (int i = 0; i < 200 && stage.statistics().recordsWritten < 3; ++i)
+    {
+      std::this_thread::sleep_for(10ms);
+    }
+    const auto stats = stage.statistics();
+    REQUIRE( stats.recordsWritten == 3 );
+    REQUIRE( stats.flushes == 1 );
+    REQUIRE( stats.queueDepth == 0 );
+    REQUIRE( stats.maxQueueDepth == 3 );
+  }
+
+  SECTION("interval triggers flush of small batches")
+  {
+    StorageStage stage([](const std::vector<StorageRecord>&, const bool) { return true; },
+                       20ms, 100, 100);
+    REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    for (int i = 0; i < 200 && stage.statistics().recordsWritten < 1; ++i)
+    {
+      std::this_thread::sleep_for(10ms);
+    }
+    REQUIRE( stage.statistics().recordsWritten == 1 );
+  }
+
+  SECTION("stop flushes all queued records")
+  {
+    std::atomic<std::size_t> written = 0;
+    std::vector<DataType> types;
+    {
+      StorageStage stage([&](const std::vector<StorageRecord>& batch, const bool)
+          {
+            for (const auto& record : batch)
+              types.push_back(record.type);
+            written += batch.size();
+            return true;
+          }, 1h, 1000, 1000);
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+      REQUIRE( stage.pushForecast(ApiType::OpenMeteo, Location(), Forecast()) );
+      stage.stop();
+
+      REQUIRE( written == 2 );
+      REQUIRE( stage.statistics().recordsWritten == 2 );
+      // Pushes after stop() fail.
+      REQUIRE_FALSE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    }
+    REQUIRE( types.size() == 2 );
+    REQUIRE( types[0] == DataType::Current );
+    REQUIRE( types[1] == DataType::Forecast );
+  }
+
+  SECTION("failed writes are counted")
+  {
+    StorageStage stage([](const std::vector<StorageRecord>&, const bool) { return false; },
+                       1h, 1000, 1000);
+    REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    stage.stop();
+
+    const auto stats = stage.statistics();
+    REQUIRE( stats.flushes == 1 );
+    REQUIRE( stats.recordsWritten == 0 );
+    REQUIRE( stats.recordsFailed == 1 );
+  }
+
+  SECTION("full queue blocks pushes")
+  {
+    std::mutex gate;
+    std::unique_lock<std::mutex> closed(gate);
+    std::atomic<std::size_t> written = 0;
+    StorageStage stage([&](const std::vector<StorageRecord>& batch, const bool)
+        {
+          std::lock_guard<std::mutex> lock(gate);
+          written += batch.size();
+          return true;
+        }, 1h, 1, 2);
+
+    // The first record gets taken by the writer, which then waits at the gate.
+    REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    for (int i = 0; i < 200 && stage.statistics().queueDepth > 0; ++i)
+    {
+      std::this_thread::sleep_for(10ms);
+    }
+    // Two more records fill the queue.
+    REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+    REQUIRE( stage.statistics().queueDepth == 2 );
+
+    std::atomic<bool> pushed = false;
+    std::thread producer([&]()
+    {
+      pushed = stage.pushWeather(ApiType::OpenMeteo, Location(), Weather());
+    });
+    std::this_thread::sleep_for(50ms);
+    REQUIRE_FALSE( pushed );
+
+    closed.unlock();
+    producer.join();
+    REQUIRE( pushed );
+    stage.stop();
+    REQUIRE( written == 4 );
+    REQUIRE( stage.statistics().blockedPushes == 1 );
+  }
+
+  SECTION("failed flushes go to the spool and are replayed later")
+  {
+    const std::filesystem::path path{"storage-stage-spool.bin"};
+    std::filesystem::remove(path);
+    {
+      std::mutex mutex;
+      bool databaseAvailable = false;
+      std::vector<bool> replays;
+      StorageStage stage([&](const std::vector<StorageRecord>& batch, const bool replay)
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!databaseAvailable)
+              return false;
+            replays.insert(replays.end(), batch.size(), replay);
+            return true;
+          }, 10ms, 1, 100, std::make_unique<Spool>(path.string()));
+
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+      for (int i = 0; i < 200 && stage.statistics().recordsSpooled < 2; ++i)
+      {
+        std::this_thread::sleep_for(10ms);
+      }
+      REQUIRE( stage.statistics().recordsSpooled == 2 );
+      REQUIRE( stage.statistics().spoolPending == 2 );
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        databaseAvailable = true;
+      }
+      for (int i = 0; i < 200 && stage.statistics().spoolPending > 0; ++i)
+      {
+        std::this_thread::sleep_for(10ms);
+      }
+      stage.stop();
+
+      const auto stats = stage.statistics();
+      REQUIRE( stats.recordsReplayed == 2 );
+      REQUIRE( stats.recordsFailed == 0 );
+      REQUIRE( stats.spoolPending == 0 );
+      REQUIRE( replays.size() == 2 );
+      REQUIRE( replays[0] );
+      REQUIRE( replays[1] );
+    }
+    std::filesystem::remove(path);
+  }
+
+  SECTION("full queue writes to spool instead of blocking")
+  {
+    const std::filesystem::path path{"storage-stage-spool-full.bin"};
+    std::filesystem::remove(path);
+    {
+      std::mutex gate;
+      std::unique_lock<std::mutex> closed(gate);
+      StorageStage stage([&](const std::vector<StorageRecord>&, const bool)
+          {
+            std::lock_guard<std::mutex> lock(gate);
+            return true;
+          }, 1h, 1, 1, std::make_unique<Spool>(path.string()));
+
+      // The first record gets taken by the writer, which then waits at the gate.
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+      for (int i = 0; i < 200 && stage.statistics().queueDepth > 0; ++i)
+      {
+        std::this_thread::sleep_for(10ms);
+      }
+      // The second record fills the queue, the third one goes to the spool.
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+      REQUIRE( stage.pushWeather(ApiType::OpenMeteo, Location(), Weather()) );
+      const auto stats = stage.statistics();
+      REQUIRE( stats.recordsSpooled == 1 );
+      REQUIRE( stats.blockedPushes == 0 );
+      closed.unlock();
+    }
+    std::filesystem::remove(path);
+  }
+}
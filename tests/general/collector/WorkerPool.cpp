@@ -0,0 +1,119 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include "../../../src/collector/WorkerPool.hpp"
+
+TEST_CASE("WorkerPool")
+{
+  using namespace wic;
+
+  SECTION("constructor")
+  {
+    WorkerPool pool(3);
+    REQUIRE( pool.size() == 3 );
+    REQUIRE( pool.inFlight() == 0 );
+    REQUIRE( pool.running() == 0 );
+  }
+
+  SECTION("zero threads means one thread")
+  {
+    WorkerPool pool(0);
+    REQUIRE( pool.size() == 1 );
+  }
+
+  SECTION("all submitted jobs are executed")
+  {
+    std::atomic<int> counter{0};
+    WorkerPool pool(4);
+    for (int i = 0; i < 100; ++i)
+    {
+      REQUIRE( pool.submit([&counter]() { ++counter; }) );
+    }
+    pool.waitUntilIdle();
+
+    REQUIRE( counter == 100 );
+    REQUIRE( pool.inFlight() == 0 );
+  }
+
+  SECTION("jobs run in parallel")
+  {
+    std::atomic<int> current{0};
+    std::atomic<int> maximum{0};
+    WorkerPool pool(4);
+    for (int i = 0; i < 4; ++i)
+    {
+      pool.submit([&current, &maximum]()
+      {
+        const int now = ++current;
+        int seen = maximum;
+        while (now > seen && !maximum.compare_exchange_weak(seen, now))
+        { }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        --current;
+      });
+    }
+    pool.waitUntilIdle();
+
+    REQUIRE( maximum > 1 );
+  }
+
+  SECTION("exceptions in jobs do not kill the worker")
+  {
+    std::atomic<int> counter{0};
+    WorkerPool pool(1);
+    pool.submit([]() { throw std::runtime_error("test"); });
+    pool.submit([&counter]() { ++counter; });
+    pool.waitUntilIdle();
+
+    REQUIRE( counter == 1 );
+  }
+
+  SECTION("jobs queued by running jobs are executed before stop")
+  {
+    std::atomic<int> counter{0};
+    std::atomic<bool> queued{false};
+    WorkerPool pool(1);
+    pool.submit([&pool, &counter, &queued]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      ++counter;
+      queued = pool.submit([&counter]() { ++counter; });
+    });
+    pool.waitUntilIdle();
+    pool.stop();
+
+    REQUIRE( queued );
+    REQUIRE( counter == 2 );
+    REQUIRE( pool.inFlight() == 0 );
+  }
+
+  SECTION("no submission after stop")
+  {
+    WorkerPool pool(2);
+    pool.stop();
+
+    REQUIRE_FALSE( pool.submit([]() { }) );
+    REQUIRE( pool.inFlight() == 0 );
+  }
+}
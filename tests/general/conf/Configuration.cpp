@@ -924,6 +924,721 @@ TEST_CASE("Class Configuration")
       REQUIRE_FALSE( conf.load(path.string(), true) );
     }
 
+    SECTION("collector threads")
+    {
+      const std::filesystem::path path{"collector-threads.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.threads=12
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.collectorThreads() == Configuration::defaultCollectorThreads );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.collectorThreads() == 12 );
+    }
+
+    SECTION("collector threads invalid: not a positive integer")
+    {
+      const std::filesystem::path path{"collector-threads-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.threads=0
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector threads invalid: threads were specified more than once")
+    {
+      const std::filesystem::path path{"collector-threads-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.threads=4
+      collector.threads=8
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector batch settings")
+    {
+      const std::filesystem::path path{"collector-batch.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.batch_size=50
+      collector.batch_window=0
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.collectorBatchSize() == Configuration::defaultCollectorBatchSize );
+      REQUIRE( conf.collectorBatchWindow() == std::chrono::seconds(Configuration::defaultCollectorBatchWindow) );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.collectorBatchSize() == 50 );
+      REQUIRE( conf.collectorBatchWindow() == std::chrono::seconds::zero() );
+    }
+
+    SECTION("collector batch settings invalid: batch size out of range")
+    {
+      const std::filesystem::path path{"collector-batch-size-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.batch_size=101
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector batch settings invalid: batch size was specified more than once")
+    {
+      const std::filesystem::path path{"collector-batch-size-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.batch_size=10
+      collector.batch_size=20
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector batch settings invalid: batch window is negative")
+    {
+      const std::filesystem::path path{"collector-batch-window-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.batch_window=-1
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector batch settings invalid: batch window was specified more than once")
+    {
+      const std::filesystem::path path{"collector-batch-window-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.batch_window=0
+      collector.batch_window=30
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector connections per host")
+    {
+      const std::filesystem::path path{"collector-connections.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.connections_per_host=12
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.collectorConnectionsPerHost() == Configuration::defaultCollectorConnectionsPerHost );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.collectorConnectionsPerHost() == 12 );
+    }
+
+    SECTION("collector connections per host invalid: zero")
+    {
+      const std::filesystem::path path{"collector-connections-zero.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.connections_per_host=0
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector connections per host invalid: specified more than once")
+    {
+      const std::filesystem::path path{"collector-connections-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.connections_per_host=2
+      collector.connections_per_host=3
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector HTTP/2")
+    {
+      const std::filesystem::path path{"collector-http2.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.http2=false
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.collectorHttp2() );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE_FALSE( conf.collectorHttp2() );
+    }
+
+    SECTION("collector HTTP/2 invalid: not a boolean value")
+    {
+      const std::filesystem::path path{"collector-http2-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.http2=maybe
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector HTTP/2 invalid: specified more than once")
+    {
+      const std::filesystem::path path{"collector-http2-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.http2=true
+      collector.http2=false
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector pre-warm time")
+    {
+      const std::filesystem::path path{"collector-prewarm.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.prewarm_time=0
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.collectorPrewarmTime() == std::chrono::milliseconds(Configuration::defaultCollectorPrewarmTime) );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.collectorPrewarmTime() == std::chrono::milliseconds(0) );
+    }
+
+    SECTION("collector pre-warm time invalid: out of range")
+    {
+      const std::filesystem::path path{"collector-prewarm-range.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.prewarm_time=60001
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector pre-warm time invalid: specified more than once")
+    {
+      const std::filesystem::path path{"collector-prewarm-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.prewarm_time=250
+      collector.prewarm_time=750
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector timeouts")
+    {
+      const std::filesystem::path path{"collector-timeouts.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.connect_timeout=5
+      collector.request_timeout=0
+      collector.stall_timeout=15
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.collectorConnectTimeout() == std::chrono::seconds(Configuration::defaultCollectorConnectTimeout) );
+      REQUIRE( conf.collectorRequestTimeout() == std::chrono::seconds(Configuration::defaultCollectorRequestTimeout) );
+      REQUIRE( conf.collectorStallTimeout() == std::chrono::seconds(Configuration::defaultCollectorStallTimeout) );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.collectorConnectTimeout() == std::chrono::seconds(5) );
+      REQUIRE( conf.collectorRequestTimeout() == std::chrono::seconds(0) );
+      REQUIRE( conf.collectorStallTimeout() == std::chrono::seconds(15) );
+    }
+
+    SECTION("collector connect timeout invalid: zero")
+    {
+      const std::filesystem::path path{"collector-connect-timeout-zero.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.connect_timeout=0
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector request timeout invalid: out of range")
+    {
+      const std::filesystem::path path{"collector-request-timeout-range.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.request_timeout=3601
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector stall timeout invalid: specified more than once")
+    {
+      const std::filesystem::path path{"collector-stall-timeout-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.stall_timeout=10
+      collector.stall_timeout=20
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector Open-Meteo Unix time")
+    {
+      const std::filesystem::path path{"collector-openmeteo-unixtime.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.openmeteo_unixtime=true
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.collectorOpenMeteoUnixTime() );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.collectorOpenMeteoUnixTime() );
+    }
+
+    SECTION("collector Open-Meteo Unix time invalid: not a boolean value")
+    {
+      const std::filesystem::path path{"collector-openmeteo-unixtime-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.openmeteo_unixtime=sometimes
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("collector Open-Meteo Unix time invalid: specified more than once")
+    {
+      const std::filesystem::path path{"collector-openmeteo-unixtime-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # collector
+      collector.openmeteo_unixtime=true
+      collector.openmeteo_unixtime=false
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("storage settings")
+    {
+      const std::filesystem::path path{"storage.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # storage
+      storage.flush_interval=30
+      storage.flush_size=250
+      storage.queue_size=5000
+      storage.spool_file=/var/tmp/wic-spool.bin
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE( conf.storageFlushInterval() == std::chrono::seconds(Configuration::defaultStorageFlushInterval) );
+      REQUIRE( conf.storageFlushSize() == Configuration::defaultStorageFlushSize );
+      REQUIRE( conf.storageQueueSize() == Configuration::defaultStorageQueueSize );
+      REQUIRE( conf.storageSpoolFile().empty() );
+      REQUIRE( conf.load(path.string(), true) );
+      REQUIRE( conf.storageFlushInterval() == std::chrono::seconds(30) );
+      REQUIRE( conf.storageFlushSize() == 250 );
+      REQUIRE( conf.storageQueueSize() == 5000 );
+      REQUIRE( conf.storageSpoolFile() == "/var/tmp/wic-spool.bin" );
+    }
+
+    SECTION("storage settings invalid: flush interval out of range")
+    {
+      const std::filesystem::path path{"storage-flush-interval-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # storage
+      storage.flush_interval=3601
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("storage settings invalid: flush size is not a positive integer")
+    {
+      const std::filesystem::path path{"storage-flush-size-invalid.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # storage
+      storage.flush_size=0
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
+    SECTION("storage settings invalid: queue size was specified more than once")
+    {
+      const std::filesystem::path path{"storage-queue-size-twice.conf"};
+      const std::string content = R"conf(
+      # database settings
+      db.host=the.host.local
+      db.name=my_database
+      db.user=user
+      db.password=secret(!) password
+      db.port=3306
+      tasks.directory=/home/user/.wic/task.d
+      tasks.extension=.task
+      # API keys
+      key.owm=1234567890abcdef
+      # storage
+      storage.queue_size=100
+      storage.queue_size=200
+      )conf";
+      REQUIRE( writeConfiguration(path, content) );
+      FileGuard guard{path};
+
+      Configuration conf;
+      REQUIRE_FALSE( conf.load(path.string(), true) );
+    }
+
     SECTION("setting invalid: unrecognized setting name")
     {
       const std::filesystem::path path{"unrecognized-setting-name.conf"};
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2017, 2018, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include <cmath>
+#include <memory>
 #include "../../find_catch.hpp"
 
 #include "../../../src/data/Weather.hpp"
@@ -211,4 +212,29 @@ TEST_CASE("WeatherClass")
     REQUIRE( weather.hasJson() );
     REQUIRE( weather.json() == std::string("{foo: 1, bar: 2}") );
   }
+
+  SECTION("setting empty JSON removes the JSON")
+  {
+    weather.setJson("{foo: 1, bar: 2}");
+    REQUIRE( weather.hasJson() );
+    weather.setJson("");
+    REQUIRE_FALSE( weather.hasJson() );
+    REQUIRE( weather.json().empty() );
+  }
+
+  SECTION("share JSON with other instances")
+  {
+    const auto json = std::make_shared<const std::string>("{foo: 1, bar: 2}");
+    Weather other;
+    weather.setJson(json);
+    other.setJson(json);
+    REQUIRE( weather.hasJson() );
+    REQUIRE( other.hasJson() );
+    REQUIRE( &weather.json() == &other.json() );
+
+    // Changing the JSON of one instance does not change the other instance.
+    other.setJson("{}");
+    REQUIRE( weather.json() == std::string("{foo: 1, bar: 2}") );
+    REQUIRE( other.json() == std::string("{}") );
+  }
 }
@@ -126,6 +126,71 @@ TEST_CASE("Curly")
     REQUIRE( curly.maximumRedirects() == -1 );
   }
 
+  SECTION("writeCallbackPadded keeps padding after the data")
+  {
+    std::string data;
+    ResponseBuffer buffer{ &data, nullptr };
+    std::string chunk(1000, 'a');
+    for (int i = 0; i < 50; ++i)
+    {
+      REQUIRE( writeCallbackPadded(chunk.data(), 1, chunk.size(), &buffer) == chunk.size() );
+      REQUIRE( data.capacity() - data.size() >= responsePadding );
+    }
+    REQUIRE( data.size() == 50000 );
+    REQUIRE( data == std::string(50000, 'a') );
+  }
+
+  SECTION("accept compression")
+  {
+    Curly curly;
+
+    REQUIRE( curly.acceptsCompression() );
+    curly.acceptCompression(false);
+    REQUIRE_FALSE( curly.acceptsCompression() );
+    curly.acceptCompression(true);
+    REQUIRE( curly.acceptsCompression() );
+  }
+
+  SECTION("HTTP/2")
+  {
+    REQUIRE( Curly::defaultHttp2() );
+
+    Curly curly;
+    REQUIRE( curly.usesHttp2() );
+    curly.useHttp2(false);
+    REQUIRE_FALSE( curly.usesHttp2() );
+    curly.useHttp2(true);
+    REQUIRE( curly.usesHttp2() );
+
+    Curly::setDefaultHttp2(false);
+    REQUIRE_FALSE( Curly().usesHttp2() );
+    Curly::setDefaultHttp2(true);
+    REQUIRE( Curly().usesHttp2() );
+  }
+
+  SECTION("timeouts")
+  {
+    using namespace std::chrono_literals;
+    const Timeouts defaults = Curly::defaultTimeouts();
+    REQUIRE( defaults.connect == 10s );
+    REQUIRE( defaults.total == 60s );
+    REQUIRE( defaults.stall == 30s );
+
+    Curly curly;
+    REQUIRE( curly.timeouts().connect == defaults.connect );
+    REQUIRE( curly.timeouts().total == defaults.total );
+    REQUIRE( curly.timeouts().stall == defaults.stall );
+
+    curly.setTimeouts(Timeouts{ 2s, 5s, 0s });
+    REQUIRE( curly.timeouts().connect == 2s );
+    REQUIRE( curly.timeouts().total == 5s );
+    REQUIRE( curly.timeouts().stall == 0s );
+
+    Curly::setDefaultTimeouts(Timeouts{ 3s, 4s, 5s });
+    REQUIRE( Curly().timeouts().total == 4s );
+    Curly::setDefaultTimeouts(defaults);
+  }
+
   if (!wic::hasEnvVar("SKIP_NETWORK_TESTS"))
   {
     const std::string httpbin_url = wic::hasEnvVar("USE_LOCAL_HTTPBIN") ? "http://127.0.0.1:8080" : "https://httpbin.org";
@@ -150,6 +215,7 @@ TEST_CASE("Curly")
         std::string response;
         REQUIRE( curly.perform(response) );
         REQUIRE( response.find("barbarbar") != std::string::npos );
+        REQUIRE( response.capacity() - response.size() >= responsePadding );
       }
 
       SECTION("request with redirects")
@@ -168,6 +234,46 @@ TEST_CASE("Curly")
         REQUIRE( curly.perform(response) );
         REQUIRE( curly.getResponseCode() == 302 );
       }
+
+      SECTION("request with compressed response")
+      {
+        Curly curly;
+
+        curly.setURL(httpbin_url + "/gzip");
+        std::string response;
+        REQUIRE( curly.perform(response) );
+        REQUIRE( curly.getResponseCode() == 200 );
+        REQUIRE( response.find("\"gzipped\": true") != std::string::npos );
+        REQUIRE( curly.getDecodedBytes() == response.size() );
+        REQUIRE( curly.getWireBytes() > 0 );
+        REQUIRE( curly.getWireBytes() < curly.getDecodedBytes() );
+      }
+
+      SECTION("request timing")
+      {
+        Curly curly;
+
+        curly.setURL(httpbin_url + "/get");
+        std::string response;
+        REQUIRE( curly.perform(response) );
+        const RequestTiming& timing = curly.getTiming();
+        REQUIRE( timing.total > std::chrono::microseconds::zero() );
+        REQUIRE( timing.firstByte <= timing.total );
+        REQUIRE( timing.nameLookup + timing.connect + timing.tls <= timing.total );
+      }
+
+      SECTION("request exceeds timeout")
+      {
+        using namespace std::chrono_literals;
+        Curly curly;
+
+        curly.setURL(httpbin_url + "/delay/5");
+        curly.setTimeouts(Timeouts{ 10s, 1s, 0s });
+        std::string response;
+        REQUIRE_FALSE( curly.perform(response) );
+        REQUIRE( curly.getTiming().total >= 1s );
+        REQUIRE( curly.getTiming().total < 5s );
+      }
     }
   }
 }
@@ -0,0 +1,73 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for weather-information-collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include "../../../src/net/LatencyHistogram.hpp"
+
+TEST_CASE("LatencyHistogram")
+{
+  using namespace std::chrono_literals;
+
+  SECTION("empty histogram")
+  {
+    const LatencyHistogram histogram;
+    REQUIRE( histogram.count() == 0 );
+    REQUIRE( histogram.average() == 0us );
+    for (const auto c : histogram.buckets())
+    {
+      REQUIRE( c == 0 );
+    }
+  }
+
+  SECTION("add")
+  {
+    LatencyHistogram histogram;
+    histogram.add(10ms);
+    histogram.add(24999us);
+    histogram.add(25ms);
+    histogram.add(400ms);
+    histogram.add(5s);
+    histogram.add(60s);
+
+    REQUIRE( histogram.count() == 6 );
+    const auto& buckets = histogram.buckets();
+    REQUIRE( buckets[0] == 2 );
+    REQUIRE( buckets[1] == 1 );
+    REQUIRE( buckets[4] == 1 );
+    REQUIRE( buckets[LatencyHistogram::bucketCount - 1] == 2 );
+  }
+
+  SECTION("average")
+  {
+    LatencyHistogram histogram;
+    histogram.add(100ms);
+    histogram.add(300ms);
+    REQUIRE( histogram.average() == 200ms );
+  }
+
+  SECTION("toString")
+  {
+    LatencyHistogram histogram;
+    histogram.add(30ms);
+    histogram.add(40ms);
+    histogram.add(6s);
+    REQUIRE( histogram.toString() == "3 request(s), average 2023 ms, < 50 ms: 2, >= 5000 ms: 1" );
+  }
+}
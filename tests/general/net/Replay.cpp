@@ -0,0 +1,137 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "../../find_catch.hpp"
+#include "../../../src/net/Replay.hpp"
+
+TEST_CASE("Replay")
+{
+  SECTION("pattern")
+  {
+    SECTION("URL without query")
+    {
+      REQUIRE( Replay::pattern("https://api.example.com/v1/data") == "api.example.com/v1/data" );
+      REQUIRE( Replay::pattern("/api.example.com/v1/data") == "api.example.com/v1/data" );
+      REQUIRE( Replay::pattern("http://api.example.com/v1/data#top") == "api.example.com/v1/data" );
+    }
+
+    SECTION("values are replaced by the number of items")
+    {
+      REQUIRE( Replay::pattern("https://api.example.com/v1/data?lon=1.5,2.5,3.5&key=secret&lat=1,2,3&flag&empty=")
+               == "api.example.com/v1/data?empty=0&flag&key=1&lat=3&lon=3" );
+    }
+
+    SECTION("same pattern for different locations")
+    {
+      const auto berlin = Replay::pattern("https://api.open-meteo.com/v1/forecast?latitude=52.52&longitude=13.41&current=temperature_2m,rain");
+      const auto paris = Replay::pattern("https://api.open-meteo.com/v1/forecast?current=temperature_2m,rain&latitude=48.85&longitude=2.35");
+      REQUIRE( berlin == paris );
+    }
+
+    SECTION("different pattern for different number of locations")
+    {
+      const auto one = Replay::pattern("https://api.open-meteo.com/v1/forecast?latitude=52.52&longitude=13.41");
+      const auto two = Replay::pattern("https://api.open-meteo.com/v1/forecast?latitude=52.52,48.85&longitude=13.41,2.35");
+      REQUIRE( one != two );
+    }
+
+    SECTION("redirected URL has the pattern of the original URL")
+    {
+      const std::string url = "https://api.example.com/v1/data?lat=1&lon=2";
+      Replay::setRedirect("http://127.0.0.1:8080");
+      const std::string redirected = Replay::redirect(url);
+      Replay::setRedirect("");
+      const auto path = redirected.substr(std::string("http://127.0.0.1:8080").size());
+      REQUIRE( Replay::pattern(path) == Replay::pattern(url) );
+    }
+  }
+
+  SECTION("fileName")
+  {
+    REQUIRE( Replay::fileName("api.example.com/v1/data?key=1&lat=3")
+             == "api.example.com_v1_data_key_1_lat_3.json" );
+
+    SECTION("long patterns get a hash")
+    {
+      const std::string first = "api.example.com/" + std::string(200, 'a') + "?x=1";
+      const std::string second = "api.example.com/" + std::string(200, 'a') + "?y=1";
+      const auto name = Replay::fileName(first);
+      REQUIRE( name.size() <= 160 );
+      REQUIRE( name != Replay::fileName(second) );
+      REQUIRE( name == Replay::fileName(first) );
+    }
+  }
+
+  SECTION("redirect")
+  {
+    REQUIRE( Replay::redirect("https://api.example.com/v1/data?x=1") == "https://api.example.com/v1/data?x=1" );
+
+    Replay::setRedirect("http://127.0.0.1:8080/");
+    REQUIRE( Replay::redirect("https://api.example.com/v1/data?x=1") == "http://127.0.0.1:8080/api.example.com/v1/data?x=1" );
+    REQUIRE( Replay::redirect("http://api.example.com/") == "http://127.0.0.1:8080/api.example.com/" );
+
+    Replay::setRedirect("");
+    REQUIRE( Replay::redirect("https://api.example.com/v1/data?x=1") == "https://api.example.com/v1/data?x=1" );
+  }
+
+  SECTION("record")
+  {
+    const std::string url = "https://api.example.com/v1/data?lat=1&lon=2&key=secret";
+    const auto directory = std::filesystem::temp_directory_path() / "wic-replay-test";
+    std::filesystem::create_directories(directory);
+    const auto path = directory / Replay::fileName(Replay::pattern(url));
+    std::filesystem::remove(path);
+
+    SECTION("recording disabled")
+    {
+      REQUIRE( Replay::record(url, "{}") );
+      REQUIRE_FALSE( std::filesystem::exists(path) );
+    }
+
+    SECTION("recording enabled")
+    {
+      Replay::setRecordDirectory(directory.string());
+      REQUIRE( Replay::record(url, "{\"old\": true}") );
+      REQUIRE( Replay::record(url, "{\"new\": true}") );
+      Replay::setRecordDirectory("");
+
+      REQUIRE( std::filesystem::exists(path) );
+      std::ifstream stream(path, std::ios::in | std::ios::binary);
+      std::ostringstream content;
+      content << stream.rdbuf();
+      REQUIRE( content.str() == "{\"new\": true}" );
+    }
+
+    SECTION("no recording of redirected requests")
+    {
+      Replay::setRecordDirectory(directory.string());
+      Replay::setRedirect("http://127.0.0.1:8080");
+      REQUIRE( Replay::record(url, "{}") );
+      Replay::setRedirect("");
+      Replay::setRecordDirectory("");
+      REQUIRE_FALSE( std::filesystem::exists(path) );
+    }
+
+    std::filesystem::remove_all(directory);
+  }
+}
@@ -24,6 +24,32 @@
 
 TEST_CASE("Request")
 {
+  SECTION("countTraffic")
+  {
+    const TrafficStatistics before = Request::traffic();
+    Request::countTraffic(250, 1000);
+    const TrafficStatistics after = Request::traffic();
+    REQUIRE( after.requests == before.requests + 1 );
+    REQUIRE( after.wireBytes == before.wireBytes + 250 );
+    REQUIRE( after.decodedBytes == before.decodedBytes + 1000 );
+    REQUIRE( after.notModified == before.notModified );
+  }
+
+  SECTION("countNotModified")
+  {
+    const TrafficStatistics before = Request::traffic();
+    Request::countNotModified();
+    const TrafficStatistics after = Request::traffic();
+    REQUIRE( after.requests == before.requests );
+    REQUIRE( after.notModified == before.notModified + 1 );
+  }
+
+  SECTION("resetLastStatusCode")
+  {
+    Request::resetLastStatusCode();
+    REQUIRE( Request::lastStatusCode() == -1 );
+  }
+
   SECTION("get")
   {
     if (!wic::hasEnvVar("SKIP_NETWORK_TESTS"))
@@ -35,18 +61,21 @@ TEST_CASE("Request")
         const auto opt = Request::get(httpbin_url + "/get", "test::sucessful_request");
         REQUIRE( opt.has_value() );
         REQUIRE_FALSE( opt.value().empty() );
+        REQUIRE( Request::lastStatusCode() == 200 );
       }
 
       SECTION("failed request (status 400)")
       {
         const auto opt = Request::get(httpbin_url + "/status/400", "test::failed_request");
         REQUIRE_FALSE( opt.has_value() );
+        REQUIRE( Request::lastStatusCode() == 400 );
       }
 
       SECTION("failed request (request fails)")
       {
         const auto opt = Request::get("https://asdfasdf.asdf/asdf", "test::request_fail");
         REQUIRE_FALSE( opt.has_value() );
+        REQUIRE( Request::lastStatusCode() == 0 );
       }
     }
   }
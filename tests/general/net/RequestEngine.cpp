@@ -0,0 +1,118 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for weather-information-collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <atomic>
+#include <future>
+#include "../../find_catch.hpp"
+#include "../../../src/net/Curly.hpp"
+#include "../../../src/net/RequestEngine.hpp"
+#include "../../../src/util/Environment.hpp"
+
+TEST_CASE("RequestEngine")
+{
+  REQUIRE( Curly::globalInit() );
+
+  SECTION("get after stop fails")
+  {
+    RequestEngine engine(2, true);
+    REQUIRE( engine.good() );
+    engine.stop();
+    REQUIRE_FALSE( engine.get("https://localhost/", "test::after_stop", [](std::optional<std::string>&&) { }) );
+    auto future = engine.get("https://localhost/", "test::after_stop");
+    REQUIRE_FALSE( future.get().has_value() );
+    REQUIRE( engine.pending() == 0 );
+  }
+
+  SECTION("multiplexing can be disabled")
+  {
+    RequestEngine engine(2, false);
+    REQUIRE( engine.good() );
+    REQUIRE_FALSE( engine.multiplexes() );
+  }
+
+  SECTION("get")
+  {
+    if (!wic::hasEnvVar("SKIP_NETWORK_TESTS"))
+    {
+      const std::string httpbin_url = wic::hasEnvVar("USE_LOCAL_HTTPBIN") ? "http://127.0.0.1:8080" : "https://httpbin.org";
+      RequestEngine engine(2, true);
+      REQUIRE( engine.good() );
+
+      SECTION("successful request")
+      {
+        auto future = engine.get(httpbin_url + "/get", "test::sucessful_request");
+        const auto opt = future.get();
+        REQUIRE( opt.has_value() );
+        REQUIRE_FALSE( opt.value().empty() );
+      }
+
+      SECTION("failed request (status 400)")
+      {
+        auto future = engine.get(httpbin_url + "/status/400", "test::failed_request");
+        REQUIRE_FALSE( future.get().has_value() );
+      }
+
+      SECTION("failed request (request fails)")
+      {
+        auto future = engine.get("https://asdfasdf.asdf/asdf", "test::request_fail");
+        REQUIRE_FALSE( future.get().has_value() );
+      }
+
+      SECTION("conditional requests")
+      {
+        RequestEngine::Validators validators;
+        std::promise<RequestEngine::Outcome> first;
+        REQUIRE( engine.getIfChanged(httpbin_url + "/etag/abc", "test::conditional", validators,
+            [&first](const RequestEngine::Outcome outcome, std::string&&, const RequestEngine::TransferInfo& info)
+            {
+              first.set_value(info.timing.total > std::chrono::microseconds::zero() ? outcome : RequestEngine::Outcome::Failed);
+            }) );
+        REQUIRE( first.get_future().get() == RequestEngine::Outcome::Changed );
+        REQUIRE( validators.etag.find("abc") != std::string::npos );
+
+        std::promise<RequestEngine::Outcome> second;
+        REQUIRE( engine.getIfChanged(httpbin_url + "/etag/abc", "test::conditional", validators,
+            [&second](const RequestEngine::Outcome outcome, std::string&& response, const RequestEngine::TransferInfo&)
+            {
+              second.set_value(response.empty() ? outcome : RequestEngine::Outcome::Failed);
+            }) );
+        REQUIRE( second.get_future().get() == RequestEngine::Outcome::Unchanged );
+      }
+
+      SECTION("several requests with callbacks")
+      {
+        std::atomic<int> successes(0);
+        for (int i = 0; i < 5; ++i)
+        {
+          const bool started = engine.get(httpbin_url + "/get", "test::callbacks",
+              [&successes](std::optional<std::string>&& response)
+              {
+                if (response.has_value() && !response.value().empty())
+                  ++successes;
+              });
+          REQUIRE( started );
+        }
+        engine.stop();
+        REQUIRE( engine.pending() == 0 );
+        REQUIRE( successes.load() == 5 );
+      }
+    }
+  }
+}
@@ -0,0 +1,126 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the weather information collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <algorithm>
+#include <set>
+#include "../../../src/tasks/Phases.hpp"
+
+namespace
+{
+
+wic::Task makeTask(const int n, const wic::ApiType api, const std::chrono::seconds& interval)
+{
+  wic::Location loc;
+  loc.setName("Place " + std::to_string(n));
+  loc.setCoordinates(static_cast<float>(n % 90), static_cast<float>(n % 180));
+  return wic::Task(loc, api, wic::DataType::Current, interval);
+}
+
+} // namespace
+
+TEST_CASE("Phases")
+{
+  using namespace wic;
+  using namespace std::chrono_literals;
+
+  SECTION("no tasks")
+  {
+    const std::vector<Task> tasks;
+    REQUIRE( Phases::offsets(tasks).empty() );
+    REQUIRE( Phases::rates(tasks, Phases::offsets(tasks)).empty() );
+  }
+
+  SECTION("offsets are within the interval")
+  {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 100; ++i)
+    {
+      tasks.push_back(makeTask(i, ApiType::OpenMeteo, std::chrono::seconds(60 + 30 * (i % 4))));
+    }
+    const auto offsets = Phases::offsets(tasks);
+    REQUIRE( offsets.size() == tasks.size() );
+    for (std::size_t i = 0; i < tasks.size(); ++i)
+    {
+      REQUIRE( offsets[i] >= 0s );
+      REQUIRE( offsets[i] < tasks[i].interval() );
+    }
+  }
+
+  SECTION("tasks with same interval get distinct offsets")
+  {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 60; ++i)
+    {
+      tasks.push_back(makeTask(i, i % 2 == 0 ? ApiType::OpenMeteo : ApiType::Weatherbit, 120s));
+    }
+    const auto offsets = Phases::offsets(tasks);
+    const std::set<std::chrono::seconds> distinct(offsets.begin(), offsets.end());
+    REQUIRE( distinct.size() == tasks.size() );
+    // Slots are two seconds apart.
+    for (const auto& offset : offsets)
+    {
+      REQUIRE( offset.count() % 2 == 0 );
+    }
+  }
+
+  SECTION("offsets do not depend on task order")
+  {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 20; ++i)
+    {
+      tasks.push_back(makeTask(i, ApiType::OpenMeteo, 300s));
+    }
+    const auto offsets = Phases::offsets(tasks);
+
+    std::vector<Task> reversed(tasks.rbegin(), tasks.rend());
+    const auto offsetsReversed = Phases::offsets(reversed);
+    for (std::size_t i = 0; i < tasks.size(); ++i)
+    {
+      REQUIRE( offsets[i] == offsetsReversed[tasks.size() - 1 - i] );
+    }
+  }
+
+  SECTION("rates show lower peak than unstaggered start")
+  {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 30; ++i)
+    {
+      tasks.push_back(makeTask(i, ApiType::OpenMeteo, 60s));
+    }
+    tasks.push_back(makeTask(100, ApiType::Weatherbit, 900s));
+    tasks.push_back(makeTask(101, ApiType::Weatherbit, 900s));
+
+    const auto rates = Phases::rates(tasks, Phases::offsets(tasks));
+    REQUIRE( rates.size() == 2 );
+    const auto& meteo = rates[0].api == ApiType::OpenMeteo ? rates[0] : rates[1];
+    const auto& bit = rates[0].api == ApiType::OpenMeteo ? rates[1] : rates[0];
+
+    REQUIRE( meteo.tasks == 30 );
+    REQUIRE( meteo.average > 0.499 );
+    REQUIRE( meteo.average < 0.501 );
+    REQUIRE( meteo.unstaggeredPeak == 30 );
+    REQUIRE( meteo.peak == 1 );
+
+    REQUIRE( bit.tasks == 2 );
+    REQUIRE( bit.unstaggeredPeak == 2 );
+    REQUIRE( bit.peak == 1 );
+  }
+}
@@ -86,6 +86,84 @@ TEST_CASE("Class TaskManager")
   }
 
 
+  SECTION("coalesce")
+  {
+    std::vector<Task> tasks;
+
+    Location loc2;
+    loc2.setName("Paris");
+    loc2.setCoordinates(48.86f, 2.35f);
+
+    SECTION("empty task list")
+    {
+      REQUIRE( TaskManager::coalesce(tasks, PlanWeatherbit::Free, PlanWeatherstack::Free) == 0 );
+      REQUIRE( tasks.empty() );
+    }
+
+    SECTION("current and forecast tasks of same location are merged")
+    {
+      tasks.push_back(Task(loc, ApiType::OpenMeteo, DataType::Current, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc2, ApiType::DarkSky, DataType::Forecast, std::chrono::seconds(3600)));
+      tasks.push_back(Task(loc, ApiType::OpenMeteo, DataType::Forecast, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc2, ApiType::DarkSky, DataType::Current, std::chrono::seconds(3600)));
+
+      REQUIRE( TaskManager::coalesce(tasks, PlanWeatherbit::Free, PlanWeatherstack::Free) == 2 );
+      REQUIRE( tasks.size() == 2 );
+      REQUIRE( tasks[0].location() == loc );
+      REQUIRE( tasks[0].api() == ApiType::OpenMeteo );
+      REQUIRE( tasks[0].data() == DataType::CurrentAndForecast );
+      REQUIRE( tasks[0].interval() == std::chrono::seconds(900) );
+      REQUIRE( tasks[1].location() == loc2 );
+      REQUIRE( tasks[1].api() == ApiType::DarkSky );
+      REQUIRE( tasks[1].data() == DataType::CurrentAndForecast );
+      REQUIRE( tasks[1].interval() == std::chrono::seconds(3600) );
+    }
+
+    SECTION("tasks with different intervals are not merged")
+    {
+      tasks.push_back(Task(loc, ApiType::OpenMeteo, DataType::Current, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc, ApiType::OpenMeteo, DataType::Forecast, std::chrono::seconds(1800)));
+
+      REQUIRE( TaskManager::coalesce(tasks, PlanWeatherbit::Free, PlanWeatherstack::Free) == 0 );
+      REQUIRE( tasks.size() == 2 );
+    }
+
+    SECTION("tasks with different locations or APIs are not merged")
+    {
+      tasks.push_back(Task(loc, ApiType::OpenMeteo, DataType::Current, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc2, ApiType::OpenMeteo, DataType::Forecast, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc, ApiType::DarkSky, DataType::Forecast, std::chrono::seconds(900)));
+
+      REQUIRE( TaskManager::coalesce(tasks, PlanWeatherbit::Free, PlanWeatherstack::Free) == 0 );
+      REQUIRE( tasks.size() == 3 );
+    }
+
+    SECTION("tasks are not merged, if API cannot request both at once")
+    {
+      tasks.push_back(Task(loc, ApiType::OpenWeatherMap, DataType::Current, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc, ApiType::OpenWeatherMap, DataType::Forecast, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc, ApiType::Weatherbit, DataType::Current, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc, ApiType::Weatherbit, DataType::Forecast, std::chrono::seconds(900)));
+
+      REQUIRE( TaskManager::coalesce(tasks, PlanWeatherbit::Free, PlanWeatherstack::Free) == 0 );
+      REQUIRE( tasks.size() == 4 );
+    }
+
+    SECTION("tasks are not merged, if combined data is no single request")
+    {
+      // Apixu supports combined data, but it is not one of the APIs that
+      // return the current weather with the forecast at no extra cost.
+      tasks.push_back(Task(loc, ApiType::Apixu, DataType::Current, std::chrono::seconds(900)));
+      tasks.push_back(Task(loc, ApiType::Apixu, DataType::Forecast, std::chrono::seconds(900)));
+
+      REQUIRE( TaskManager::coalesce(tasks, PlanWeatherbit::Free, PlanWeatherstack::Free) == 0 );
+      REQUIRE( tasks.size() == 2 );
+      REQUIRE( tasks[0].data() == DataType::Current );
+      REQUIRE( tasks[1].data() == DataType::Forecast );
+    }
+  }
+
+
   SECTION("withinLimit")
   {
     std::vector<Task> tasks;
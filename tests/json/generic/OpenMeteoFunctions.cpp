@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,7 @@
 #include "../../find_catch.hpp"
 #include <limits>
 #include "../../../src/json/OpenMeteoFunctions.hpp"
+#include "../../../src/util/NumericPrecision.hpp"
 
 TEST_CASE("OpenMeteoFunctions")
 {
@@ -94,4 +95,164 @@ TEST_CASE("OpenMeteoFunctions")
       REQUIRE( tm.tm_min == 23 );
     }
   }
+
+  SECTION("unixTimeToTime")
+  {
+    SECTION("same results as isoStringToTime")
+    {
+      // 2022-10-18T23:45 UTC
+      REQUIRE( unixTimeToTime(1666136700, 0) == isoStringToTime("2022-10-18T23:45") );
+      // UTC offset of +02:00 moves the local time to the next day.
+      REQUIRE( unixTimeToTime(1666136700, 7200) == isoStringToTime("2022-10-19T01:45") );
+      // UTC offset of -04:00
+      REQUIRE( unixTimeToTime(1666136700, -14400) == isoStringToTime("2022-10-18T19:45") );
+      // end of February in a leap year
+      REQUIRE( unixTimeToTime(1709164800, 3600) == isoStringToTime("2024-02-29T01:00") );
+      REQUIRE( unixTimeToTime(1709251200, 0) == isoStringToTime("2024-03-01T00:00") );
+      // end of year
+      REQUIRE( unixTimeToTime(1703980800, 86340) == isoStringToTime("2023-12-31T23:59") );
+    }
+  }
+
+  SECTION("HourlyTimeDecoder")
+  {
+    SECTION("invalid data")
+    {
+      HourlyTimeDecoder decoder;
+      REQUIRE_FALSE( decoder.decode("").has_value() );
+      REQUIRE_FALSE( decoder.decode("2022/10/18T23:45").has_value() );
+      REQUIRE_FALSE( decoder.decode("2022-1X-18T23:45").has_value() );
+      REQUIRE_FALSE( decoder.decode("2022-10-18T23:45:00").has_value() );
+    }
+
+    SECTION("invalid data after valid data")
+    {
+      HourlyTimeDecoder decoder;
+      REQUIRE( decoder.decode("2022-10-18T22:00").has_value() );
+      REQUIRE_FALSE( decoder.decode("2022-10-18T2X:00").has_value() );
+      REQUIRE( decoder.decode("2022-10-18T23:00") == isoStringToTime("2022-10-18T23:00") );
+    }
+
+    SECTION("same results as isoStringToTime")
+    {
+      // Covers both changes of daylight saving time in 2022 in Europe.
+      const std::vector<std::string> days = { "2022-03-26", "2022-03-27", "2022-03-28",
+                                              "2022-10-29", "2022-10-30", "2022-10-31" };
+      HourlyTimeDecoder decoder;
+      for (const auto& day: days)
+      {
+        for (int hour = 0; hour < 24; ++hour)
+        {
+          const std::string value = day + (hour < 10 ? "T0" : "T") + std::to_string(hour) + ":00";
+          const auto expected = isoStringToTime(value);
+          REQUIRE( expected.has_value() );
+          REQUIRE( decoder.decode(value) == expected );
+        }
+      }
+    }
+
+    SECTION("same results for Unix time as unixTimeToTime")
+    {
+      // Covers both changes of daylight saving time in 2022 in Europe.
+      const std::vector<int64_t> dayStarts = { 1648252800, 1666998000 };
+      for (const int64_t offset: { 0, 3600, -14400 })
+      {
+        HourlyTimeDecoder decoder;
+        for (const int64_t start: dayStarts)
+        {
+          for (int64_t hour = 0; hour < 72; ++hour)
+          {
+            const int64_t seconds = start + hour * 3600;
+            const auto expected = unixTimeToTime(seconds, offset);
+            REQUIRE( expected.has_value() );
+            REQUIRE( decoder.decode(seconds, offset) == expected );
+          }
+        }
+      }
+    }
+  }
+
+  SECTION("celsiusToFahrenheit")
+  {
+    const std::vector<double> celsius = { -40.0, 0.0, 100.0 };
+    std::vector<float> fahrenheit;
+    celsiusToFahrenheit(celsius, fahrenheit);
+    REQUIRE( fahrenheit.size() == 3 );
+    REQUIRE( fahrenheit[0] == -40.0f );
+    REQUIRE( fahrenheit[1] == 32.0f );
+    REQUIRE( fahrenheit[2] == 212.0f );
+
+    celsiusToFahrenheit({ }, fahrenheit);
+    REQUIRE( fahrenheit.empty() );
+  }
+
+  SECTION("celsiusToKelvin")
+  {
+    const std::vector<double> celsius = { -273.15, 0.0 };
+    std::vector<float> kelvin;
+    celsiusToKelvin(celsius, kelvin);
+    REQUIRE( kelvin.size() == 2 );
+    REQUIRE( kelvin[0] == 0.0f );
+    REQUIRE( kelvin[1] == 273.15f );
+  }
+
+  SECTION("snowfallToSnow")
+  {
+    const std::vector<double> snowfall = { 0.0, 0.7, 1.4 };
+    std::vector<float> snow;
+    snowfallToSnow(snowfall, snow);
+    REQUIRE( snow.size() == 3 );
+    REQUIRE( snow[0] == 0.0f );
+    REQUIRE( snow[1] == 1.0f );
+    REQUIRE( snow[2] == 2.0f );
+  }
+
+  SECTION("enforcePrecision")
+  {
+    std::vector<float> values = { 6.9999999f, 1.23456f, 2.5f, -3.0001f };
+    enforcePrecision(values);
+    REQUIRE( values.size() == 4 );
+    REQUIRE( values[0] == 7.0f );
+    REQUIRE( values[1] == NumericPrecision<float>::enforce(1.23456f) );
+    REQUIRE( values[2] == 2.5f );
+    REQUIRE( values[3] == -3.0f );
+  }
+
+  SECTION("setHourlyData")
+  {
+    OpenMeteoHourlyColumns columns;
+    columns.temperature = { 17.7, -2.5 };
+    columns.humidity = { 61, 95 };
+    columns.rain = { 0.3, 0.0 };
+    columns.snowfall = { 0.0, 0.7 };
+    columns.pressure = { 1015.2, 998.7 };
+    columns.cloudCover = { 12, 100 };
+    columns.windSpeed = { 2.5, 7.1 };
+    columns.windDirection = { 250, 5 };
+
+    std::vector<Weather> data(2);
+    setHourlyData(columns, data);
+
+    REQUIRE( data[0].temperatureCelsius() == 17.7f );
+    REQUIRE( data[0].temperatureFahrenheit() == 63.86f );
+    REQUIRE( data[0].temperatureKelvin() == 290.85f );
+    REQUIRE( data[0].humidity() == 61 );
+    REQUIRE( data[0].rain() == 0.3f );
+    REQUIRE( data[0].snow() == 0.0f );
+    REQUIRE( data[0].pressure() == 1015 );
+    REQUIRE( data[0].cloudiness() == 12 );
+    REQUIRE( data[0].windSpeed() == 2.5f );
+    REQUIRE( data[0].windDegrees() == 250 );
+
+    REQUIRE( data[1].temperatureCelsius() == -2.5f );
+    REQUIRE( data[1].temperatureFahrenheit() == 27.5f );
+    REQUIRE( data[1].temperatureKelvin() == 270.65f );
+    REQUIRE( data[1].humidity() == 95 );
+    REQUIRE( data[1].rain() == 0.0f );
+    REQUIRE( data[1].snow() == 1.0f );
+    REQUIRE( data[1].pressure() == 998 );
+    REQUIRE( data[1].cloudiness() == 100 );
+    REQUIRE( data[1].windSpeed() == 7.1f );
+    REQUIRE( data[1].windDegrees() == 5 );
+  }
 }
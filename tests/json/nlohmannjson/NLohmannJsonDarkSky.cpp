@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -799,4 +799,145 @@ TEST_CASE("NLohmannJsonDarkSky")
       REQUIRE( forecast.data()[1].cloudiness() == 30 );
     }
   }
+
+  SECTION("parseCurrentAndForecast")
+  {
+    Weather weather;
+    Forecast forecast;
+
+    SECTION("not valid JSON")
+    {
+      const std::string json = "{ \"this\": 'is not valid, JSON: true";
+      REQUIRE_FALSE( NLohmannJsonDarkSky::parseCurrentAndForecast(json, weather, forecast) );
+    }
+
+    SECTION("empty JSON object")
+    {
+      REQUIRE_FALSE( NLohmannJsonDarkSky::parseCurrentAndForecast("{ }", weather, forecast) );
+    }
+
+    SECTION("no 'hourly' element")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 37.8267,
+        "longitude": -122.4233,
+        "timezone": "America/Los_Angeles",
+        "currently":
+        {
+          "time": 1529851404,
+          "precipIntensity": 0,
+          "temperature": 15.15,
+          "humidity": 0.83,
+          "pressure": 1009.82
+        },
+        "offset": -7
+      }
+      )json";
+      REQUIRE_FALSE( NLohmannJsonDarkSky::parseCurrentAndForecast(json, weather, forecast) );
+    }
+
+    SECTION("successful parsing")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 37.8267,
+        "longitude": -122.4233,
+        "timezone": "America/Los_Angeles",
+        "currently":
+        {
+          "time": 1529851404,
+          "summary": "Clear",
+          "icon": "clear-day",
+          "nearestStormDistance": 399,
+          "nearestStormBearing": 154,
+          "precipIntensity": 0,
+          "precipProbability": 0,
+          "temperature": 15.15,
+          "apparentTemperature": 15.15,
+          "dewPoint": 12.33,
+          "humidity": 0.83,
+          "pressure": 1009.82,
+          "windSpeed": 2.46,
+          "windGust": 4.56,
+          "windBearing": 245,
+          "cloudCover": 0.14,
+          "uvIndex": 1,
+          "visibility": 15.98,
+          "ozone": 300.84
+        },
+        "hourly":
+        {
+          "summary": "Mostly cloudy starting this evening.",
+          "icon": "partly-cloudy-night",
+          "data": [
+            {
+              "time": 1533402000,
+              "summary": "Partly Cloudy",
+              "icon": "partly-cloudy-day",
+              "precipIntensity": 0.0686,
+              "precipProbability": 0.02,
+              "precipType": "rain",
+              "temperature": 31.18,
+              "apparentTemperature": 31.18,
+              "dewPoint": 14.78,
+              "humidity": 0.37,
+              "pressure": 1015.28,
+              "windSpeed": 3.1,
+              "windGust": 4.37,
+              "windBearing": 320,
+              "cloudCover": 0.34,
+              "uvIndex": 1,
+              "visibility": 12.67,
+              "ozone": 290.85
+            },
+            {
+              "time": 1533405600,
+              "summary": "Partly Cloudy",
+              "icon": "partly-cloudy-day",
+              "precipIntensity": 0.0508,
+              "precipProbability": 0.02,
+              "precipType": "rain",
+              "temperature": 29.51,
+              "apparentTemperature": 29.51,
+              "dewPoint": 15.69,
+              "humidity": 0.43,
+              "pressure": 1015.46,
+              "windSpeed": 2.53,
+              "windGust": 4.99,
+              "windBearing": 345,
+              "cloudCover": 0.3,
+              "uvIndex": 0,
+              "visibility": 16.09,
+              "ozone": 290.69
+            }
+          ]
+        },
+        "flags":
+        {
+          "sources": ["nearest-precip","nwspa","cmc","gfs","hrrr","icon","isd","madis","nam","sref","darksky"],
+          "nearest-station": 2.96,
+          "units": "si"
+        },
+        "offset": -7
+      }
+      )json";
+      REQUIRE( NLohmannJsonDarkSky::parseCurrentAndForecast(json, weather, forecast) );
+      // Check current weather.
+      REQUIRE( weather.dataTime() == std::chrono::time_point<std::chrono::system_clock>(std::chrono::seconds(1529851404)) );
+      REQUIRE( weather.temperatureCelsius() == 15.15f );
+      REQUIRE( weather.humidity() == 83 );
+      REQUIRE( weather.pressure() == 1010 );
+      REQUIRE( weather.windSpeed() == 2.46f );
+      REQUIRE( weather.windDegrees() == 245 );
+      REQUIRE( weather.cloudiness() == 14 );
+      // Check forecast.
+      REQUIRE( forecast.data().size() == 2 );
+      REQUIRE( forecast.data()[0].temperatureCelsius() == 31.18f );
+      REQUIRE( forecast.data()[1].temperatureCelsius() == 29.51f );
+      // Both objects share the same JSON data.
+      REQUIRE( weather.json() == json );
+      REQUIRE( &weather.json() == &forecast.json() );
+    }
+  }
 }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,6 +23,7 @@
 #include <chrono>
 #include <ctime>
 #include <stdexcept>
+#include <vector>
 
 std::chrono::system_clock::time_point toOpenMeteoTime(const int year, const int month, const int day, const int hours, const int minutes)
 {
@@ -109,6 +110,94 @@ TEST_CASE("Class SimdJsonOpenMeteo")
       REQUIRE_FALSE( weather.hasCloudiness() );
     }
 
+    SECTION("successful parsing with Unix time")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.419998,
+        "generationtime_ms": 0.3770589828491211,
+        "utc_offset_seconds": 0,
+        "timezone": "GMT",
+        "timezone_abbreviation": "GMT",
+        "elevation": 38,
+        "current_weather": {
+          "temperature": 16.8,
+          "windspeed": 8.2,
+          "winddirection": 105,
+          "weathercode": 61,
+          "time": 1662642000
+        }
+      }
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentWeather(json, weather) );
+      // Check data.
+      REQUIRE( weather.dataTime() == toOpenMeteoTime(2022, 9, 8, 13, 0) );
+      REQUIRE( weather.temperatureCelsius() == 16.8f );
+      REQUIRE( weather.windSpeed() == 8.2f );
+      REQUIRE( weather.windDegrees() == 105 );
+    }
+
+    SECTION("same time with ISO 8601 and Unix time for non-zero UTC offset")
+    {
+      // 15:00 in Berlin is 13:00 UTC in summer.
+      const std::string iso_json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.419998,
+        "utc_offset_seconds": 7200,
+        "timezone": "Europe/Berlin",
+        "timezone_abbreviation": "CEST",
+        "current_weather": {
+          "temperature": 16.8,
+          "windspeed": 8.2,
+          "winddirection": 105,
+          "weathercode": 61,
+          "time": "2022-09-08T15:00"
+        }
+      }
+      )json";
+      const std::string unix_json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.419998,
+        "utc_offset_seconds": 7200,
+        "timezone": "Europe/Berlin",
+        "timezone_abbreviation": "CEST",
+        "current_weather": {
+          "temperature": 16.8,
+          "windspeed": 8.2,
+          "winddirection": 105,
+          "weathercode": 61,
+          "time": 1662642000
+        }
+      }
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentWeather(iso_json, weather) );
+      const auto expected = weather.dataTime();
+      REQUIRE( expected == toOpenMeteoTime(2022, 9, 8, 15, 0) );
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentWeather(unix_json, weather) );
+      REQUIRE( weather.dataTime() == expected );
+    }
+
+    SECTION("failure: UTC offset is missing with Unix time")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.419998,
+        "current_weather": {
+          "temperature": 16.8,
+          "windspeed": 8.2,
+          "winddirection": 105,
+          "weathercode": 61,
+          "time": 1662642000
+        }
+      }
+      )json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentWeather(json, weather) );
+    }
+
     SECTION("successful parsing with float as winddirection")
     {
       const std::string json = R"json(
@@ -335,7 +424,7 @@ TEST_CASE("Class SimdJsonOpenMeteo")
       REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentWeather(json, weather) );
     }
 
-    SECTION("failure: time is not a string")
+    SECTION("failure: time is neither a string nor an integer")
     {
       const std::string json = R"json(
       {
@@ -351,7 +440,7 @@ TEST_CASE("Class SimdJsonOpenMeteo")
           "windspeed": 8.2,
           "winddirection": 105,
           "weathercode": 61,
-          "time": 1234
+          "time": true
         }
       }
       )json";
@@ -583,7 +672,185 @@ TEST_CASE("Class SimdJsonOpenMeteo")
       REQUIRE( forecast.data()[4].cloudiness() == 1 );
     }
 
-    SECTION("wrong time unit causes failure")
+    SECTION("successful parsing with Unix time")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.419998,
+        "generationtime_ms": 1.1960268020629883,
+        "utc_offset_seconds": 0,
+        "timezone": "GMT",
+        "timezone_abbreviation": "GMT",
+        "elevation": 38,
+        "hourly_units": {
+          "time": "unixtime",
+          "temperature_2m": "°C",
+          "relativehumidity_2m": "%",
+          "precipitation": "mm",
+          "rain": "mm",
+          "showers": "mm",
+          "snowfall": "cm",
+          "pressure_msl": "hPa",
+          "surface_pressure": "hPa",
+          "cloudcover": "%",
+          "windspeed_10m": "m/s",
+          "winddirection_10m": "°"
+        },
+        "hourly": {
+          "time": [ 1662595200, 1662598800, 1662602400 ],
+          "temperature_2m": [ 17.7, 17.1, 16.6 ],
+          "relativehumidity_2m": [ 61, 61, 62 ],
+          "precipitation": [ 0, 0.3, 0.1 ],
+          "rain": [ 0, 0.1, 1.1 ],
+          "snowfall": [ 0, 0, 0.7 ],
+          "pressure_msl": [ 1012.1, 1011.5, 1011.3 ],
+          "surface_pressure": [ 1007.6, 1007, 1006.8 ],
+          "cloudcover": [ 100, 99, 93 ],
+          "windspeed_10m": [ 2.62, 2.9, 2.4 ],
+          "winddirection_10m": [ 108, 90, 88 ]
+        }
+      }
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseForecast(json, forecast) );
+      // Check data.
+      REQUIRE( forecast.data().size() == 3 );
+      REQUIRE( forecast.data()[0].dataTime() == toOpenMeteoTime(2022, 9, 8, 0, 0) );
+      REQUIRE( forecast.data()[0].temperatureCelsius() == 17.7f );
+      REQUIRE( forecast.data()[0].humidity() == 61 );
+      REQUIRE( forecast.data()[1].dataTime() == toOpenMeteoTime(2022, 9, 8, 1, 0) );
+      REQUIRE( forecast.data()[1].rain() == 0.1f );
+      REQUIRE( forecast.data()[2].dataTime() == toOpenMeteoTime(2022, 9, 8, 2, 0) );
+      REQUIRE( forecast.data()[2].snow() == 1.0f );
+      REQUIRE( forecast.data()[2].windDegrees() == 88 );
+    }
+
+    SECTION("same time with ISO 8601 and Unix time for non-zero UTC offset")
+    {
+      // 20:00 in New York is 00:00 UTC of the next day in summer.
+      const std::string iso_json = R"json(
+      {
+        "latitude": 39.875,
+        "longitude": -79.0,
+        "utc_offset_seconds": -14400,
+        "timezone": "America/New_York",
+        "timezone_abbreviation": "EDT",
+        "hourly_units": {
+          "time": "iso8601",
+          "temperature_2m": "°C",
+          "relativehumidity_2m": "%",
+          "precipitation": "mm",
+          "rain": "mm",
+          "showers": "mm",
+          "snowfall": "cm",
+          "pressure_msl": "hPa",
+          "surface_pressure": "hPa",
+          "cloudcover": "%",
+          "windspeed_10m": "m/s",
+          "winddirection_10m": "°"
+        },
+        "hourly": {
+          "time": [ "2022-09-07T20:00", "2022-09-07T21:00" ],
+          "temperature_2m": [ 17.7, 17.1 ],
+          "relativehumidity_2m": [ 61, 61 ],
+          "precipitation": [ 0, 0.3 ],
+          "rain": [ 0, 0.1 ],
+          "snowfall": [ 0, 0 ],
+          "pressure_msl": [ 1012.1, 1011.5 ],
+          "surface_pressure": [ 1007.6, 1007 ],
+          "cloudcover": [ 100, 99 ],
+          "windspeed_10m": [ 2.62, 2.9 ],
+          "winddirection_10m": [ 108, 90 ]
+        }
+      }
+      )json";
+      const std::string unix_json = R"json(
+      {
+        "latitude": 39.875,
+        "longitude": -79.0,
+        "utc_offset_seconds": -14400,
+        "timezone": "America/New_York",
+        "timezone_abbreviation": "EDT",
+        "hourly_units": {
+          "time": "unixtime",
+          "temperature_2m": "°C",
+          "relativehumidity_2m": "%",
+          "precipitation": "mm",
+          "rain": "mm",
+          "showers": "mm",
+          "snowfall": "cm",
+          "pressure_msl": "hPa",
+          "surface_pressure": "hPa",
+          "cloudcover": "%",
+          "windspeed_10m": "m/s",
+          "winddirection_10m": "°"
+        },
+        "hourly": {
+          "time": [ 1662595200, 1662598800 ],
+          "temperature_2m": [ 17.7, 17.1 ],
+          "relativehumidity_2m": [ 61, 61 ],
+          "precipitation": [ 0, 0.3 ],
+          "rain": [ 0, 0.1 ],
+          "snowfall": [ 0, 0 ],
+          "pressure_msl": [ 1012.1, 1011.5 ],
+          "surface_pressure": [ 1007.6, 1007 ],
+          "cloudcover": [ 100, 99 ],
+          "windspeed_10m": [ 2.62, 2.9 ],
+          "winddirection_10m": [ 108, 90 ]
+        }
+      }
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseForecast(iso_json, forecast) );
+      REQUIRE( forecast.data().size() == 2 );
+      const auto expected_first = forecast.data()[0].dataTime();
+      const auto expected_second = forecast.data()[1].dataTime();
+      REQUIRE( expected_first == toOpenMeteoTime(2022, 9, 7, 20, 0) );
+      REQUIRE( expected_second == toOpenMeteoTime(2022, 9, 7, 21, 0) );
+      REQUIRE( SimdJsonOpenMeteo::parseForecast(unix_json, forecast) );
+      REQUIRE( forecast.data().size() == 2 );
+      REQUIRE( forecast.data()[0].dataTime() == expected_first );
+      REQUIRE( forecast.data()[1].dataTime() == expected_second );
+    }
+
+    SECTION("failure: UTC offset is missing with Unix time")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 39.875,
+        "longitude": -79.0,
+        "hourly_units": {
+          "time": "unixtime",
+          "temperature_2m": "°C",
+          "relativehumidity_2m": "%",
+          "precipitation": "mm",
+          "rain": "mm",
+          "showers": "mm",
+          "snowfall": "cm",
+          "pressure_msl": "hPa",
+          "surface_pressure": "hPa",
+          "cloudcover": "%",
+          "windspeed_10m": "m/s",
+          "winddirection_10m": "°"
+        },
+        "hourly": {
+          "time": [ 1662595200, 1662598800 ],
+          "temperature_2m": [ 17.7, 17.1 ],
+          "relativehumidity_2m": [ 61, 61 ],
+          "precipitation": [ 0, 0.3 ],
+          "rain": [ 0, 0.1 ],
+          "snowfall": [ 0, 0 ],
+          "pressure_msl": [ 1012.1, 1011.5 ],
+          "surface_pressure": [ 1007.6, 1007 ],
+          "cloudcover": [ 100, 99 ],
+          "windspeed_10m": [ 2.62, 2.9 ],
+          "winddirection_10m": [ 108, 90 ]
+        }
+      }
+      )json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseForecast(json, forecast) );
+    }
+
+    SECTION("failure: time array's element is not an integer with Unix time")
     {
       const std::string json = R"json(
       {
@@ -608,6 +875,49 @@ TEST_CASE("Class SimdJsonOpenMeteo")
           "windspeed_10m": "m/s",
           "winddirection_10m": "°"
         },
+        "hourly": {
+          "time": [ 1662595200, "2022-09-08T01:00" ],
+          "temperature_2m": [ 17.7, 17.1 ],
+          "relativehumidity_2m": [ 61, 61 ],
+          "precipitation": [ 0, 0.3 ],
+          "rain": [ 0, 0.1 ],
+          "snowfall": [ 0, 0 ],
+          "pressure_msl": [ 1012.1, 1011.5 ],
+          "surface_pressure": [ 1007.6, 1007 ],
+          "cloudcover": [ 100, 99 ],
+          "windspeed_10m": [ 2.62, 2.9 ],
+          "winddirection_10m": [ 108, 90 ]
+        }
+      }
+      )json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseForecast(json, forecast) );
+    }
+
+    SECTION("wrong time unit causes failure")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.419998,
+        "generationtime_ms": 1.1960268020629883,
+        "utc_offset_seconds": 0,
+        "timezone": "GMT",
+        "timezone_abbreviation": "GMT",
+        "elevation": 38,
+        "hourly_units": {
+          "time": "rfc1123",
+          "temperature_2m": "°C",
+          "relativehumidity_2m": "%",
+          "precipitation": "mm",
+          "rain": "mm",
+          "showers": "mm",
+          "snowfall": "cm",
+          "pressure_msl": "hPa",
+          "surface_pressure": "hPa",
+          "cloudcover": "%",
+          "windspeed_10m": "m/s",
+          "winddirection_10m": "°"
+        },
         "hourly": {
           "time": [
             "2022-09-08T00:00", "2022-09-08T01:00", "2022-09-08T02:00", "2022-09-08T03:00", "2022-09-08T04:00"
@@ -3198,6 +3508,308 @@ TEST_CASE("Class SimdJsonOpenMeteo")
     }
   }
 
+  SECTION("parseCurrentWeatherBatch")
+  {
+    std::vector<Weather> weather;
+
+    SECTION("not valid JSON")
+    {
+      const std::string json = "[ { \"this\": 'is not valid, JSON: true";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentWeatherBatch(json, weather) );
+    }
+
+    SECTION("array with one invalid element")
+    {
+      const std::string json = R"json([ { "current_weather": { "temperature": 16.8, "windspeed": 8.2, "winddirection": 105, "time": "2022-09-08T13:00" } }, { } ])json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentWeatherBatch(json, weather) );
+    }
+
+    SECTION("successful parsing of single location")
+    {
+      const std::string json = R"json({ "latitude": 52.52, "longitude": 13.42, "current_weather": { "temperature": 16.8, "windspeed": 8.2, "winddirection": 105, "weathercode": 61, "time": "2022-09-08T13:00" } })json";
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentWeatherBatch(json, weather) );
+      REQUIRE( weather.size() == 1 );
+      REQUIRE( weather[0].dataTime() == toOpenMeteoTime(2022, 9, 8, 13, 0) );
+      REQUIRE( weather[0].temperatureCelsius() == 16.8f );
+      REQUIRE( weather[0].json() == json );
+    }
+
+    SECTION("successful parsing of several locations")
+    {
+      const std::string json = R"json(
+      [
+        {
+          "latitude": 52.52,
+          "longitude": 13.42,
+          "current_weather": { "temperature": 16.8, "windspeed": 8.2, "winddirection": 105, "weathercode": 61, "time": "2022-09-08T13:00" }
+        },
+        {
+          "latitude": 48.86,
+          "longitude": 2.35,
+          "current_weather": { "temperature": 21.5, "windspeed": 3.1, "winddirection": 270, "weathercode": 0, "time": "2022-09-08T14:00" }
+        }
+      ]
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentWeatherBatch(json, weather) );
+      REQUIRE( weather.size() == 2 );
+      REQUIRE( weather[0].dataTime() == toOpenMeteoTime(2022, 9, 8, 13, 0) );
+      REQUIRE( weather[0].temperatureCelsius() == 16.8f );
+      REQUIRE( weather[0].windSpeed() == 8.2f );
+      REQUIRE( weather[0].windDegrees() == 105 );
+      REQUIRE( weather[0].json().find("52.52") != std::string::npos );
+      REQUIRE( weather[0].json().find("48.86") == std::string::npos );
+      REQUIRE( weather[1].dataTime() == toOpenMeteoTime(2022, 9, 8, 14, 0) );
+      REQUIRE( weather[1].temperatureCelsius() == 21.5f );
+      REQUIRE( weather[1].windSpeed() == 3.1f );
+      REQUIRE( weather[1].windDegrees() == 270 );
+      REQUIRE( weather[1].json().find("48.86") != std::string::npos );
+      REQUIRE( weather[1].json().find("52.52") == std::string::npos );
+    }
+  }
+
+  SECTION("parseForecastBatch")
+  {
+    std::vector<Forecast> forecasts;
+
+    SECTION("not valid JSON")
+    {
+      const std::string json = "[ { \"this\": 'is not valid, JSON: true";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseForecastBatch(json, forecasts) );
+    }
+
+    SECTION("successful parsing of several locations")
+    {
+      const std::string json = R"json(
+      [
+        {
+          "latitude": 52.52,
+          "longitude": 13.42,
+          "hourly_units": { "time": "iso8601", "temperature_2m": "°C", "relativehumidity_2m": "%", "precipitation": "mm", "rain": "mm", "showers": "mm", "snowfall": "cm", "pressure_msl": "hPa", "surface_pressure": "hPa", "cloudcover": "%", "windspeed_10m": "m/s", "winddirection_10m": "°" },
+          "hourly": {
+            "time": [ "2022-09-08T00:00", "2022-09-08T01:00" ],
+            "temperature_2m": [ 17.7, 17.1 ],
+            "relativehumidity_2m": [ 61, 62 ],
+            "precipitation": [ 0, 0.3 ],
+            "rain": [ 0, 0.1 ],
+            "showers": [ 0, 0.2 ],
+            "snowfall": [ 0, 0 ],
+            "pressure_msl": [ 1011.3, 1011.2 ],
+            "surface_pressure": [ 1006.6, 1006.5 ],
+            "cloudcover": [ 100, 96 ],
+            "windspeed_10m": [ 2.42, 2.66 ],
+            "winddirection_10m": [ 84, 76 ]
+          }
+        },
+        {
+          "latitude": 48.86,
+          "longitude": 2.35,
+          "hourly_units": { "time": "iso8601", "temperature_2m": "°C", "relativehumidity_2m": "%", "precipitation": "mm", "rain": "mm", "showers": "mm", "snowfall": "cm", "pressure_msl": "hPa", "surface_pressure": "hPa", "cloudcover": "%", "windspeed_10m": "m/s", "winddirection_10m": "°" },
+          "hourly": {
+            "time": [ "2022-09-08T00:00", "2022-09-08T01:00", "2022-09-08T02:00" ],
+            "temperature_2m": [ 20.5, 20.1, 19.8 ],
+            "relativehumidity_2m": [ 55, 56, 58 ],
+            "precipitation": [ 0, 0, 0 ],
+            "rain": [ 0, 0, 0 ],
+            "showers": [ 0, 0, 0 ],
+            "snowfall": [ 0, 0, 0 ],
+            "pressure_msl": [ 1015.0, 1015.2, 1015.1 ],
+            "surface_pressure": [ 1010.0, 1010.2, 1010.1 ],
+            "cloudcover": [ 0, 5, 10 ],
+            "windspeed_10m": [ 1.5, 1.6, 1.4 ],
+            "winddirection_10m": [ 270, 265, 260 ]
+          }
+        }
+      ]
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseForecastBatch(json, forecasts) );
+      REQUIRE( forecasts.size() == 2 );
+      REQUIRE( forecasts[0].data().size() == 2 );
+      REQUIRE( forecasts[0].data()[1].dataTime() == toOpenMeteoTime(2022, 9, 8, 1, 0) );
+      REQUIRE( forecasts[0].data()[1].temperatureCelsius() == 17.1f );
+      REQUIRE( forecasts[0].data()[1].humidity() == 62 );
+      REQUIRE( forecasts[0].json().find("52.52") != std::string::npos );
+      REQUIRE( forecasts[1].data().size() == 3 );
+      REQUIRE( forecasts[1].data()[2].dataTime() == toOpenMeteoTime(2022, 9, 8, 2, 0) );
+      REQUIRE( forecasts[1].data()[2].temperatureCelsius() == 19.8f );
+      REQUIRE( forecasts[1].data()[2].cloudiness() == 10 );
+      REQUIRE( forecasts[1].data()[2].windDegrees() == 260 );
+      REQUIRE( forecasts[1].json().find("48.86") != std::string::npos );
+    }
+
+    SECTION("failure: units of one location are wrong")
+    {
+      const std::string json = R"json(
+      [
+        {
+          "hourly_units": { "time": "rfc1123" },
+          "hourly": { "time": [ 1662595200 ] }
+        }
+      ]
+      )json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseForecastBatch(json, forecasts) );
+    }
+  }
+
+  SECTION("parseCurrentAndForecastBatch")
+  {
+    std::vector<Weather> weather;
+    std::vector<Forecast> forecasts;
+
+    SECTION("not valid JSON")
+    {
+      const std::string json = "[ { \"this\": 'is not valid, JSON: true";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts) );
+    }
+
+    SECTION("successful parsing of several locations")
+    {
+      const std::string json = R"json(
+      [
+        {
+          "latitude": 52.52,
+          "longitude": 13.42,
+          "current_weather": { "temperature": 16.8, "windspeed": 8.2, "winddirection": 105, "weathercode": 61, "time": "2022-09-08T13:00" },
+          "hourly_units": { "time": "iso8601", "temperature_2m": "°C", "relativehumidity_2m": "%", "precipitation": "mm", "rain": "mm", "showers": "mm", "snowfall": "cm", "pressure_msl": "hPa", "surface_pressure": "hPa", "cloudcover": "%", "windspeed_10m": "m/s", "winddirection_10m": "°" },
+          "hourly": {
+            "time": [ "2022-09-08T00:00", "2022-09-08T01:00" ],
+            "temperature_2m": [ 17.7, 17.1 ],
+            "relativehumidity_2m": [ 61, 62 ],
+            "precipitation": [ 0, 0.3 ],
+            "rain": [ 0, 0.1 ],
+            "showers": [ 0, 0.2 ],
+            "snowfall": [ 0, 0 ],
+            "pressure_msl": [ 1011.3, 1011.2 ],
+            "surface_pressure": [ 1006.6, 1006.5 ],
+            "cloudcover": [ 100, 96 ],
+            "windspeed_10m": [ 2.42, 2.66 ],
+            "winddirection_10m": [ 84, 76 ]
+          }
+        },
+        {
+          "latitude": 48.86,
+          "longitude": 2.35,
+          "current_weather": { "temperature": 21.3, "windspeed": 1.7, "winddirection": 250, "weathercode": 0, "time": "2022-09-08T12:00" },
+          "hourly_units": { "time": "iso8601", "temperature_2m": "°C", "relativehumidity_2m": "%", "precipitation": "mm", "rain": "mm", "showers": "mm", "snowfall": "cm", "pressure_msl": "hPa", "surface_pressure": "hPa", "cloudcover": "%", "windspeed_10m": "m/s", "winddirection_10m": "°" },
+          "hourly": {
+            "time": [ "2022-09-08T00:00", "2022-09-08T01:00", "2022-09-08T02:00" ],
+            "temperature_2m": [ 20.5, 20.1, 19.8 ],
+            "relativehumidity_2m": [ 55, 56, 58 ],
+            "precipitation": [ 0, 0, 0 ],
+            "rain": [ 0, 0, 0 ],
+            "showers": [ 0, 0, 0 ],
+            "snowfall": [ 0, 0, 0 ],
+            "pressure_msl": [ 1015.0, 1015.2, 1015.1 ],
+            "surface_pressure": [ 1010.0, 1010.2, 1010.1 ],
+            "cloudcover": [ 0, 5, 10 ],
+            "windspeed_10m": [ 1.5, 1.6, 1.4 ],
+            "winddirection_10m": [ 270, 265, 260 ]
+          }
+        }
+      ]
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts) );
+      REQUIRE( weather.size() == 2 );
+      REQUIRE( forecasts.size() == 2 );
+      // Check first location.
+      REQUIRE( weather[0].dataTime() == toOpenMeteoTime(2022, 9, 8, 13, 0) );
+      REQUIRE( weather[0].temperatureCelsius() == 16.8f );
+      REQUIRE( weather[0].windDegrees() == 105 );
+      REQUIRE( forecasts[0].data().size() == 2 );
+      REQUIRE( forecasts[0].data()[1].dataTime() == toOpenMeteoTime(2022, 9, 8, 1, 0) );
+      REQUIRE( forecasts[0].data()[1].temperatureCelsius() == 17.1f );
+      REQUIRE( forecasts[0].data()[1].humidity() == 62 );
+      REQUIRE( weather[0].json().find("52.52") != std::string::npos );
+      REQUIRE( weather[0].json().find("48.86") == std::string::npos );
+      REQUIRE( &weather[0].json() == &forecasts[0].json() );
+      // Check second location.
+      REQUIRE( weather[1].dataTime() == toOpenMeteoTime(2022, 9, 8, 12, 0) );
+      REQUIRE( weather[1].temperatureCelsius() == 21.3f );
+      REQUIRE( weather[1].windSpeed() == 1.7f );
+      REQUIRE( forecasts[1].data().size() == 3 );
+      REQUIRE( forecasts[1].data()[2].dataTime() == toOpenMeteoTime(2022, 9, 8, 2, 0) );
+      REQUIRE( forecasts[1].data()[2].temperatureCelsius() == 19.8f );
+      REQUIRE( forecasts[1].data()[2].cloudiness() == 10 );
+      REQUIRE( weather[1].json().find("48.86") != std::string::npos );
+      REQUIRE( &weather[1].json() == &forecasts[1].json() );
+    }
+
+    SECTION("successful parsing of a single location")
+    {
+      const std::string json = R"json(
+      {
+        "latitude": 52.52,
+        "longitude": 13.42,
+        "current_weather": { "temperature": 16.8, "windspeed": 8.2, "winddirection": 105, "weathercode": 61, "time": "2022-09-08T13:00" },
+        "hourly_units": { "time": "iso8601", "temperature_2m": "°C", "relativehumidity_2m": "%", "precipitation": "mm", "rain": "mm", "showers": "mm", "snowfall": "cm", "pressure_msl": "hPa", "surface_pressure": "hPa", "cloudcover": "%", "windspeed_10m": "m/s", "winddirection_10m": "°" },
+        "hourly": {
+          "time": [ "2022-09-08T00:00" ],
+          "temperature_2m": [ 17.7 ],
+          "relativehumidity_2m": [ 61 ],
+          "precipitation": [ 0 ],
+          "rain": [ 0 ],
+          "showers": [ 0 ],
+          "snowfall": [ 0 ],
+          "pressure_msl": [ 1011.3 ],
+          "surface_pressure": [ 1006.6 ],
+          "cloudcover": [ 100 ],
+          "windspeed_10m": [ 2.42 ],
+          "winddirection_10m": [ 84 ]
+        }
+      }
+      )json";
+      REQUIRE( SimdJsonOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts) );
+      REQUIRE( weather.size() == 1 );
+      REQUIRE( forecasts.size() == 1 );
+      REQUIRE( weather[0].temperatureCelsius() == 16.8f );
+      REQUIRE( forecasts[0].data().size() == 1 );
+      REQUIRE( forecasts[0].data()[0].temperatureCelsius() == 17.7f );
+      REQUIRE( weather[0].json() == json );
+      REQUIRE( &weather[0].json() == &forecasts[0].json() );
+    }
+
+    SECTION("failure: current weather of one location is missing")
+    {
+      const std::string json = R"json(
+      [
+        {
+          "latitude": 52.52,
+          "longitude": 13.42,
+          "hourly_units": { "time": "iso8601", "temperature_2m": "°C", "relativehumidity_2m": "%", "precipitation": "mm", "rain": "mm", "showers": "mm", "snowfall": "cm", "pressure_msl": "hPa", "surface_pressure": "hPa", "cloudcover": "%", "windspeed_10m": "m/s", "winddirection_10m": "°" },
+          "hourly": {
+            "time": [ "2022-09-08T00:00" ],
+            "temperature_2m": [ 17.7 ],
+            "relativehumidity_2m": [ 61 ],
+            "precipitation": [ 0 ],
+            "rain": [ 0 ],
+            "showers": [ 0 ],
+            "snowfall": [ 0 ],
+            "pressure_msl": [ 1011.3 ],
+            "surface_pressure": [ 1006.6 ],
+            "cloudcover": [ 100 ],
+            "windspeed_10m": [ 2.42 ],
+            "winddirection_10m": [ 84 ]
+          }
+        }
+      ]
+      )json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts) );
+    }
+
+    SECTION("failure: forecast of one location is missing")
+    {
+      const std::string json = R"json(
+      [
+        {
+          "latitude": 52.52,
+          "longitude": 13.42,
+          "current_weather": { "temperature": 16.8, "windspeed": 8.2, "winddirection": 105, "weathercode": 61, "time": "2022-09-08T13:00" }
+        }
+      ]
+      )json";
+      REQUIRE_FALSE( SimdJsonOpenMeteo::parseCurrentAndForecastBatch(json, weather, forecasts) );
+    }
+  }
+
   SECTION("parseLocations")
   {
     std::vector<Location> locations;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2021, 2022  Dirk Stolle
+    Copyright (C) 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,8 @@
 */
 
 #include "../../find_catch.hpp"
+#include <utility>
+#include <vector>
 #include "../../../src/json/SimdJsonOwm.hpp"
 
 TEST_CASE("Class SimdJsonOwm")
@@ -535,6 +537,106 @@ TEST_CASE("Class SimdJsonOwm")
     }
   }
 
+  SECTION("parseCurrentWeatherGroup")
+  {
+    std::vector<std::pair<uint32_t, Weather> > weather;
+
+    SECTION("not valid JSON")
+    {
+      const std::string json = "{ \"this\": 'is not valid, JSON: true";
+      REQUIRE_FALSE( SimdJsonOwm::parseCurrentWeatherGroup(json, weather) );
+    }
+
+    SECTION("list is missing")
+    {
+      const std::string json = R"json({ "cnt": 0 })json";
+      REQUIRE_FALSE( SimdJsonOwm::parseCurrentWeatherGroup(json, weather) );
+    }
+
+    SECTION("id is missing in one element")
+    {
+      const std::string json = R"json(
+      {
+        "cnt": 1,
+        "list": [
+          { "main": { "temp": 280.15, "pressure": 1012, "humidity": 81 }, "dt": 1560350645, "name": "Dresden" }
+        ]
+      }
+      )json";
+      REQUIRE_FALSE( SimdJsonOwm::parseCurrentWeatherGroup(json, weather) );
+    }
+
+    SECTION("cnt does not match the number of actual elements")
+    {
+      const std::string json = R"json(
+      {
+        "cnt": 2,
+        "list": [
+          { "main": { "temp": 280.15, "pressure": 1012, "humidity": 81 }, "dt": 1560350645, "id": 2935022, "name": "Dresden" }
+        ]
+      }
+      )json";
+      REQUIRE_FALSE( SimdJsonOwm::parseCurrentWeatherGroup(json, weather) );
+    }
+
+    SECTION("successful parsing of several locations")
+    {
+      const std::string json = R"json(
+      {
+        "cnt": 2,
+        "list": [
+          {
+            "coord": { "lon": 13.74, "lat": 51.05 },
+            "weather": [ { "id": 803, "main": "Clouds", "description": "broken clouds", "icon": "04d" } ],
+            "main": { "temp": 288.15, "pressure": 1016, "humidity": 67 },
+            "wind": { "speed": 3.6, "deg": 250 },
+            "clouds": { "all": 75 },
+            "dt": 1560350645,
+            "id": 2935022,
+            "name": "Dresden"
+          },
+          {
+            "coord": { "lon": 13.41, "lat": 52.52 },
+            "weather": [ { "id": 800, "main": "Clear", "description": "clear sky", "icon": "01d" } ],
+            "main": { "temp": 290.15, "pressure": 1018, "humidity": 55 },
+            "wind": { "speed": 2.1, "deg": 180 },
+            "clouds": { "all": 0 },
+            "dt": 1560350700,
+            "id": 2950159,
+            "name": "Berlin"
+          }
+        ]
+      }
+      )json";
+      REQUIRE( SimdJsonOwm::parseCurrentWeatherGroup(json, weather) );
+      REQUIRE( weather.size() == 2 );
+
+      REQUIRE( weather[0].first == 2935022 );
+      REQUIRE( weather[0].second.temperatureKelvin() == 288.15f );
+      REQUIRE( weather[0].second.temperatureCelsius() == 15.0f );
+      REQUIRE( weather[0].second.pressure() == 1016 );
+      REQUIRE( weather[0].second.humidity() == 67 );
+      REQUIRE( weather[0].second.windSpeed() == 3.6f );
+      REQUIRE( weather[0].second.windDegrees() == 250 );
+      REQUIRE( weather[0].second.cloudiness() == 75 );
+      REQUIRE( weather[0].second.json().find("Dresden") != std::string::npos );
+      REQUIRE( weather[0].second.json().find("Berlin") == std::string::npos );
+
+      REQUIRE( weather[1].first == 2950159 );
+      REQUIRE( weather[1].second.temperatureKelvin() == 290.15f );
+      REQUIRE( weather[1].second.temperatureCelsius() == 17.0f );
+      REQUIRE( weather[1].second.pressure() == 1018 );
+      REQUIRE( weather[1].second.humidity() == 55 );
+      REQUIRE( weather[1].second.cloudiness() == 0 );
+      REQUIRE( weather[1].second.json().find("Berlin") != std::string::npos );
+
+      // Data of each location can be parsed like a response for one location.
+      Weather single;
+      REQUIRE( SimdJsonOwm::parseCurrentWeather(weather[1].second.json(), single) );
+      REQUIRE( single.temperatureKelvin() == 290.15f );
+    }
+  }
+
   SECTION("parseLocations")
   {
     std::vector<std::pair<Location, Weather> > locations;
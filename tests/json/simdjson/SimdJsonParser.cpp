@@ -0,0 +1,128 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for weather-information-collector.
+    Copyright (C) 2025  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../find_catch.hpp"
+#include <string>
+#include "../../../src/json/SimdJsonOwm.hpp"
+#include "../../../src/json/SimdJsonParser.hpp"
+
+TEST_CASE("Class SimdJsonParser")
+{
+  using namespace wic;
+
+  SECTION("same parser for each call on the same thread")
+  {
+    simdjson::dom::parser& first = SimdJsonParser::get();
+    simdjson::dom::parser& second = SimdJsonParser::get();
+    REQUIRE( &first == &second );
+  }
+
+  SECTION("parser keeps its capacity")
+  {
+    simdjson::dom::element doc;
+    REQUIRE( SimdJsonParser::get().parse(std::string("{\"a\": [1, 2, 3]}")).get(doc) == simdjson::SUCCESS );
+    const auto capacity = SimdJsonParser::get().capacity();
+    REQUIRE( capacity > 0 );
+    REQUIRE( SimdJsonParser::get().parse(std::string("[1]")).get(doc) == simdjson::SUCCESS );
+    REQUIRE( SimdJsonParser::get().capacity() == capacity );
+  }
+
+  SECTION("large buffers are not kept")
+  {
+    const std::string json = "[" + std::string(SimdJsonParser::retainedCapacity, ' ') + "1]";
+    simdjson::dom::element doc;
+    REQUIRE( SimdJsonParser::get().parse(json).get(doc) == simdjson::SUCCESS );
+    REQUIRE( SimdJsonParser::get().capacity() == 0 );
+  }
+
+  SECTION("release frees the buffers")
+  {
+    simdjson::dom::element doc;
+    REQUIRE( SimdJsonParser::get().parse(std::string("{\"a\": 1}")).get(doc) == simdjson::SUCCESS );
+    SimdJsonParser::release();
+    REQUIRE( SimdJsonParser::get().capacity() == 0 );
+  }
+
+  SECTION("consecutive documents are parsed correctly")
+  {
+    const std::string first = R"json({"coord":{"lon":13.41,"lat":52.52},"weather":[{"id":800,"main":"Clear","description":"clear sky","icon":"01d"}],"main":{"temp":280.5,"pressure":1012,"humidity":81},"wind":{"speed":4.1,"deg":240},"clouds":{"all":0},"dt":1518794400,"id":2950159,"name":"Berlin","cod":200})json";
+    const std::string second = R"json({"coord":{"lon":2.35,"lat":48.85},"weather":[{"id":800,"main":"Clear","description":"clear sky","icon":"01d"}],"main":{"temp":290.25,"pressure":1020,"humidity":50},"wind":{"speed":2.5,"deg":90},"clouds":{"all":20},"dt":1518794400,"id":2988507,"name":"Paris","cod":200})json";
+    Weather weather;
+    REQUIRE( SimdJsonOwm::parseCurrentWeather(first, weather) );
+    REQUIRE( weather.temperatureKelvin() == 280.5f );
+    REQUIRE( weather.humidity() == 81 );
+    REQUIRE( SimdJsonOwm::parseCurrentWeather(second, weather) );
+    REQUIRE( weather.temperatureKelvin() == 290.25f );
+    REQUIRE( weather.humidity() == 50 );
+    REQUIRE( weather.pressure() == 1020 );
+  }
+
+  SECTION("same On-Demand parser for each call on the same thread")
+  {
+    simdjson::ondemand::parser& first = SimdJsonParser::onDemand();
+    simdjson::ondemand::parser& second = SimdJsonParser::onDemand();
+    REQUIRE( &first == &second );
+  }
+
+  SECTION("iterate uses strings with enough padding in place")
+  {
+    std::string json = "{\"a\": 12}";
+    json.reserve(json.size() + simdjson::SIMDJSON_PADDING);
+    simdjson::padded_string copy;
+    simdjson::ondemand::document doc;
+    REQUIRE( SimdJsonParser::iterate(json, copy).get(doc) == simdjson::SUCCESS );
+    int64_t a = 0;
+    REQUIRE( doc["a"].get_int64().get(a) == simdjson::SUCCESS );
+    REQUIRE( a == 12 );
+    REQUIRE( copy.size() == 0 );
+  }
+
+  SECTION("iterate copies strings without padding")
+  {
+    const std::string json = "{\"a\": 12}";
+    simdjson::padded_string copy;
+    simdjson::ondemand::document doc;
+    REQUIRE( SimdJsonParser::iterate(json, copy).get(doc) == simdjson::SUCCESS );
+    int64_t a = 0;
+    REQUIRE( doc["a"].get_int64().get(a) == simdjson::SUCCESS );
+    REQUIRE( a == 12 );
+    if (json.capacity() - json.size() < simdjson::SIMDJSON_PADDING)
+    {
+      REQUIRE( copy.size() == json.size() );
+    }
+  }
+
+  SECTION("release frees the buffers of the On-Demand parser")
+  {
+    const std::string json = "[1, 2, 3]";
+    simdjson::padded_string copy;
+    simdjson::ondemand::document doc;
+    REQUIRE( SimdJsonParser::iterate(json, copy).get(doc) == simdjson::SUCCESS );
+    REQUIRE( SimdJsonParser::onDemand().capacity() > 0 );
+    SimdJsonParser::release();
+    REQUIRE( SimdJsonParser::onDemand().capacity() == 0 );
+  }
+
+  SECTION("minify")
+  {
+    REQUIRE( SimdJsonParser::minify("{ \"a\" : [ 1, 2 ],\n  \"b\": \"x y\" }") == "{\"a\":[1,2],\"b\":\"x y\"}" );
+    REQUIRE( SimdJsonParser::minify("") == "" );
+  }
+}
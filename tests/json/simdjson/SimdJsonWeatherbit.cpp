@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for weather-information-collector.
-    Copyright (C) 2021, 2022  Dirk Stolle
+    Copyright (C) 2021, 2022, 2025  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "../../find_catch.hpp"
+#include <vector>
 #include "../../../src/json/SimdJsonWeatherbit.hpp"
 
 TEST_CASE("SimdJsonWeatherbit")
@@ -588,4 +589,74 @@ TEST_CASE("SimdJsonWeatherbit")
       REQUIRE( forecast.data().at(1).cloudiness() == 1 );
     }
   }
+
+  SECTION("parseCurrentWeatherBatch")
+  {
+    std::vector<Weather> weather;
+
+    SECTION("not valid JSON")
+    {
+      const std::string json = "{ \"this\": 'is not valid, JSON: true";
+      REQUIRE_FALSE( SimdJsonWeatherbit::parseCurrentWeatherBatch(json, weather) );
+    }
+
+    SECTION("data element is missing")
+    {
+      const std::string json = R"json({ "count": 0 })json";
+      REQUIRE_FALSE( SimdJsonWeatherbit::parseCurrentWeatherBatch(json, weather) );
+    }
+
+    SECTION("count does not match the number of elements")
+    {
+      const std::string json = R"json(
+      {
+        "data": [
+          { "rh": 42, "pres": 1005.65, "clouds": 72, "wind_spd": 2.0, "wind_dir": 264, "temp": 16.4, "ts": 1553949441.8558, "city_name": "Dresden" }
+        ],
+        "count": 2
+      }
+      )json";
+      REQUIRE_FALSE( SimdJsonWeatherbit::parseCurrentWeatherBatch(json, weather) );
+    }
+
+    SECTION("element of data array is not an object")
+    {
+      const std::string json = R"json({ "data": [ 1, 2 ], "count": 2 })json";
+      REQUIRE_FALSE( SimdJsonWeatherbit::parseCurrentWeatherBatch(json, weather) );
+    }
+
+    SECTION("successful parsing of several locations")
+    {
+      const std::string json = R"json(
+      {
+        "data": [
+          { "rh": 42, "pres": 1005.65, "clouds": 72, "wind_spd": 2.0, "wind_dir": 264, "temp": 16.4, "ts": 1553949441.8558, "city_name": "Dresden" },
+          { "rh": 60, "pres": 1011.2, "clouds": 10, "wind_spd": 3.5, "wind_dir": 90, "temp": 12.8, "ts": 1553949502.25, "city_name": "Berlin" }
+        ],
+        "count": 2
+      }
+      )json";
+      REQUIRE( SimdJsonWeatherbit::parseCurrentWeatherBatch(json, weather) );
+      REQUIRE( weather.size() == 2 );
+
+      REQUIRE( weather[0].temperatureCelsius() == 16.4f );
+      REQUIRE( weather[0].humidity() == 42 );
+      REQUIRE( weather[0].pressure() == 1005 );
+      REQUIRE( weather[0].cloudiness() == 72 );
+      REQUIRE( weather[0].windDegrees() == 264 );
+      REQUIRE( weather[0].json().find("Dresden") != std::string::npos );
+      REQUIRE( weather[0].json().find("Berlin") == std::string::npos );
+
+      REQUIRE( weather[1].temperatureCelsius() == 12.8f );
+      REQUIRE( weather[1].humidity() == 60 );
+      REQUIRE( weather[1].pressure() == 1011 );
+      REQUIRE( weather[1].cloudiness() == 10 );
+      REQUIRE( weather[1].windSpeed() == 3.5f );
+
+      // Data of each location can be parsed like a response for one location.
+      Weather single;
+      REQUIRE( SimdJsonWeatherbit::parseCurrentWeather(weather[1].json(), single) );
+      REQUIRE( single.temperatureCelsius() == 12.8f );
+    }
+  }
 }
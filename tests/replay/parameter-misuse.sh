@@ -0,0 +1,117 @@
+#!/bin/sh
+
+# Script to test executable when parameters are used in the wrong way.
+#
+#  Copyright (C) 2025  Dirk Stolle
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU Lesser General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU Lesser General Public License for more details.
+#
+#  You should have received a copy of the GNU Lesser General Public License
+#  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# 1st parameter = executable path
+if [ -z "$1" ]
+then
+  echo "First parameter must be executable file!"
+  exit 1
+fi
+
+EXECUTABLE="$1"
+
+# parameter --fixtures given twice
+"$EXECUTABLE" --fixtures . --fixtures .
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --fixtures was given twice."
+  exit 1
+fi
+
+# no directory after parameter --fixtures
+"$EXECUTABLE" --fixtures
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --fixtures had no directory."
+  exit 1
+fi
+
+# no fixture directory at all
+"$EXECUTABLE" --port 8080
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when no fixture directory was given."
+  exit 1
+fi
+
+# parameter --port given twice
+"$EXECUTABLE" --fixtures . --port 8080 --port 8081
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --port was given twice."
+  exit 1
+fi
+
+# port number out of range
+"$EXECUTABLE" --fixtures . --port 70000
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --port was out of range."
+  exit 1
+fi
+
+# no number after parameter --latency
+"$EXECUTABLE" --fixtures . --latency
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --latency had no number."
+  exit 1
+fi
+
+# invalid number after parameter --jitter
+"$EXECUTABLE" --fixtures . --jitter abc
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --jitter had no valid number."
+  exit 1
+fi
+
+# error rate above 100 percent
+"$EXECUTABLE" --fixtures . --error-rate 101
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --error-rate was above 100."
+  exit 1
+fi
+
+# negative throughput
+"$EXECUTABLE" --fixtures . --throughput -5
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when --throughput was negative."
+  exit 1
+fi
+
+# unknown parameter
+"$EXECUTABLE" --this-is-not-supported
+if [ $? -ne 1 ]
+then
+  echo "Executable did not exit with code 1 when an unknown parameter was given."
+  exit 1
+fi
+
+# Fixture directory does not exist.
+"$EXECUTABLE" --fixtures this-directory-is-missing
+if [ $? -ne 7 ]
+then
+  echo "Executable did not exit with code 7 when fixture directory was missing."
+  exit 1
+fi
+
+exit 0